@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -192,13 +192,7 @@ void CommandList::eraseDeallocationContainerEntry(NEO::GraphicsAllocation *alloc
 }
 
 void CommandList::eraseResidencyContainerEntry(NEO::GraphicsAllocation *allocation) {
-    std::vector<NEO::GraphicsAllocation *>::iterator allocErase;
-    auto container = &commandContainer.getResidencyContainer();
-
-    allocErase = std::find(container->begin(), container->end(), allocation);
-    if (allocErase != container->end()) {
-        container->erase(allocErase);
-    }
+    commandContainer.eraseFromResidencyContainer(allocation);
 }
 
 void CommandList::migrateSharedAllocations() {
@@ -36,6 +36,7 @@ struct _ze_command_list_handle_t {
 };
 
 namespace NEO {
+class CpuCopyEngine;
 class ScratchSpaceController;
 } // namespace NEO
 
@@ -145,6 +146,22 @@ struct CommandList : _ze_command_list_handle_t {
 
     virtual void *asMutable() { return nullptr; };
 
+    virtual ze_result_t getNextCommandId(const ze_mutable_command_id_exp_desc_t *desc, uint32_t numKernels, ze_kernel_handle_t *phKernels, uint64_t *pCommandId) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t updateMutableCommands(const ze_mutable_commands_exp_desc_t *desc) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t updateMutableCommandSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t updateMutableCommandWaitEvents(uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    virtual ze_result_t updateMutableCommandKernels(uint32_t numKernels, uint64_t *pCommandId, ze_kernel_handle_t *phKernels) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
     virtual ze_result_t reserveSpace(size_t size, void **ptr) = 0;
     virtual ze_result_t reset() = 0;
 
@@ -447,6 +464,7 @@ struct CommandList : _ze_command_list_handle_t {
     CommandQueue *cmdQImmediateCopyOffload = nullptr;
     Device *device = nullptr;
     NEO::ScratchSpaceController *usedScratchController = nullptr;
+    NEO::CpuCopyEngine *cpuCopyEngine = nullptr;
 
     size_t minimalSizeForBcsSplit = 4 * MemoryConstants::megaByte;
     size_t cmdListCurrentStartOffset = 0;
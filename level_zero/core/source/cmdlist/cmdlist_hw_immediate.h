@@ -9,11 +9,15 @@
 
 #include "shared/source/command_stream/csr_definitions.h"
 #include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/periodic_task_scheduler.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 
 #include <atomic>
+#include <chrono>
 #include <functional>
+#include <mutex>
 
 namespace NEO {
 struct SvmAllocationData;
@@ -56,6 +60,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     using ComputeFlushMethodType = NEO::CompletionStamp (CommandListCoreFamilyImmediate<gfxCoreFamily>::*)(NEO::LinearStream &, size_t, bool, bool, bool, bool);
 
     CommandListCoreFamilyImmediate(uint32_t numIddsPerBlock);
+    ~CommandListCoreFamilyImmediate() override;
 
     ze_result_t appendLaunchKernel(ze_kernel_handle_t kernelHandle,
                                    const ze_group_count_t &threadGroupDimensions,
@@ -181,6 +186,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                                uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
 
     ze_result_t hostSynchronize(uint64_t timeout) override;
+    ze_result_t destroy() override;
 
     ze_result_t close() override {
         return ZE_RESULT_SUCCESS;
@@ -201,6 +207,12 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void handleDebugSurfaceStateUpdate(NEO::IndirectHeap *ssh);
 
     void checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies, size_t commandSize);
+    bool prepareSubmissionCoalescing(ze_kernel_handle_t kernelHandle, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, const CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch);
+    ze_result_t deferCoalescedSubmission(ze_result_t inputRet, bool hasStallingCmds);
+    ze_result_t flushCoalescedSubmission();
+    void flushCoalescedSubmissionOnCsrRequest(bool blocking);
+    void flushCoalescedSubmissionOnDeadline();
+    uint32_t getCoalescedAppendsCount() const { return coalescedSubmission.appendsCount; }
     void updateDispatchFlagsWithRequiredStreamState(NEO::DispatchFlags &dispatchFlags);
 
     MOCKABLE_VIRTUAL ze_result_t flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, bool kernelOperation, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent, bool requireTaskCountUpdate);
@@ -232,12 +244,59 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     CommandQueue *getCmdQImmediate(bool copyOffloadOperation) const;
 
     MOCKABLE_VIRTUAL void checkAssert();
+    void setupSubmissionCoalescing();
+    void armSubmissionCoalescingDeadline();
+    void releaseSubmissionCoalescing();
+
+    // Guards deferred appends against flushes requested by waits, frees and the deadline task on other threads
+    struct SubmissionCoalescingLock : NEO::NonCopyableOrMovableClass {
+        SubmissionCoalescingLock(CommandListCoreFamilyImmediate &cmdList) : cmdList(cmdList) {
+            if (cmdList.submissionCoalescingEnabled) {
+                lock = std::unique_lock<std::recursive_timed_mutex>(cmdList.submissionCoalescingMutex);
+                cmdList.submissionCoalescingLockDepth++;
+                submissionCoalescingLocksHeldByThread++;
+            }
+        }
+        ~SubmissionCoalescingLock() {
+            if (lock.owns_lock()) {
+                cmdList.submissionCoalescingLockDepth--;
+                submissionCoalescingLocksHeldByThread--;
+            }
+        }
+
+        CommandListCoreFamilyImmediate &cmdList;
+        std::unique_lock<std::recursive_timed_mutex> lock;
+    };
+
+    struct CoalescedSubmission {
+        std::chrono::steady_clock::time_point windowStart{};
+        uint32_t appendsCount = 0;
+        uint16_t numGrfRequired = 0;
+        int32_t threadArbitrationPolicy = 0;
+        bool usesSystolicPipelineSelectMode = false;
+        bool requiresDisabledEUFusion = false;
+        bool hasStallingCmds = false;
+    };
+
     ComputeFlushMethodType computeFlushMethod = nullptr;
+    CoalescedSubmission coalescedSubmission;
+    std::chrono::microseconds submissionCoalescingWindow{50};
+    size_t submissionCoalescingMaxSize = 16 * MemoryConstants::kiloByte;
+    ze_result_t coalescedSubmissionResult = ZE_RESULT_SUCCESS;
+    std::recursive_timed_mutex submissionCoalescingMutex;
+    NEO::CommandStreamReceiver *submissionCoalescingCsr = nullptr;
+    NEO::PeriodicTaskScheduler *submissionCoalescingScheduler = nullptr;
+    NEO::PeriodicTaskScheduler::TaskId submissionCoalescingTaskId = NEO::PeriodicTaskScheduler::invalidTaskId;
+    uint32_t submissionCoalescingLockDepth = 0;
+    // lists of single csr share gfx core family, so this counts all coalescing locks relevant to csr flush requests
+    static inline thread_local uint32_t submissionCoalescingLocksHeldByThread = 0;
     uint64_t relaxedOrderingCounter = 0;
     std::atomic<bool> dependenciesPresent{false};
     bool latestFlushIsHostVisible = false;
     bool latestFlushIsCopyOffload = false;
     bool keepRelaxedOrderingEnabled = false;
+    bool submissionCoalescingEnabled = false;
+    bool coalescingCurrentAppend = false;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
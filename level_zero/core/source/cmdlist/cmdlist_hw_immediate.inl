@@ -16,6 +16,7 @@
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/device/device.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/blit_commands_helper.h"
@@ -26,6 +27,7 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
 #include "shared/source/utilities/wait_util.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
@@ -43,6 +45,7 @@
 
 #include <cmath>
 #include <functional>
+#include <utility>
 
 namespace L0 {
 
@@ -51,8 +54,26 @@ CommandListCoreFamilyImmediate<gfxCoreFamily>::CommandListCoreFamilyImmediate(ui
     computeFlushMethod = &CommandListCoreFamilyImmediate<gfxCoreFamily>::flushRegularTask;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+CommandListCoreFamilyImmediate<gfxCoreFamily>::~CommandListCoreFamilyImmediate() {
+    releaseSubmissionCoalescing();
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies, size_t commandSize) {
+    SubmissionCoalescingLock coalescingLock(*this);
+    if (this->coalescedSubmission.appendsCount > 0) {
+        bool newCmdBufferRequired = this->commandContainer.getCommandStream()->getAvailableSpace() < commandSize + NEO::EncodeSemaphore<GfxFamily>::getSizeMiSemaphoreWait() * numEvents;
+
+        // deferred commands must be submitted before the command buffer changes or a non coalesced operation is appended
+        if (!this->coalescingCurrentAppend || newCmdBufferRequired) {
+            auto ret = flushCoalescedSubmission();
+            if (ret != ZE_RESULT_SUCCESS) {
+                this->coalescedSubmissionResult = ret;
+            }
+        }
+    }
+
     this->commandContainer.fillReusableAllocationLists();
 
     /* Command container might has two command buffers. If it has, one is in local memory, because relaxed ordering requires that and one in system for copying it into ring buffer.
@@ -512,9 +533,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
     CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
 
+    SubmissionCoalescingLock coalescingLock(*this);
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents, false);
     bool stallingCmdsForRelaxedOrdering = hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch);
 
+    this->coalescingCurrentAppend = prepareSubmissionCoalescing(kernelHandle, hSignalEvent, numWaitEvents, launchParams, relaxedOrderingDispatch);
+
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
     bool hostWait = waitForEventsFromHost();
     if (hostWait) {
@@ -539,6 +564,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
         CommandListCoreFamily<gfxCoreFamily>::handleInOrderDependencyCounter(event, true, false);
     }
 
+    if (this->coalescingCurrentAppend) {
+        this->coalescingCurrentAppend = false;
+        return deferCoalescedSubmission(ret, stallingCmdsForRelaxedOrdering);
+    }
+
     return flushImmediate(ret, true, stallingCmdsForRelaxedOrdering, relaxedOrderingDispatch, true, false, hSignalEvent, false);
 }
 
@@ -1059,6 +1089,17 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalExternalS
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint64_t timeout, bool handlePostWaitOperations) {
     ze_result_t status = ZE_RESULT_SUCCESS;
+    {
+        SubmissionCoalescingLock coalescingLock(*this);
+        status = flushCoalescedSubmission();
+        if (status == ZE_RESULT_SUCCESS) {
+            status = this->coalescedSubmissionResult;
+        }
+        this->coalescedSubmissionResult = ZE_RESULT_SUCCESS;
+    }
+    if (status != ZE_RESULT_SUCCESS) {
+        return status;
+    }
 
     auto waitQueue = this->cmdQImmediate;
 
@@ -1162,6 +1203,7 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds,
                                                                           bool hasRelaxedOrderingDependencies, bool kernelOperation, bool copyOffloadSubmission, ze_event_handle_t hSignalEvent,
                                                                           bool requireTaskCountUpdate) {
+    SubmissionCoalescingLock coalescingLock(*this);
     auto signalEvent = Event::fromHandle(hSignalEvent);
 
     auto queue = getCmdQImmediate(copyOffloadSubmission);
@@ -1177,6 +1219,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
                 signalEvent->setLatestUsedCmdQueue(queue);
             }
             inputRet = executeCommandListImmediateWithFlushTask(performMigration, hasStallingCmds, hasRelaxedOrderingDependencies, kernelOperation, copyOffloadSubmission, requireTaskCountUpdate);
+
+            if (this->coalescedSubmission.appendsCount > 0) {
+                PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintImmediateCmdListSubmissionCoalescing.get(), stdout, "Immediate command list submission coalesced %u appends\n", this->coalescedSubmission.appendsCount);
+                this->coalescedSubmission = {};
+            }
         } else {
             inputRet = executeCommandListImmediate(performMigration);
         }
@@ -1189,6 +1236,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
         this->latestFlushIsHostVisible |= signalEvent->isSignalScope(ZE_EVENT_SCOPE_FLAG_HOST) && !copyOffloadSubmission;
     }
 
+    // deferred appends flushed on behalf of this operation failed
+    if (inputRet == ZE_RESULT_SUCCESS && this->coalescedSubmissionResult != ZE_RESULT_SUCCESS) {
+        inputRet = std::exchange(this->coalescedSubmissionResult, ZE_RESULT_SUCCESS);
+    }
+
     return inputRet;
 }
 
@@ -1346,7 +1398,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
         signalEvent->setGpuStartTimestamp();
     }
 
-    memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    if (this->cpuCopyEngine) {
+        // locked device memory is mapped write combined
+        this->cpuCopyEngine->copy(cpuMemcpyDstPtr, cpuMemcpySrcPtr, cpuMemCopyInfo.size, dstLockPointer != nullptr);
+    } else {
+        memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    }
 
     if (signalEvent) {
         signalEvent->setGpuEndTimestamp();
@@ -1464,6 +1521,8 @@ size_t CommandListCoreFamilyImmediate<gfxCoreFamily>::getTransferThreshold(Trans
         retVal = 4 * MemoryConstants::megaByte;
         if (NEO::debugManager.flags.ExperimentalH2DCpuCopyThreshold.get() != -1) {
             retVal = NEO::debugManager.flags.ExperimentalH2DCpuCopyThreshold.get();
+        } else if (this->cpuCopyEngine) {
+            retVal = this->cpuCopyEngine->scaleTransferThreshold(retVal, true);
         }
         break;
     case TransferType::hostNonUsmToSharedUsm:
@@ -1497,6 +1556,8 @@ size_t CommandListCoreFamilyImmediate<gfxCoreFamily>::getTransferThreshold(Trans
         retVal = 1 * MemoryConstants::kiloByte;
         if (NEO::debugManager.flags.ExperimentalD2HCpuCopyThreshold.get() != -1) {
             retVal = NEO::debugManager.flags.ExperimentalD2HCpuCopyThreshold.get();
+        } else if (this->cpuCopyEngine) {
+            retVal = this->cpuCopyEngine->scaleTransferThreshold(retVal, false);
         }
         break;
     case TransferType::sharedUsmToHostUsm:
@@ -1647,6 +1708,187 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::setupFlushMethod(const NEO::
             this->computeFlushMethod = &CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediateRegularTask;
         }
     }
+    setupSubmissionCoalescing();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::setupSubmissionCoalescing() {
+    this->submissionCoalescingEnabled = NEO::debugManager.flags.EnableImmediateCmdListSubmissionCoalescing.get() == 1;
+
+    if (NEO::debugManager.flags.ImmediateCmdListSubmissionCoalescingMaxSize.get() != -1) {
+        this->submissionCoalescingMaxSize = static_cast<size_t>(NEO::debugManager.flags.ImmediateCmdListSubmissionCoalescingMaxSize.get());
+    }
+    if (NEO::debugManager.flags.ImmediateCmdListSubmissionCoalescingWindowUs.get() != -1) {
+        this->submissionCoalescingWindow = std::chrono::microseconds(NEO::debugManager.flags.ImmediateCmdListSubmissionCoalescingWindowUs.get());
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::prepareSubmissionCoalescing(ze_kernel_handle_t kernelHandle, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, const CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
+    if (!this->submissionCoalescingEnabled || this->isSyncModeQueue || !this->isFlushTaskSubmissionEnabled) {
+        return false;
+    }
+
+    // Host visible dependencies require immediate submission
+    if (hSignalEvent || numWaitEvents > 0 || relaxedOrderingDispatch) {
+        return false;
+    }
+
+    // Without heapless mode deferred walkers would depend on heap base addresses and heap lifetime that may change before submission
+    if (!this->heaplessModeEnabled || this->immediateCmdListHeapSharing) {
+        return false;
+    }
+
+    if (launchParams.isCooperative || launchParams.isIndirect || launchParams.isKernelSplitOperation || launchParams.isBuiltInKernel || launchParams.makeKernelCommandView) {
+        return false;
+    }
+
+    auto kernel = Kernel::fromHandle(kernelHandle);
+    if (static_cast<KernelImp *>(kernel)->getKernelRequiresUncachedMocs() || static_cast<DeviceImp *>(this->device)->calculationForDisablingEuFusionWithDpasNeeded) {
+        return false;
+    }
+
+    // Stream state is programmed once per submission, so all coalesced kernels have to require the same state
+    auto &kernelAttributes = kernel->getKernelDescriptor().kernelAttributes;
+    auto &pending = this->coalescedSubmission;
+    if (pending.appendsCount > 0 &&
+        (pending.numGrfRequired != kernelAttributes.numGrfRequired ||
+         pending.threadArbitrationPolicy != static_cast<int32_t>(kernelAttributes.threadArbitrationPolicy) ||
+         pending.usesSystolicPipelineSelectMode != kernelAttributes.flags.usesSystolicPipelineSelectMode ||
+         pending.requiresDisabledEUFusion != kernelAttributes.flags.requiresDisabledEUFusion)) {
+        auto ret = flushCoalescedSubmission();
+        if (ret != ZE_RESULT_SUCCESS) {
+            this->coalescedSubmissionResult = ret;
+            return false;
+        }
+    }
+
+    if (pending.appendsCount == 0) {
+        pending.numGrfRequired = kernelAttributes.numGrfRequired;
+        pending.threadArbitrationPolicy = static_cast<int32_t>(kernelAttributes.threadArbitrationPolicy);
+        pending.usesSystolicPipelineSelectMode = kernelAttributes.flags.usesSystolicPipelineSelectMode;
+        pending.requiresDisabledEUFusion = kernelAttributes.flags.requiresDisabledEUFusion;
+    }
+    return true;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::deferCoalescedSubmission(ze_result_t inputRet, bool hasStallingCmds) {
+    if (inputRet != ZE_RESULT_SUCCESS) {
+        return inputRet;
+    }
+
+    auto &pending = this->coalescedSubmission;
+    auto now = std::chrono::steady_clock::now();
+    if (pending.appendsCount == 0) {
+        pending.windowStart = now;
+        armSubmissionCoalescingDeadline();
+    }
+    pending.appendsCount++;
+    pending.hasStallingCmds |= hasStallingCmds;
+
+    auto pendingSize = this->commandContainer.getCommandStream()->getUsed() - this->cmdListCurrentStartOffset;
+    if (pendingSize >= this->submissionCoalescingMaxSize || (now - pending.windowStart) >= this->submissionCoalescingWindow) {
+        return flushCoalescedSubmission();
+    }
+    return std::exchange(this->coalescedSubmissionResult, ZE_RESULT_SUCCESS);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushCoalescedSubmission() {
+    if (this->coalescedSubmission.appendsCount == 0) {
+        return ZE_RESULT_SUCCESS;
+    }
+    return flushImmediate(ZE_RESULT_SUCCESS, true, this->coalescedSubmission.hasStallingCmds, false, true, false, nullptr, false);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::flushCoalescedSubmissionOnCsrRequest(bool blocking) {
+    // Frees check task counts right after blocking request, so it waits until appends in progress on other threads
+    // are done and submits them. Waits may hold csr ownership taken by appending thread under this lock, so they give
+    // up after coalescing window, after which deadline flush submits pending appends anyway. Thread already holding
+    // a coalescing lock only tries the lock, as waiting could close a lock cycle with another list flushing on behalf of it.
+    std::unique_lock<std::recursive_timed_mutex> lock(this->submissionCoalescingMutex, std::defer_lock);
+    if (submissionCoalescingLocksHeldByThread > 0) {
+        if (!lock.try_lock()) {
+            return;
+        }
+    } else if (blocking) {
+        lock.lock();
+    } else if (!lock.try_lock_for(this->submissionCoalescingWindow)) {
+        return;
+    }
+    // nonzero depth means this thread re-entered from an ongoing append or flush of this list
+    if (this->submissionCoalescingLockDepth > 0) {
+        return;
+    }
+
+    SubmissionCoalescingLock coalescingLock(*this);
+    auto ret = flushCoalescedSubmission();
+    if (ret != ZE_RESULT_SUCCESS) {
+        this->coalescedSubmissionResult = ret;
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::flushCoalescedSubmissionOnDeadline() {
+    // list busy on other thread submits pending appends itself, deadline flush is best effort
+    std::unique_lock<std::recursive_timed_mutex> lock(this->submissionCoalescingMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return;
+    }
+
+    // scheduler may run the task early when coalescing its wakeups
+    auto &pending = this->coalescedSubmission;
+    if (pending.appendsCount > 0 && (std::chrono::steady_clock::now() - pending.windowStart) < this->submissionCoalescingWindow) {
+        return;
+    }
+
+    {
+        SubmissionCoalescingLock coalescingLock(*this);
+        auto ret = flushCoalescedSubmission();
+        if (ret != ZE_RESULT_SUCCESS) {
+            this->coalescedSubmissionResult = ret;
+        }
+    }
+    if (pending.appendsCount == 0) {
+        this->submissionCoalescingScheduler->setTaskPeriod(this->submissionCoalescingTaskId, NEO::PeriodicTaskScheduler::onDemandPeriod);
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::armSubmissionCoalescingDeadline() {
+    if (this->submissionCoalescingScheduler == nullptr) {
+        this->submissionCoalescingCsr = getCsr(false);
+        this->submissionCoalescingCsr->registerDeferredSubmissionsFlush(this, [this](bool blocking) { flushCoalescedSubmissionOnCsrRequest(blocking); });
+
+        this->submissionCoalescingScheduler = this->device->getNEODevice()->getExecutionEnvironment()->initializePeriodicTaskScheduler();
+        this->submissionCoalescingTaskId = this->submissionCoalescingScheduler->registerTask([this]() { flushCoalescedSubmissionOnDeadline(); }, NEO::PeriodicTaskScheduler::onDemandPeriod);
+    }
+    this->submissionCoalescingScheduler->setTaskPeriod(this->submissionCoalescingTaskId, this->submissionCoalescingWindow);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::releaseSubmissionCoalescing() {
+    if (this->submissionCoalescingScheduler == nullptr) {
+        return;
+    }
+    // both wait for flushes in progress on other threads, so this list must not be locked here
+    this->submissionCoalescingScheduler->unregisterTask(this->submissionCoalescingTaskId);
+    this->submissionCoalescingCsr->unregisterDeferredSubmissionsFlush(this);
+    this->submissionCoalescingScheduler = nullptr;
+    this->submissionCoalescingTaskId = NEO::PeriodicTaskScheduler::invalidTaskId;
+    this->submissionCoalescingCsr = nullptr;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::destroy() {
+    releaseSubmissionCoalescing();
+    {
+        SubmissionCoalescingLock coalescingLock(*this);
+        flushCoalescedSubmission();
+    }
+    return BaseClass::destroy();
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
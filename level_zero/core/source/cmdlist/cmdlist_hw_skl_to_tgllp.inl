@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -203,6 +203,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         nullptr,                                                // cpuWalkerBuffer
         nullptr,                                                // cpuPayloadBuffer
         nullptr,                                                // outImplicitArgsPtr
+        nullptr,                                                // outIndirectDataPtr
+        nullptr,                                                // outSurfaceStatesPtr
         &additionalCommands,                                    // additionalCommands
         commandListPreemptionMode,                              // preemptionMode
         launchParams.requiredPartitionDim,                      // requiredPartitionDim
@@ -346,6 +346,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         launchParams.cmdWalkerBuffer,                           // cpuWalkerBuffer
         launchParams.hostPayloadBuffer,                         // cpuPayloadBuffer
         nullptr,                                                // outImplicitArgsPtr
+        nullptr,                                                // outIndirectDataPtr
+        nullptr,                                                // outSurfaceStatesPtr
         &additionalCommands,                                    // additionalCommands
         kernelPreemptionMode,                                   // preemptionMode
         launchParams.requiredPartitionDim,                      // requiredPartitionDim
@@ -375,6 +377,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
 
     NEO::EncodeDispatchKernel<GfxFamily>::encodeCommon(commandContainer, dispatchKernelArgs);
     launchParams.outWalker = dispatchKernelArgs.outWalkerPtr;
+    launchParams.outIndirectData = dispatchKernelArgs.outIndirectDataPtr;
+    launchParams.outSurfaceStates = dispatchKernelArgs.outSurfaceStatesPtr;
 
     if (this->heaplessModeEnabled && this->scratchAddressPatchingEnabled && kernelNeedsScratchSpace) {
         CommandToPatch scratchInlineData;
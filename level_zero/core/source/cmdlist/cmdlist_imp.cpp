@@ -11,6 +11,7 @@
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/engine_control.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/gfx_core_helper.h"
@@ -259,6 +260,9 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
         commandList->isBcsSplitNeeded = deviceImp->bcsSplit.setupDevice(productFamily, internalUsage, &cmdQdesc, csr);
 
         commandList->copyThroughLockedPtrEnabled = gfxCoreHelper.copyThroughLockedPtrEnabled(hwInfo, device->getProductHelper());
+        if (commandList->copyThroughLockedPtrEnabled || NEO::debugManager.flags.ExperimentalForceCopyThroughLock.get() == 1) {
+            commandList->cpuCopyEngine = device->getNEODevice()->getExecutionEnvironment()->initializeCpuCopyEngine();
+        }
 
         if ((NEO::debugManager.flags.ForceCopyOperationOffloadForComputeCmdList.get() == 1 || queueProperties.copyOffloadHint) && !commandList->isCopyOnly(false) && commandList->isInOrderExecutionEnabled()) {
             commandList->enableCopyOperationOffload(productFamily, device, desc);
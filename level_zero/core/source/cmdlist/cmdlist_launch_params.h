@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,6 +50,8 @@ struct CmdListKernelLaunchParams {
     void *outWalker = nullptr;
     void *cmdWalkerBuffer = nullptr;
     void *hostPayloadBuffer = nullptr;
+    void *outIndirectData = nullptr;
+    void *outSurfaceStates = nullptr;
     CommandToPatch *outSyncCommand = nullptr;
     CommandToPatchContainer *outListCommands = nullptr;
     size_t syncBufferPatchIndex = std::numeric_limits<size_t>::max();
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/cmdlist/mutable_cmdlist.h"
+
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hw_info.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist_imp.h"
+#include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
+
+#include "igfxfmid.h"
+
+namespace L0 {
+
+CommandListAllocatorFn mutableCommandListFactory[IGFX_MAX_PRODUCT] = {};
+
+CommandList *MutableCommandList::create(uint32_t productFamily, Device *device, NEO::EngineGroupType engineGroupType,
+                                        ze_command_list_flags_t flags, ze_result_t &resultValue, bool internalUsage) {
+    CommandListAllocatorFn allocator = nullptr;
+    if (productFamily < IGFX_MAX_PRODUCT) {
+        allocator = mutableCommandListFactory[productFamily];
+    }
+
+    UNRECOVERABLE_IF(internalUsage);
+
+    CommandListImp *commandList = nullptr;
+    resultValue = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+    if (allocator) {
+        commandList = static_cast<CommandListImp *>((*allocator)(CommandList::defaultNumIddsPerBlock));
+        resultValue = commandList->initialize(device, engineGroupType, flags);
+        if (resultValue != ZE_RESULT_SUCCESS) {
+            commandList->destroy();
+            commandList = nullptr;
+        }
+    }
+
+    return commandList;
+}
+
+ze_mutable_command_exp_flags_t MutableCommandList::getUpdateCapabilities(const NEO::RootDeviceEnvironment &rootDeviceEnvironment) {
+    auto productFamily = rootDeviceEnvironment.getHardwareInfo()->platform.eProductFamily;
+    if (mutableCommandListFactory[productFamily] == nullptr) {
+        return 0u;
+    }
+    return L0GfxCoreHelper::getCmdListUpdateCapabilities(rootDeviceEnvironment) & supportedUpdateFlags;
+}
+
+} // namespace L0
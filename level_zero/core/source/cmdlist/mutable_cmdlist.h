@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+
+namespace NEO {
+struct RootDeviceEnvironment;
+} // namespace NEO
+
+namespace L0 {
+
+struct MutableCommandList {
+    static constexpr ze_mutable_command_exp_flags_t supportedUpdateFlags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS |
+                                                                           ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT |
+                                                                           ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET |
+                                                                           ZE_MUTABLE_COMMAND_EXP_FLAG_SIGNAL_EVENT |
+                                                                           ZE_MUTABLE_COMMAND_EXP_FLAG_WAIT_EVENTS;
+
+    static CommandList *create(uint32_t productFamily, Device *device, NEO::EngineGroupType engineGroupType,
+                               ze_command_list_flags_t flags, ze_result_t &resultValue, bool internalUsage);
+
+    static ze_mutable_command_exp_flags_t getUpdateCapabilities(const NEO::RootDeviceEnvironment &rootDeviceEnvironment);
+};
+
+extern CommandListAllocatorFn mutableCommandListFactory[];
+
+template <uint32_t productFamily, typename CommandListType>
+struct MutableCommandListPopulateFactory {
+    MutableCommandListPopulateFactory() {
+        mutableCommandListFactory[productFamily] = CommandList::Allocator<CommandListType>::allocate;
+    }
+};
+
+} // namespace L0
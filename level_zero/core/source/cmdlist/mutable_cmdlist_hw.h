@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/kernel/kernel_arg_descriptor.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist_hw.h"
+#include "level_zero/core/source/cmdlist/mutable_cmdlist.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace L0 {
+struct Event;
+struct Kernel;
+
+struct MutableKernelDispatch {
+    Kernel *kernel = nullptr;
+    void *walker = nullptr;
+    void *indirectData = nullptr;
+    void *surfaceStates = nullptr;
+    Event *signalEvent = nullptr;
+    std::vector<uint8_t> crossThreadData;
+    std::vector<Event *> waitEvents;
+    std::vector<CommandToPatchContainer> waitEventCommands;
+    std::array<uint32_t, 3> groupSize = {};
+    std::array<uint32_t, 3> groupCount = {};
+    uint32_t inlineDataSize = 0;
+    ze_mutable_command_exp_flags_t flags = 0;
+    bool signalEventPatchable = false;
+    bool groupCountPatchable = false;
+};
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+struct MutableCommandListCoreFamily : public CommandListCoreFamily<gfxCoreFamily> {
+    using BaseClass = CommandListCoreFamily<gfxCoreFamily>;
+    using GfxFamily = typename BaseClass::GfxFamily;
+    using WalkerType = typename GfxFamily::DefaultWalkerType;
+
+    using BaseClass::BaseClass;
+
+    void *asMutable() override { return this; }
+
+    ze_result_t appendLaunchKernel(ze_kernel_handle_t kernelHandle,
+                                   const ze_group_count_t &threadGroupDimensions,
+                                   ze_event_handle_t hEvent, uint32_t numWaitEvents,
+                                   ze_event_handle_t *phWaitEvents,
+                                   CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) override;
+    ze_result_t reset() override;
+
+    ze_result_t getNextCommandId(const ze_mutable_command_id_exp_desc_t *desc, uint32_t numKernels, ze_kernel_handle_t *phKernels, uint64_t *pCommandId) override;
+    ze_result_t updateMutableCommands(const ze_mutable_commands_exp_desc_t *desc) override;
+    ze_result_t updateMutableCommandSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) override;
+    ze_result_t updateMutableCommandWaitEvents(uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
+
+  protected:
+    MutableKernelDispatch *getMutableDispatch(uint64_t commandId, ze_mutable_command_exp_flags_t requiredFlag);
+    ze_result_t updateKernelArgument(MutableKernelDispatch &dispatch, uint32_t argIndex, size_t argSize, const void *argValue);
+    ze_result_t updateBufferArgument(MutableKernelDispatch &dispatch, const NEO::ArgDescPointer &arg, const void *argValue);
+    ze_result_t updateGroupCount(MutableKernelDispatch &dispatch, const ze_group_count_t &groupCount);
+    ze_result_t updateGlobalOffset(MutableKernelDispatch &dispatch, uint32_t offsetX, uint32_t offsetY, uint32_t offsetZ);
+    void encodeBufferSurfaceState(MutableKernelDispatch &dispatch, const NEO::ArgDescPointer &arg, uint64_t gpuAddress, NEO::GraphicsAllocation *allocation);
+    void patchPayload(MutableKernelDispatch &dispatch, NEO::CrossThreadDataOffset offset, size_t size);
+    void addToResidencyContainerOnce(NEO::GraphicsAllocation *allocation);
+
+    std::vector<std::unique_ptr<MutableKernelDispatch>> mutableDispatches;
+    ze_mutable_command_exp_flags_t nextCommandFlags = 0;
+    bool commandIdReserved = false;
+};
+
+} // namespace L0
@@ -0,0 +1,446 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/command_encoder.h"
+#include "shared/source/command_container/encode_surface_state.h"
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/cache_policy.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+
+#include "level_zero/core/source/cmdlist/mutable_cmdlist_hw.h"
+#include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/kernel/kernel.h"
+
+#include "encode_surface_state_args.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace L0 {
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t MutableCommandListCoreFamily<gfxCoreFamily>::getNextCommandId(const ze_mutable_command_id_exp_desc_t *desc, uint32_t numKernels,
+                                                                          ze_kernel_handle_t *phKernels, uint64_t *pCommandId) {
+    if (desc == nullptr || pCommandId == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if ((desc->flags & ~MutableCommandList::supportedUpdateFlags) != 0 || numKernels > 0) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    this->nextCommandFlags = desc->flags;
+    this->commandIdReserved = true;
+    *pCommandId = static_cast<uint64_t>(this->mutableDispatches.size() + 1);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t MutableCommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_handle_t kernelHandle,
+                                                                            const ze_group_count_t &threadGroupDimensions,
+                                                                            ze_event_handle_t hEvent, uint32_t numWaitEvents,
+                                                                            ze_event_handle_t *phWaitEvents,
+                                                                            CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
+    if (!this->commandIdReserved) {
+        return BaseClass::appendLaunchKernel(kernelHandle, threadGroupDimensions, hEvent, numWaitEvents, phWaitEvents, launchParams, relaxedOrderingDispatch);
+    }
+    this->commandIdReserved = false;
+
+    auto dispatch = std::make_unique<MutableKernelDispatch>();
+    dispatch->flags = this->nextCommandFlags;
+
+    // Each wait event gets its own semaphore list so it can be replaced independently
+    if ((dispatch->flags & ZE_MUTABLE_COMMAND_EXP_FLAG_WAIT_EVENTS) && numWaitEvents > 0 && !this->isInOrderExecutionEnabled()) {
+        if (phWaitEvents == nullptr) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        dispatch->waitEvents.resize(numWaitEvents);
+        dispatch->waitEventCommands.resize(numWaitEvents);
+        for (uint32_t i = 0; i < numWaitEvents; i++) {
+            auto ret = BaseClass::appendWaitOnEvents(1, &phWaitEvents[i], &dispatch->waitEventCommands[i], false, true, false,
+                                                     launchParams.omitAddingWaitEventsResidency, false, false);
+            if (ret != ZE_RESULT_SUCCESS) {
+                return ret;
+            }
+            dispatch->waitEvents[i] = Event::fromHandle(phWaitEvents[i]);
+        }
+        numWaitEvents = 0;
+        phWaitEvents = nullptr;
+    }
+
+    auto ret = BaseClass::appendLaunchKernel(kernelHandle, threadGroupDimensions, hEvent, numWaitEvents, phWaitEvents, launchParams, relaxedOrderingDispatch);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+
+    auto kernel = Kernel::fromHandle(kernelHandle);
+    const auto &kernelDescriptor = kernel->getKernelDescriptor();
+    auto crossThreadData = kernel->getCrossThreadData();
+    auto crossThreadDataSize = kernel->getCrossThreadDataSize();
+
+    dispatch->kernel = kernel;
+    dispatch->walker = launchParams.outWalker;
+    dispatch->indirectData = launchParams.outIndirectData;
+    dispatch->surfaceStates = launchParams.outSurfaceStates;
+    dispatch->crossThreadData.assign(crossThreadData, crossThreadData + crossThreadDataSize);
+    if (NEO::EncodeDispatchKernel<GfxFamily>::inlineDataProgrammingRequired(kernelDescriptor)) {
+        dispatch->inlineDataSize = std::min(WalkerType::getInlineDataSize(), crossThreadDataSize);
+    }
+    std::copy_n(kernel->getGroupSize(), 3, dispatch->groupSize.begin());
+    dispatch->groupCount = {threadGroupDimensions.groupCountX, threadGroupDimensions.groupCountY, threadGroupDimensions.groupCountZ};
+    dispatch->groupCountPatchable = this->partitionCount == 1 &&
+                                    kernel->getImplicitArgs() == nullptr &&
+                                    !kernel->usesSyncBuffer() &&
+                                    !kernel->usesRegionGroupBarrier();
+
+    if (hEvent != nullptr) {
+        auto event = Event::fromHandle(hEvent);
+        dispatch->signalEvent = event;
+        // Only events signaled by the walker post sync alone can be swapped by patching the walker
+        if (!event->isCounterBased() && !this->isInOrderExecutionEnabled() && !this->signalAllEventPackets &&
+            !this->getDcFlushRequired(event->isSignalScope())) {
+            auto walker = reinterpret_cast<WalkerType *>(dispatch->walker);
+            dispatch->signalEventPatchable = walker->getPostSync().getDestinationAddress() == event->getPacketAddress(this->device);
+        }
+    }
+
+    this->mutableDispatches.push_back(std::move(dispatch));
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t MutableCommandListCoreFamily<gfxCoreFamily>::reset() {
+    this->mutableDispatches.clear();
+    this->nextCommandFlags = 0;
+    this->commandIdReserved = false;
+    return BaseClass::reset();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+MutableKernelDispatch *MutableCommandListCoreFamily<gfxCoreFamily>::getMutableDispatch(uint64_t commandId, ze_mutable_command_exp_flags_t requiredFlag) {
+    if (commandId == 0 || commandId > this->mutableDispatches.size()) {
+        return nullptr;
+    }
+    auto dispatch = this->mutableDispatches[commandId - 1].get();
+    if ((dispatch->flags & requiredFlag) == 0) {
+        return nullptr;
+    }
+    return dispatch;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t MutableCommandListCoreFamily<gfxCoreFamily>::updateMutableCommands(const ze_mutable_commands_exp_desc_t *desc) {
+    if (desc == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    auto extendedDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
+    while (extendedDesc) {
+        ze_result_t ret = ZE_RESULT_SUCCESS;
+        if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC) {
+            auto argumentDesc = reinterpret_cast<const ze_mutable_kernel_argument_exp_desc_t *>(extendedDesc);
+            auto dispatch = getMutableDispatch(argumentDesc->commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS);
+            ret = dispatch ? updateKernelArgument(*dispatch, argumentDesc->argIndex, argumentDesc->argSize, argumentDesc->pArgValue)
+                           : ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC) {
+            auto groupCountDesc = reinterpret_cast<const ze_mutable_group_count_exp_desc_t *>(extendedDesc);
+            auto dispatch = getMutableDispatch(groupCountDesc->commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT);
+            if (dispatch == nullptr || groupCountDesc->pGroupCount == nullptr) {
+                ret = ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            } else {
+                ret = updateGroupCount(*dispatch, *groupCountDesc->pGroupCount);
+            }
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_GLOBAL_OFFSET_EXP_DESC) {
+            auto globalOffsetDesc = reinterpret_cast<const ze_mutable_global_offset_exp_desc_t *>(extendedDesc);
+            auto dispatch = getMutableDispatch(globalOffsetDesc->commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET);
+            ret = dispatch ? updateGlobalOffset(*dispatch, globalOffsetDesc->offsetX, globalOffsetDesc->offsetY, globalOffsetDesc->offsetZ)
+                           : ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MUTABLE_GROUP_SIZE_EXP_DESC) {
+            ret = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        } else {
+            ret = ZE_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+        extendedDesc = reinterpret_cast<const ze_base_desc_t *>(extendedDesc->pNext);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t MutableCommandListCoreFamily<gfxCoreFamily>::updateKernelArgument(MutableKernelDispatch &dispatch, uint32_t argIndex, size_t argSize, const void *argValue) {
+    const auto &explicitArgs = dispatch.kernel->getKernelDescriptor().payloadMappings.explicitArgs;
+    if (argIndex >= explicitArgs.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    const auto &arg = explicitArgs[argIndex];
+    if (arg.is<NEO::ArgDescriptor::argTValue>()) {
+        for (const auto &element : arg.as<NEO::ArgDescValue>().elements) {
+            if (element.sourceOffset >= argSize) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            size_t bytesToCopy = std::min(static_cast<size_t>(element.size), argSize - element.sourceOffset);
+            auto pDst = ptrOffset(dispatch.crossThreadData.data(), element.offset);
+            if (argValue) {
+                memcpy_s(pDst, element.size, ptrOffset(argValue, element.sourceOffset), bytesToCopy);
+            } else {
+                memset(pDst, 0, bytesToCopy);
+            }
+            patchPayload(dispatch, element.offset, element.size);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    if (arg.is<NEO::ArgDescriptor::argTPointer>() &&
+        arg.getTraits().getAddressQualifier() != NEO::KernelArgMetadata::AddrLocal) {
+        return updateBufferArgument(dispatch, arg.as<NEO::ArgDescPointer>(), argValue);
+    }
+
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t MutableCommandListCoreFamily<gfxCoreFamily>::updateBufferArgument(MutableKernelDispatch &dispatch, const NEO::ArgDescPointer &arg, const void *argValue) {
+    if (NEO::isValidOffset(arg.bindless) || (NEO::isValidOffset(arg.bindful) && dispatch.surfaceStates == nullptr)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    void *requestedAddress = argValue ? *reinterpret_cast<void *const *>(argValue) : nullptr;
+    uintptr_t gpuAddress = 0u;
+    NEO::GraphicsAllocation *allocation = nullptr;
+    if (requestedAddress != nullptr) {
+        auto driverHandle = static_cast<DriverHandleImp *>(this->device->getDriverHandle());
+        allocation = driverHandle->getDriverSystemMemoryAllocation(requestedAddress, 1u, this->device->getRootDeviceIndex(), &gpuAddress);
+        auto allocData = driverHandle->getSvmAllocsManager()->getSVMAlloc(requestedAddress);
+        if (allocation == nullptr || allocData == nullptr) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        if (driverHandle->isRemoteResourceNeeded(requestedAddress, allocation, allocData, this->device)) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+    }
+
+    auto payload = ArrayRef<uint8_t>(dispatch.crossThreadData.data(), dispatch.crossThreadData.size());
+    NEO::patchPointer(payload, arg, gpuAddress);
+    patchPayload(dispatch, arg.stateless, arg.pointerSize);
+
+    if (allocation == nullptr) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    if (NEO::isValidOffset(arg.bindful)) {
+        encodeBufferSurfaceState(dispatch, arg, gpuAddress, allocation);
+    }
+    addToResidencyContainerOnce(allocation);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void MutableCommandListCoreFamily<gfxCoreFamily>::encodeBufferSurfaceState(MutableKernelDispatch &dispatch, const NEO::ArgDescPointer &arg,
+                                                                           uint64_t gpuAddress, NEO::GraphicsAllocation *allocation) {
+    using RENDER_SURFACE_STATE = typename GfxFamily::RENDER_SURFACE_STATE;
+
+    uint64_t baseAddress = allocation->getGpuAddressToPatch() & NEO::EncodeSurfaceState<GfxFamily>::getSurfaceBaseAddressAlignmentMask();
+    auto misalignedSize = ptrDiff(allocation->getGpuAddressToPatch(), baseAddress);
+    auto offset = ptrDiff(gpuAddress, baseAddress);
+    size_t bufferSize = allocation->getUnderlyingBufferSize();
+
+    auto payload = ArrayRef<uint8_t>(dispatch.crossThreadData.data(), dispatch.crossThreadData.size());
+    if (NEO::patchNonPointer<uint32_t, uint32_t>(payload, arg.bufferOffset, static_cast<uint32_t>(offset))) {
+        patchPayload(dispatch, arg.bufferOffset, sizeof(uint32_t));
+    } else {
+        baseAddress = gpuAddress;
+        bufferSize -= offset;
+    }
+    bufferSize = alignUp(bufferSize + misalignedSize, NEO::EncodeSurfaceState<GfxFamily>::getSurfaceBaseAddressAlignment());
+
+    auto neoDevice = this->device->getNEODevice();
+    auto surfaceStateAddress = ptrOffset(dispatch.surfaceStates, arg.bindful);
+    auto surfaceState = *reinterpret_cast<RENDER_SURFACE_STATE *>(surfaceStateAddress);
+
+    NEO::EncodeSurfaceStateArgs args;
+    args.outMemory = &surfaceState;
+    args.graphicsAddress = baseAddress;
+    args.size = bufferSize;
+    args.mocs = this->device->getMOCS(NEO::isL3Capable(*allocation), false);
+    args.numAvailableDevices = neoDevice->getNumGenericSubDevices();
+    args.allocation = allocation;
+    args.gmmHelper = neoDevice->getGmmHelper();
+    args.areMultipleSubDevicesInContext = args.numAvailableDevices > 1;
+    args.implicitScaling = this->device->isImplicitScalingCapable();
+    args.isDebuggerActive = neoDevice->getDebugger() != nullptr;
+    NEO::EncodeSurfaceState<GfxFamily>::encodeBuffer(args);
+
+    *reinterpret_cast<RENDER_SURFACE_STATE *>(surfaceStateAddress) = surfaceState;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t MutableCommandListCoreFamily<gfxCoreFamily>::updateGroupCount(MutableKernelDispatch &dispatch, const ze_group_count_t &groupCount) {
+    if (!dispatch.groupCountPatchable) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto walker = reinterpret_cast<WalkerType *>(dispatch.walker);
+    walker->setThreadGroupIdXDimension(groupCount.groupCountX);
+    walker->setThreadGroupIdYDimension(groupCount.groupCountY);
+    walker->setThreadGroupIdZDimension(groupCount.groupCountZ);
+
+    const auto &dispatchTraits = dispatch.kernel->getKernelDescriptor().payloadMappings.dispatchTraits;
+    const auto &groupSize = dispatch.groupSize;
+    uint32_t numWorkGroups[3] = {groupCount.groupCountX, groupCount.groupCountY, groupCount.groupCountZ};
+    uint32_t globalWorkSize[3] = {numWorkGroups[0] * groupSize[0], numWorkGroups[1] * groupSize[1], numWorkGroups[2] * groupSize[2]};
+    uint32_t workDim = 1;
+    if (globalWorkSize[2] > 1) {
+        workDim = 3;
+    } else if (globalWorkSize[1] > 1) {
+        workDim = 2;
+    }
+
+    auto payload = ArrayRef<uint8_t>(dispatch.crossThreadData.data(), dispatch.crossThreadData.size());
+    NEO::patchVecNonPointer(payload, dispatchTraits.globalWorkSize, globalWorkSize);
+    NEO::patchVecNonPointer(payload, dispatchTraits.numWorkGroups, numWorkGroups);
+    NEO::patchNonPointer<uint32_t, uint32_t>(payload, dispatchTraits.workDim, workDim);
+    for (uint32_t i = 0; i < 3; i++) {
+        patchPayload(dispatch, dispatchTraits.globalWorkSize[i], sizeof(uint32_t));
+        patchPayload(dispatch, dispatchTraits.numWorkGroups[i], sizeof(uint32_t));
+    }
+    patchPayload(dispatch, dispatchTraits.workDim, sizeof(uint32_t));
+
+    dispatch.groupCount = {numWorkGroups[0], numWorkGroups[1], numWorkGroups[2]};
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t MutableCommandListCoreFamily<gfxCoreFamily>::updateGlobalOffset(MutableKernelDispatch &dispatch, uint32_t offsetX, uint32_t offsetY, uint32_t offsetZ) {
+    if (dispatch.kernel->getImplicitArgs() != nullptr) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    const auto &globalWorkOffset = dispatch.kernel->getKernelDescriptor().payloadMappings.dispatchTraits.globalWorkOffset;
+    uint32_t globalOffsets[3] = {offsetX, offsetY, offsetZ};
+    auto payload = ArrayRef<uint8_t>(dispatch.crossThreadData.data(), dispatch.crossThreadData.size());
+    NEO::patchVecNonPointer(payload, globalWorkOffset, globalOffsets);
+    for (uint32_t i = 0; i < 3; i++) {
+        patchPayload(dispatch, globalWorkOffset[i], sizeof(uint32_t));
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void MutableCommandListCoreFamily<gfxCoreFamily>::patchPayload(MutableKernelDispatch &dispatch, NEO::CrossThreadDataOffset offset, size_t size) {
+    if (NEO::isUndefinedOffset(offset)) {
+        return;
+    }
+
+    // First bytes of cross thread data are carried in walker inline data, remaining part lives in indirect heap
+    size_t begin = offset;
+    size_t end = std::min(begin + size, dispatch.crossThreadData.size());
+    size_t inlineDataSize = dispatch.inlineDataSize;
+    auto src = dispatch.crossThreadData.data();
+
+    if (begin < inlineDataSize) {
+        auto inlineEnd = std::min(end, inlineDataSize);
+        auto inlineData = reinterpret_cast<uint8_t *>(reinterpret_cast<WalkerType *>(dispatch.walker)->getInlineDataPointer());
+        memcpy_s(inlineData + begin, inlineDataSize - begin, src + begin, inlineEnd - begin);
+    }
+    if (end > inlineDataSize && dispatch.indirectData != nullptr) {
+        auto indirectBegin = std::max(begin, inlineDataSize);
+        memcpy_s(ptrOffset(dispatch.indirectData, indirectBegin - inlineDataSize), end - indirectBegin, src + indirectBegin, end - indirectBegin);
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void MutableCommandListCoreFamily<gfxCoreFamily>::addToResidencyContainerOnce(NEO::GraphicsAllocation *allocation) {
+    // Repeated updates usually swap between the same few allocations, do not grow residency container with each of them
+    auto &residencyContainer = this->commandContainer.getResidencyContainer();
+    if (std::find(residencyContainer.begin(), residencyContainer.end(), allocation) == residencyContainer.end()) {
+        this->commandContainer.addToResidencyContainer(allocation);
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t MutableCommandListCoreFamily<gfxCoreFamily>::updateMutableCommandSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) {
+    auto dispatch = getMutableDispatch(commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_SIGNAL_EVENT);
+    if (dispatch == nullptr || hSignalEvent == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (!dispatch->signalEventPatchable) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto event = Event::fromHandle(hSignalEvent);
+    if (event->isCounterBased() ||
+        event->isUsingContextEndOffset() != dispatch->signalEvent->isUsingContextEndOffset() ||
+        this->getDcFlushRequired(event->isSignalScope())) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto walker = reinterpret_cast<WalkerType *>(dispatch->walker);
+    walker->getPostSync().setDestinationAddress(event->getPacketAddress(this->device));
+
+    event->resetKernelCountAndPacketUsedCount();
+    event->setPacketsInUse(this->partitionCount);
+    addToResidencyContainerOnce(event->getAllocation(this->device));
+    this->addToMappedEventList(event);
+
+    dispatch->signalEvent = event;
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t MutableCommandListCoreFamily<gfxCoreFamily>::updateMutableCommandWaitEvents(uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    using MI_SEMAPHORE_WAIT = typename GfxFamily::MI_SEMAPHORE_WAIT;
+    using COMPARE_OPERATION = typename MI_SEMAPHORE_WAIT::COMPARE_OPERATION;
+
+    auto dispatch = getMutableDispatch(commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_WAIT_EVENTS);
+    if (dispatch == nullptr || numWaitEvents != dispatch->waitEvents.size() || (numWaitEvents > 0 && phWaitEvents == nullptr)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        auto &semaphores = dispatch->waitEventCommands[i];
+        auto event = Event::fromHandle(phWaitEvents[i]);
+        auto packetsToWait = event->getPacketsToWait();
+        bool semaphoresPatchable = std::all_of(semaphores.begin(), semaphores.end(), [](const auto &command) {
+            return command.type == CommandToPatch::WaitEventSemaphoreWait;
+        });
+        if (event->isCounterBased() || !semaphoresPatchable || packetsToWait == 0 || packetsToWait > semaphores.size()) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        auto &semaphores = dispatch->waitEventCommands[i];
+        auto event = Event::fromHandle(phWaitEvents[i]);
+        auto completionAddress = event->getCompletionFieldGpuAddress(this->device);
+        auto lastPacket = event->getPacketsToWait() - 1;
+
+        // Semaphores beyond the packet count of the new event wait again on its last packet
+        for (size_t semaphoreId = 0; semaphoreId < semaphores.size(); semaphoreId++) {
+            auto packetId = std::min(static_cast<uint32_t>(semaphoreId), lastPacket);
+            NEO::EncodeSemaphore<GfxFamily>::programMiSemaphoreWait(reinterpret_cast<MI_SEMAPHORE_WAIT *>(semaphores[semaphoreId].pDestination),
+                                                                    completionAddress + packetId * event->getSinglePacketSize(),
+                                                                    Event::STATE_CLEARED,
+                                                                    COMPARE_OPERATION::COMPARE_OPERATION_SAD_NOT_EQUAL_SDD,
+                                                                    false, true, false, false, false);
+        }
+
+        event->disableImplicitCounterBasedMode();
+        addToResidencyContainerOnce(event->getAllocation(this->device));
+        dispatch->waitEvents[i] = event;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+} // namespace L0
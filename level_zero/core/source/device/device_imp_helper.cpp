@@ -1,16 +1,20 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/core/source/cmdlist/mutable_cmdlist.h"
 #include "level_zero/core/source/device/device_imp.h"
 
 namespace L0 {
 
 DeviceImp::CmdListCreateFunPtrT DeviceImp::getCmdListCreateFunc(const ze_base_desc_t *desc) {
+    if (desc->stype == ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_EXP_DESC) {
+        return &MutableCommandList::create;
+    }
     return nullptr;
 }
 
@@ -21,7 +25,13 @@ uint32_t DeviceImp::getAdditionalEngines(uint32_t numAdditionalEnginesRequested,
 
 void DeviceImp::getExtendedDeviceModuleProperties(ze_base_desc_t *pExtendedProperties) {}
 
-void DeviceImp::getAdditionalExtProperties(ze_base_properties_t *extendedProperties) {}
+void DeviceImp::getAdditionalExtProperties(ze_base_properties_t *extendedProperties) {
+    if (extendedProperties->stype == ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_EXP_PROPERTIES) {
+        auto mutableCommandListProperties = reinterpret_cast<ze_mutable_command_list_exp_properties_t *>(extendedProperties);
+        mutableCommandListProperties->mutableCommandListFlags = 0;
+        mutableCommandListProperties->mutableCommandFlags = MutableCommandList::getUpdateCapabilities(neoDevice->getRootDeviceEnvironment());
+    }
+}
 
 void DeviceImp::getAdditionalMemoryExtProperties(ze_base_properties_t *extProperties, const NEO::HardwareInfo &hwInfo) {}
 
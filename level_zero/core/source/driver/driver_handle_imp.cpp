@@ -26,6 +26,7 @@
 #include "shared/source/utilities/logger.h"
 
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
+#include "level_zero/core/source/cmdlist/mutable_cmdlist.h"
 #include "level_zero/core/source/context/context_imp.h"
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_imp.h"
@@ -164,6 +165,10 @@ ze_result_t DriverHandleImp::getExtensionProperties(uint32_t *pCount,
         additionalExtensions.emplace_back(ZEX_INTEL_QUEUE_COPY_OPERATIONS_OFFLOAD_HINT_EXP_NAME, ZEX_INTEL_QUEUE_COPY_OPERATIONS_OFFLOAD_HINT_EXP_VERSION_CURRENT);
     }
 
+    if (MutableCommandList::getUpdateCapabilities(devices[0]->getNEODevice()->getRootDeviceEnvironment()) != 0) {
+        additionalExtensions.emplace_back(ZE_MUTABLE_COMMAND_LIST_EXP_NAME, ZE_MUTABLE_COMMAND_LIST_EXP_VERSION_CURRENT);
+    }
+
     auto extensionCount = static_cast<uint32_t>(this->extensionsSupported.size() + additionalExtensions.size());
 
     if (nullptr == pExtensionProperties) {
@@ -42,6 +42,7 @@ void *ExtensionFunctionAddressHelper::getExtensionFunctionAddress(const std::str
 
     RETURN_FUNC_PTR_IF_EXIST(zexCounterBasedEventCreate);
     RETURN_FUNC_PTR_IF_EXIST(zexEventGetDeviceAddress);
+    RETURN_FUNC_PTR_IF_EXIST(zexEventHostSynchronizeMultiple);
 
     RETURN_FUNC_PTR_IF_EXIST(zexCounterBasedEventCreate2);
     RETURN_FUNC_PTR_IF_EXIST(zexCounterBasedEventGetIpcHandle);
@@ -599,6 +599,83 @@ void *Event::getCompletionFieldHostAddress() const {
     return ptrOffset(getHostAddress(), getCompletionFieldOffset());
 }
 
+const volatile void *Event::getCompletionMonitorAddress() const {
+    if (isCounterBased() || inOrderExecInfo) {
+        return inOrderExecInfo ? ptrOffset(inOrderExecInfo->getBaseHostAddress(), inOrderAllocationOffset) : nullptr;
+    }
+    return getHostAddress() ? getCompletionFieldHostAddress() : nullptr;
+}
+
+ze_result_t Event::hostSynchronizeMultiple(uint32_t numEvents, Event *const *events, uint64_t timeout, bool waitAll, uint32_t *signaledEventIndex) {
+    if (NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get() != -1) {
+        timeout = NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get();
+    }
+
+    StackVec<uint32_t, 16> pendingEvents;
+    for (uint32_t i = 0; i < numEvents; i++) {
+        pendingEvents.push_back(i);
+    }
+
+    const auto waitStartTime = std::chrono::high_resolution_clock::now();
+    auto lastHangCheckTime = waitStartTime;
+
+    while (true) {
+        const volatile void *monitorAddress = nullptr;
+        for (auto it = pendingEvents.begin(); it != pendingEvents.end();) {
+            auto event = events[*it];
+            bool ready = event->csrs[0]->getType() == NEO::CommandStreamReceiverType::aub || event->queryStatusNoWait() == ZE_RESULT_SUCCESS;
+            if (ready) {
+                // completed event goes through regular path, which handles printf, asserts and L3 flush
+                auto ret = event->hostSynchronize(timeout);
+                if (ret != ZE_RESULT_SUCCESS && ret != ZE_RESULT_NOT_READY) {
+                    return ret;
+                }
+                ready = (ret == ZE_RESULT_SUCCESS);
+            }
+            if (ready) {
+                if (!waitAll) {
+                    if (signaledEventIndex) {
+                        *signaledEventIndex = *it;
+                    }
+                    return ZE_RESULT_SUCCESS;
+                }
+                it = pendingEvents.erase(it);
+                continue;
+            }
+            if (monitorAddress == nullptr) {
+                monitorAddress = event->getCompletionMonitorAddress();
+            }
+            ++it;
+        }
+
+        if (pendingEvents.empty()) {
+            return ZE_RESULT_SUCCESS;
+        }
+
+        auto currentTime = std::chrono::high_resolution_clock::now();
+        auto firstPendingEvent = events[pendingEvents[0]];
+        if (std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastHangCheckTime) >= firstPendingEvent->gpuHangCheckPeriod) {
+            lastHangCheckTime = currentTime;
+            for (auto eventIndex : pendingEvents) {
+                if (events[eventIndex]->csrs[0]->isGpuHangDetected()) {
+                    return ZE_RESULT_ERROR_DEVICE_LOST;
+                }
+            }
+        }
+
+        if (timeout == 0) {
+            return ZE_RESULT_NOT_READY;
+        }
+        if (timeout != std::numeric_limits<uint64_t>::max() &&
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count()) >= timeout) {
+            return ZE_RESULT_NOT_READY;
+        }
+
+        // all pending events are checked again after CPU wakes up, so watching a single one is enough
+        NEO::WaitUtils::waitFunctionForMultiple(monitorAddress);
+    }
+}
+
 void Event::increaseKernelCount() {
     kernelCount++;
     UNRECOVERABLE_IF(kernelCount > maxKernelCount);
@@ -108,6 +108,8 @@ struct Event : _ze_event_handle_t {
     virtual ze_result_t hostSignal(bool allowCounterBased) = 0;
     virtual ze_result_t hostSynchronize(uint64_t timeout) = 0;
     virtual ze_result_t queryStatus() = 0;
+    // Same as queryStatus, but returns immediately when event is not ready, without pausing CPU
+    virtual ze_result_t queryStatusNoWait() { return queryStatus(); }
     virtual ze_result_t reset() = 0;
     virtual ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) = 0;
     virtual ze_result_t queryTimestampsExp(Device *device, uint32_t *count, ze_kernel_timestamp_result_t *timestamps) = 0;
@@ -143,6 +145,8 @@ struct Event : _ze_event_handle_t {
 
     static Event *fromHandle(ze_event_handle_t handle) { return static_cast<Event *>(handle); }
 
+    static ze_result_t hostSynchronizeMultiple(uint32_t numEvents, Event *const *events, uint64_t timeout, bool waitAll, uint32_t *signaledEventIndex);
+
     static ze_result_t openCounterBasedIpcHandle(const IpcCounterBasedEventData &ipcData, ze_event_handle_t *eventHandle,
                                                  DriverHandleImp *driver, ContextImp *context, uint32_t numDevices, ze_device_handle_t *deviceHandles);
 
@@ -173,6 +177,7 @@ struct Event : _ze_event_handle_t {
         return this->getGpuAddress(device) + getCompletionFieldOffset();
     }
     void *getCompletionFieldHostAddress() const;
+    const volatile void *getCompletionMonitorAddress() const;
     size_t getContextStartOffset() const {
         return contextStartOffset;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,7 @@ struct EventImp : public Event {
     ze_result_t hostSynchronize(uint64_t timeout) override;
 
     ze_result_t queryStatus() override;
+    ze_result_t queryStatusNoWait() override;
 
     ze_result_t reset() override;
 
@@ -68,8 +69,9 @@ struct EventImp : public Event {
     TaskCountType getTaskCount(const NEO::CommandStreamReceiver &csr) const;
 
     ze_result_t calculateProfilingData();
-    ze_result_t queryStatusEventPackets();
-    ze_result_t queryCounterBasedEventStatus();
+    ze_result_t queryStatusImpl(bool waitIfNotReady);
+    ze_result_t queryStatusEventPackets(bool waitIfNotReady);
+    ze_result_t queryCounterBasedEventStatus(bool waitIfNotReady);
     void handleSuccessfulHostSynchronization();
     MOCKABLE_VIRTUAL ze_result_t hostEventSetValueTimestamps(State eventState);
     MOCKABLE_VIRTUAL void assignKernelEventCompletionData(void *address);
@@ -224,7 +224,7 @@ void EventImp<TagSizeT>::assignKernelEventCompletionData(void *address) {
 }
 
 template <typename TagSizeT>
-ze_result_t EventImp<TagSizeT>::queryCounterBasedEventStatus() {
+ze_result_t EventImp<TagSizeT>::queryCounterBasedEventStatus(bool waitIfNotReady) {
     if (!this->inOrderExecInfo.get()) {
         return ZE_RESULT_SUCCESS;
     }
@@ -235,7 +235,9 @@ ze_result_t EventImp<TagSizeT>::queryCounterBasedEventStatus() {
         bool signaled = true;
         const uint64_t *hostAddress = ptrOffset(inOrderExecInfo->getBaseHostAddress(), this->inOrderAllocationOffset);
         for (uint32_t i = 0; i < inOrderExecInfo->getNumHostPartitionsToWait(); i++) {
-            if (!NEO::WaitUtils::waitFunctionWithPredicate<const uint64_t>(hostAddress, waitValue, std::greater_equal<uint64_t>())) {
+            bool partitionSignaled = waitIfNotReady ? NEO::WaitUtils::waitFunctionWithPredicate<const uint64_t>(hostAddress, waitValue, std::greater_equal<uint64_t>())
+                                                    : (*static_cast<const volatile uint64_t *>(hostAddress) >= waitValue);
+            if (!partitionSignaled) {
                 signaled = false;
                 break;
             }
@@ -316,9 +318,18 @@ void EventImp<TagSizeT>::handleSuccessfulHostSynchronization() {
 }
 
 template <typename TagSizeT>
-ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
+ze_result_t EventImp<TagSizeT>::queryStatusEventPackets(bool waitIfNotReady) {
     assignKernelEventCompletionData(getHostAddress());
     uint32_t queryVal = Event::STATE_CLEARED;
+    auto isPacketSignaled = [&](void const *queryAddress) {
+        if (waitIfNotReady) {
+            return NEO::WaitUtils::waitFunctionWithPredicate<const TagSizeT>(
+                static_cast<TagSizeT const *>(queryAddress),
+                queryVal,
+                std::not_equal_to<TagSizeT>());
+        }
+        return *static_cast<const volatile TagSizeT *>(queryAddress) != queryVal;
+    };
     uint32_t packets = 0;
     for (uint32_t i = 0; i < this->kernelCount; i++) {
         uint32_t packetsToCheck = kernelEventCompletionData[i].getPacketsUsed();
@@ -326,11 +337,7 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
             void const *queryAddress = isUsingContextEndOffset()
                                            ? kernelEventCompletionData[i].getContextEndAddress(packetId)
                                            : kernelEventCompletionData[i].getContextStartAddress(packetId);
-            bool ready = NEO::WaitUtils::waitFunctionWithPredicate<const TagSizeT>(
-                static_cast<TagSizeT const *>(queryAddress),
-                queryVal,
-                std::not_equal_to<TagSizeT>());
-            if (!ready) {
+            if (!isPacketSignaled(queryAddress)) {
                 return ZE_RESULT_NOT_READY;
             }
         }
@@ -342,11 +349,7 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
             remainingPacketSyncAddress = ptrOffset(remainingPacketSyncAddress, this->getCompletionFieldOffset());
             for (uint32_t i = 0; i < remainingPackets; i++) {
                 void const *queryAddress = remainingPacketSyncAddress;
-                bool ready = NEO::WaitUtils::waitFunctionWithPredicate<const TagSizeT>(
-                    static_cast<TagSizeT const *>(queryAddress),
-                    queryVal,
-                    std::not_equal_to<TagSizeT>());
-                if (!ready) {
+                if (!isPacketSignaled(queryAddress)) {
                     return ZE_RESULT_NOT_READY;
                 }
                 remainingPacketSyncAddress = ptrOffset(remainingPacketSyncAddress, this->singlePacketSize);
@@ -436,14 +439,24 @@ bool EventImp<TagSizeT>::handlePreQueryStatusOperationsAndCheckCompletion() {
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::queryStatus() {
+    return queryStatusImpl(true);
+}
+
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::queryStatusNoWait() {
+    return queryStatusImpl(false);
+}
+
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::queryStatusImpl(bool waitIfNotReady) {
     if (handlePreQueryStatusOperationsAndCheckCompletion()) {
         return ZE_RESULT_SUCCESS;
     }
 
     if (isCounterBased() || this->inOrderExecInfo.get()) {
-        return queryCounterBasedEventStatus();
+        return queryCounterBasedEventStatus(waitIfNotReady);
     } else {
-        return queryStatusEventPackets();
+        return queryStatusEventPackets(waitIfNotReady);
     }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -87,6 +87,11 @@ struct KernelImmutableData {
     MOCKABLE_VIRTUAL void createRelocatedDebugData(NEO::GraphicsAllocation *globalConstBuffer,
                                                    NEO::GraphicsAllocation *globalVarBuffer);
 
+    static void setGlobalSurfaceStateInBindlessHeap(NEO::GraphicsAllocation *globalBuffer, Device *device);
+    void setGlobalSurfaceStatesInBindlessHeapPreset(bool preset) {
+        globalSurfaceStatesInBindlessHeapPreset = preset;
+    }
+
   protected:
     Device *device = nullptr;
     NEO::KernelInfo *kernelInfo = nullptr;
@@ -108,6 +113,7 @@ struct KernelImmutableData {
     std::vector<NEO::GraphicsAllocation *> residencyContainer;
 
     bool isaCopiedToAllocation = false;
+    bool globalSurfaceStatesInBindlessHeapPreset = false;
 };
 
 struct Kernel : _ze_kernel_handle_t, virtual NEO::DispatchKernelEncoderI {
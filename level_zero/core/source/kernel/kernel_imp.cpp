@@ -27,6 +27,7 @@
 #include "shared/source/helpers/simd_helper.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/surface_format_info.h"
+#include "shared/source/helpers/work_group_size_autotuner.h"
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/kernel/kernel_arg_descriptor.h"
 #include "shared/source/kernel/kernel_descriptor.h"
@@ -149,7 +150,8 @@ ze_result_t KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device
 
         patchImplicitArgBindlessOffsetAndSetSurfaceState(crossThreadDataArrayRef, surfaceStateHeapArrayRef,
                                                          globalConstBuffer, kernelDescriptor->payloadMappings.implicitArgs.globalConstantsSurfaceAddress,
-                                                         *neoDevice, deviceImp->isImplicitScalingCapable(), ssInHeap, kernelInfo->kernelDescriptor);
+                                                         *neoDevice, deviceImp->isImplicitScalingCapable(), ssInHeap, kernelInfo->kernelDescriptor,
+                                                         !globalSurfaceStatesInBindlessHeapPreset);
     }
 
     if (NEO::isValidOffset(kernelDescriptor->payloadMappings.implicitArgs.globalVariablesSurfaceAddress.stateless)) {
@@ -172,12 +174,23 @@ ze_result_t KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device
 
         patchImplicitArgBindlessOffsetAndSetSurfaceState(crossThreadDataArrayRef, surfaceStateHeapArrayRef,
                                                          globalVarBuffer, kernelDescriptor->payloadMappings.implicitArgs.globalVariablesSurfaceAddress,
-                                                         *neoDevice, deviceImp->isImplicitScalingCapable(), ssInHeap, kernelInfo->kernelDescriptor);
+                                                         *neoDevice, deviceImp->isImplicitScalingCapable(), ssInHeap, kernelInfo->kernelDescriptor,
+                                                         !globalSurfaceStatesInBindlessHeapPreset);
     }
 
     return ZE_RESULT_SUCCESS;
 }
 
+void KernelImmutableData::setGlobalSurfaceStateInBindlessHeap(NEO::GraphicsAllocation *globalBuffer, Device *device) {
+    DeviceImp *deviceImp = static_cast<DeviceImp *>(device);
+    auto neoDevice = deviceImp->getActiveDevice();
+    auto &ssInHeap = globalBuffer->getBindlessInfo();
+    if (neoDevice->getBindlessHeapsHelper() == nullptr || ssInHeap.ssPtr == nullptr) {
+        return;
+    }
+    setImplicitArgSurfaceStateInBindlessHeap(globalBuffer, *neoDevice, deviceImp->isImplicitScalingCapable(), ssInHeap);
+}
+
 void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *globalConstBuffer,
                                                    NEO::GraphicsAllocation *globalVarBuffer) {
     NEO::Linker::SegmentInfo globalData;
@@ -495,6 +508,18 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
             NEO::computeWorkgroupSize2D(maxWorkGroupSize, retGroupSize, workItems, simd);
         }
     }
+
+    auto workGroupSizeAutotuner = module->getDevice()->getNEODevice()->getRootDeviceEnvironmentRef().getWorkGroupSizeAutotuner();
+    if (workGroupSizeAutotuner != nullptr) {
+        Vec3<size_t> globalSize(workItems);
+        Vec3<size_t> tunedGroupSize(retGroupSize);
+        auto key = NEO::WorkGroupSizeAutotuner::createKey(this->workGroupSizeAutotunerKernelHash, globalSize, dim, this->getSlmTotalSize());
+        if (workGroupSizeAutotuner->getTunedWorkGroupSize(key, globalSize, maxWorkGroupSize, tunedGroupSize)) {
+            retGroupSize[0] = tunedGroupSize.x;
+            retGroupSize[1] = tunedGroupSize.y;
+            retGroupSize[2] = tunedGroupSize.z;
+        }
+    }
     *groupSizeX = static_cast<uint32_t>(retGroupSize[0]);
     *groupSizeY = static_cast<uint32_t>(retGroupSize[1]);
     *groupSizeZ = static_cast<uint32_t>(retGroupSize[2]);
@@ -1044,6 +1069,11 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
     }
     UNRECOVERABLE_IF(!this->kernelImmData->getKernelInfo()->heapInfo.pKernelHeap);
 
+    if (neoDevice->getRootDeviceEnvironmentRef().getWorkGroupSizeAutotuner() != nullptr) {
+        const auto &heapInfo = this->kernelImmData->getKernelInfo()->heapInfo;
+        this->workGroupSizeAutotunerKernelHash = NEO::WorkGroupSizeAutotuner::getKernelHash(kernelDescriptor.kernelMetadata.kernelName, heapInfo.pKernelHeap, heapInfo.kernelHeapSize);
+    }
+
     const auto &hwInfo = neoDevice->getHardwareInfo();
     auto deviceBitfield = neoDevice->getDeviceBitfield();
     const auto &gfxHelper = rootDeviceEnvironment.getHelper<NEO::GfxCoreHelper>();
@@ -286,6 +286,7 @@ struct KernelImp : Kernel {
     UnifiedMemoryControls unifiedMemoryControls;
     std::vector<uint32_t> slmArgSizes;
     std::vector<uint32_t> slmArgOffsetValues;
+    uint64_t workGroupSizeAutotunerKernelHash = 0u;
     uint32_t slmArgsTotalSize = 0U;
     uint32_t requiredWorkgroupOrder = 0u;
 
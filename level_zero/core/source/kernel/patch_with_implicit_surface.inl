@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,63 +36,68 @@ inline void patchWithImplicitSurface(ArrayRef<uint8_t> crossThreadData, ArrayRef
     }
 }
 
+inline void encodeImplicitArgSurfaceState(void *outMemory, NEO::GraphicsAllocation *allocation, const NEO::Device &device, bool implicitScaling) {
+    auto &gfxCoreHelper = device.getGfxCoreHelper();
+    auto addressToPatch = allocation->getGpuAddress();
+    size_t sizeToPatch = allocation->getUnderlyingBufferSize();
+    auto isDebuggerActive = device.getDebugger() != nullptr;
+
+    NEO::EncodeSurfaceStateArgs args;
+    args.outMemory = outMemory;
+    args.graphicsAddress = addressToPatch;
+    args.size = sizeToPatch;
+    args.mocs = gfxCoreHelper.getMocsIndex(*device.getGmmHelper(), true, false) << 1;
+    args.numAvailableDevices = device.getNumGenericSubDevices();
+    args.allocation = allocation;
+    args.gmmHelper = device.getGmmHelper();
+    args.areMultipleSubDevicesInContext = args.numAvailableDevices > 1;
+    args.implicitScaling = implicitScaling;
+    args.isDebuggerActive = isDebuggerActive;
+
+    gfxCoreHelper.encodeBufferSurfaceState(args);
+}
+
+inline void setImplicitArgSurfaceStateInBindlessHeap(NEO::GraphicsAllocation *allocation, const NEO::Device &device, bool implicitScaling,
+                                                     const NEO::SurfaceStateInHeapInfo &ssInHeap) {
+    auto surfaceStateSize = device.getGfxCoreHelper().getRenderSurfaceStateSize();
+    auto surfaceState = std::make_unique<uint64_t[]>(surfaceStateSize / sizeof(uint64_t));
+
+    encodeImplicitArgSurfaceState(surfaceState.get(), allocation, device, implicitScaling);
+
+    memcpy_s(ssInHeap.ssPtr, surfaceStateSize,
+             surfaceState.get(), surfaceStateSize);
+}
+
 inline void patchImplicitArgBindlessOffsetAndSetSurfaceState(ArrayRef<uint8_t> crossThreadData, ArrayRef<uint8_t> surfaceStateHeap, NEO::GraphicsAllocation *allocation,
                                                              const NEO::ArgDescPointer &ptr, const NEO::Device &device, bool implicitScaling,
-                                                             const NEO::SurfaceStateInHeapInfo &ssInHeap, const NEO::KernelDescriptor &kernelDescriptor) {
+                                                             const NEO::SurfaceStateInHeapInfo &ssInHeap, const NEO::KernelDescriptor &kernelDescriptor,
+                                                             bool setSurfaceStateInBindlessHeap = true) {
     auto &gfxCoreHelper = device.getGfxCoreHelper();
-    void *surfaceStateAddress = nullptr;
     auto surfaceStateSize = gfxCoreHelper.getRenderSurfaceStateSize();
-    bool useTempBuffer = false;
-
-    if (NEO::isValidOffset(ptr.bindless)) {
-        if (device.getBindlessHeapsHelper()) {
-            surfaceStateAddress = ssInHeap.ssPtr;
-
-            auto patchLocation = ptrOffset(crossThreadData.begin(), ptr.bindless);
-            auto patchValue = gfxCoreHelper.getBindlessSurfaceExtendedMessageDescriptorValue(static_cast<uint32_t>(ssInHeap.surfaceStateOffset));
-            patchWithRequiredSize(const_cast<uint8_t *>(patchLocation), sizeof(patchValue), patchValue);
-            useTempBuffer = true;
-        } else {
-            auto index = std::numeric_limits<uint32_t>::max();
-            const auto &iter = kernelDescriptor.getBindlessOffsetToSurfaceState().find(ptr.bindless);
-            if (iter != kernelDescriptor.getBindlessOffsetToSurfaceState().end()) {
-                index = iter->second;
-            }
-
-            if (index < std::numeric_limits<uint32_t>::max()) {
-                surfaceStateAddress = ptrOffset(surfaceStateHeap.begin(), index * surfaceStateSize);
-            }
-        }
+
+    if (false == NEO::isValidOffset(ptr.bindless)) {
+        return;
     }
 
-    if (surfaceStateAddress) {
-        std::unique_ptr<uint64_t[]> surfaceState;
+    if (device.getBindlessHeapsHelper()) {
+        auto patchLocation = ptrOffset(crossThreadData.begin(), ptr.bindless);
+        auto patchValue = gfxCoreHelper.getBindlessSurfaceExtendedMessageDescriptorValue(static_cast<uint32_t>(ssInHeap.surfaceStateOffset));
+        patchWithRequiredSize(const_cast<uint8_t *>(patchLocation), sizeof(patchValue), patchValue);
 
-        if (useTempBuffer) {
-            surfaceState = std::make_unique<uint64_t[]>(surfaceStateSize / sizeof(uint64_t));
+        // surface state in bindless heap is shared by all kernels using the allocation
+        if (setSurfaceStateInBindlessHeap && ssInHeap.ssPtr) {
+            setImplicitArgSurfaceStateInBindlessHeap(allocation, device, implicitScaling, ssInHeap);
         }
+        return;
+    }
 
-        auto addressToPatch = allocation->getGpuAddress();
-        size_t sizeToPatch = allocation->getUnderlyingBufferSize();
-        auto isDebuggerActive = device.getDebugger() != nullptr;
-
-        NEO::EncodeSurfaceStateArgs args;
-        args.outMemory = useTempBuffer ? surfaceState.get() : surfaceStateAddress;
-        args.graphicsAddress = addressToPatch;
-        args.size = sizeToPatch;
-        args.mocs = gfxCoreHelper.getMocsIndex(*device.getGmmHelper(), true, false) << 1;
-        args.numAvailableDevices = device.getNumGenericSubDevices();
-        args.allocation = allocation;
-        args.gmmHelper = device.getGmmHelper();
-        args.areMultipleSubDevicesInContext = args.numAvailableDevices > 1;
-        args.implicitScaling = implicitScaling;
-        args.isDebuggerActive = isDebuggerActive;
-
-        gfxCoreHelper.encodeBufferSurfaceState(args);
+    auto index = std::numeric_limits<uint32_t>::max();
+    const auto &iter = kernelDescriptor.getBindlessOffsetToSurfaceState().find(ptr.bindless);
+    if (iter != kernelDescriptor.getBindlessOffsetToSurfaceState().end()) {
+        index = iter->second;
+    }
 
-        if (useTempBuffer) {
-            memcpy_s(surfaceStateAddress, surfaceStateSize,
-                     surfaceState.get(), surfaceStateSize);
-        }
+    if (index < std::numeric_limits<uint32_t>::max()) {
+        encodeImplicitArgSurfaceState(ptrOffset(surfaceStateHeap.begin(), index * surfaceStateSize), allocation, device, implicitScaling);
     }
 }
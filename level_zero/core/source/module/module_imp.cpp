@@ -14,6 +14,7 @@
 #include "shared/source/compiler_interface/external_functions.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/compiler_interface/linker.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
@@ -41,6 +42,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_initialization.h"
+#include "shared/source/utilities/worker_thread_pool.h"
 
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
@@ -53,6 +55,8 @@
 #include "program_debug_data.h"
 
 #include <algorithm>
+#include <chrono>
+#include <functional>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -368,6 +372,10 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
     NEO::SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
     binary.targetDevice = NEO::getTargetDevice(device->getNEODevice()->getRootDeviceEnvironment());
+    binary.decodedProgramCache = device->getNEODevice()->getRootDeviceEnvironment().getDecodedProgramCache();
+    if (auto workers = device->getNEODevice()->getExecutionEnvironment()->initializeModuleBuildWorkers(); workers != nullptr) {
+        binary.runForEachKernel = [workers](size_t itemsCount, const std::function<void(size_t)> &work) { workers->runForEachItem(itemsCount, work); };
+    }
     std::string decodeErrors;
     std::string decodeWarnings;
 
@@ -423,10 +431,7 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
                                                             programInfo.globalVariables.zeroInitSize, false, programInfo.linkerInput.get(), programInfo.globalVariables.initData);
     }
 
-    for (auto &kernelInfo : this->programInfo.kernelInfos) {
-        deviceInfoConstants.maxWorkGroupSize = gfxCoreHelper.calculateMaxWorkGroupSize(kernelInfo->kernelDescriptor, static_cast<uint32_t>(device->getDeviceInfo().maxWorkGroupSize));
-        kernelInfo->apply(deviceInfoConstants);
-    }
+    this->deviceInfoConstants = deviceInfoConstants;
 
     if (this->packedDeviceBinary != nullptr) {
         return ZE_RESULT_SUCCESS;
@@ -540,8 +545,20 @@ NEO::Zebin::Debug::Segments ModuleImp::getZebinSegments() {
 
 ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
     bool linkageSuccessful = true;
+    const bool printStageTimes = NEO::debugManager.flags.PrintModuleBuildStageTimes.get();
+    auto stageStart = std::chrono::steady_clock::now();
+    auto finishStage = [&](const char *stageName) {
+        if (printStageTimes) {
+            auto stageEnd = std::chrono::steady_clock::now();
+            auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(stageEnd - stageStart).count();
+            NEO::printDebugString(true, stdout, "Module build stage %s: %lld us\n", stageName, static_cast<long long>(elapsedUs));
+            stageStart = stageEnd;
+        }
+    };
+
     ze_result_t result = this->initializeTranslationUnit(desc, neoDevice);
     this->updateBuildLog(neoDevice);
+    finishStage("translation");
     if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
@@ -549,7 +566,9 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
     if (this->shouldBuildBeFailed(neoDevice)) {
         return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
     }
-    if (result = this->initializeKernelImmutableDatas(); result != ZE_RESULT_SUCCESS) {
+    result = this->initializeKernelImmutableDatas();
+    finishStage("kernel immutable data");
+    if (result != ZE_RESULT_SUCCESS) {
         return result;
     }
 
@@ -572,6 +591,7 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
 
     linkageSuccessful &= populateHostGlobalSymbolsMap(this->translationUnit->programInfo.globalsDeviceToHostNameMap);
     this->updateBuildLog(neoDevice);
+    finishStage("linking");
 
     if ((this->isFullyLinked && this->type == ModuleType::user) || (this->sharedIsaAllocation && this->type == ModuleType::builtin)) {
         this->transferIsaSegmentsToAllocation(neoDevice, nullptr);
@@ -581,6 +601,7 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
             device->getL0Debugger()->notifyModuleLoadAllocations(device->getNEODevice(), allocs);
             notifyModuleCreate();
         }
+        finishStage("isa transfer");
     }
     if (linkageSuccessful == false) {
         result = ZE_RESULT_ERROR_MODULE_LINK_FAILURE;
@@ -773,13 +794,13 @@ ze_result_t ModuleImp::initializeKernelImmutableDatas() {
         if (result = this->allocateKernelImmutableDatas(kernelsCount); result != ZE_RESULT_SUCCESS) {
             return result;
         }
+
+        if (auto workers = this->getKernelImmutableDatasInitializationWorkers(kernelsCount); workers != nullptr) {
+            return this->initializeKernelImmutableDatasInParallel(*workers);
+        }
+
         for (size_t i = 0lu; i < kernelsCount; i++) {
-            result = kernelImmDatas[i]->initialize(this->translationUnit->programInfo.kernelInfos[i],
-                                                   device,
-                                                   device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
-                                                   this->translationUnit->globalConstBuffer,
-                                                   this->translationUnit->globalVarBuffer,
-                                                   this->type == ModuleType::builtin);
+            result = this->initializeKernelImmutableData(i);
             if (result != ZE_RESULT_SUCCESS) {
                 kernelImmDatas[i].reset();
                 return result;
@@ -789,6 +810,74 @@ ze_result_t ModuleImp::initializeKernelImmutableDatas() {
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t ModuleImp::initializeKernelImmutableData(size_t kernelId) {
+    auto kernelInfo = this->translationUnit->programInfo.kernelInfos[kernelId];
+    if (auto &deviceInfoConstants = this->translationUnit->deviceInfoConstants; deviceInfoConstants.has_value()) {
+        auto kernelDeviceInfoConstants = *deviceInfoConstants;
+        kernelDeviceInfoConstants.maxWorkGroupSize = device->getGfxCoreHelper().calculateMaxWorkGroupSize(kernelInfo->kernelDescriptor, static_cast<uint32_t>(device->getDeviceInfo().maxWorkGroupSize));
+        kernelInfo->apply(kernelDeviceInfoConstants);
+    }
+    return kernelImmDatas[kernelId]->initialize(kernelInfo,
+                                                device,
+                                                device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+                                                this->translationUnit->globalConstBuffer,
+                                                this->translationUnit->globalVarBuffer,
+                                                this->type == ModuleType::builtin);
+}
+
+NEO::WorkerThreadPool *ModuleImp::getKernelImmutableDatasInitializationWorkers(size_t kernelsCount) const {
+    if (kernelsCount <= 1u) {
+        return nullptr;
+    }
+    // debug data relocation is not safe to run concurrently
+    if (this->device->getNEODevice()->getDebugger() != nullptr) {
+        return nullptr;
+    }
+    return this->device->getNEODevice()->getExecutionEnvironment()->initializeModuleBuildWorkers();
+}
+
+ze_result_t ModuleImp::initializeKernelImmutableDatasInParallel(NEO::WorkerThreadPool &workers) {
+    auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    const size_t kernelsCount = kernelInfos.size();
+
+    // Bindless slots and bindless heap surface states of module globals are shared by all kernels,
+    // set them up once before fanning out so that workers only patch their own cross thread data
+    auto memoryManager = device->getNEODevice()->getMemoryManager();
+    bool globalConstBufferBindless = false;
+    bool globalVarBufferBindless = false;
+    for (auto kernelInfo : kernelInfos) {
+        auto &implicitArgs = kernelInfo->kernelDescriptor.payloadMappings.implicitArgs;
+        globalConstBufferBindless |= NEO::isValidOffset(implicitArgs.globalConstantsSurfaceAddress.bindless);
+        globalVarBufferBindless |= NEO::isValidOffset(implicitArgs.globalVariablesSurfaceAddress.bindless);
+    }
+    for (auto [globalBuffer, bindless] : {std::make_pair(this->translationUnit->globalConstBuffer, globalConstBufferBindless),
+                                          std::make_pair(this->translationUnit->globalVarBuffer, globalVarBufferBindless)}) {
+        if (globalBuffer == nullptr || !bindless) {
+            continue;
+        }
+        if (!memoryManager->allocateBindlessSlot(globalBuffer)) {
+            return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        KernelImmutableData::setGlobalSurfaceStateInBindlessHeap(globalBuffer, device);
+    }
+    for (auto &kernelImmData : kernelImmDatas) {
+        kernelImmData->setGlobalSurfaceStatesInBindlessHeapPreset(true);
+    }
+
+    std::vector<ze_result_t> results(kernelsCount, ZE_RESULT_SUCCESS);
+    workers.runForEachItem(kernelsCount, [&](size_t kernelId) {
+        results[kernelId] = this->initializeKernelImmutableData(kernelId);
+    });
+
+    for (size_t i = 0lu; i < kernelsCount; i++) {
+        if (results[i] != ZE_RESULT_SUCCESS) {
+            kernelImmDatas[i].reset();
+            return results[i];
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t ModuleImp::allocateKernelImmutableDatas(size_t kernelsCount) {
     if (this->kernelImmDatas.size() == kernelsCount) {
         return ZE_RESULT_SUCCESS;
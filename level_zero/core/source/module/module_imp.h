@@ -9,6 +9,7 @@
 
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/linker.h"
+#include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_info.h"
 
 #include "level_zero/core/source/kernel/kernel.h"
@@ -18,12 +19,14 @@
 
 #include <list>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 
 namespace NEO {
 struct KernelDescriptor;
 class SharedIsaAllocation;
+class WorkerThreadPool;
 
 namespace Zebin::Debug {
 struct Segments;
@@ -86,6 +89,8 @@ struct ModuleTranslationUnit {
     std::vector<char *> alignedvIsas;
 
     NEO::specConstValuesMap specConstantsValues;
+    // set up when binary is processed, applied to each kernel as part of its immutable data initialization
+    std::optional<NEO::DeviceInfoKernelPayloadConstants> deviceInfoConstants;
     bool isBuiltIn{false};
     bool isGeneratedByIgc{true};
 };
@@ -169,6 +174,9 @@ struct ModuleImp : public Module {
     bool shouldBuildBeFailed(NEO::Device *neoDevice);
     ze_result_t allocateKernelImmutableDatas(size_t kernelsCount);
     ze_result_t initializeKernelImmutableDatas();
+    ze_result_t initializeKernelImmutableData(size_t kernelId);
+    ze_result_t initializeKernelImmutableDatasInParallel(NEO::WorkerThreadPool &workers);
+    NEO::WorkerThreadPool *getKernelImmutableDatasInitializationWorkers(size_t kernelsCount) const;
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
     void checkIfPrivateMemoryPerDispatchIsNeeded() override;
     NEO::Zebin::Debug::Segments getZebinSegments();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,4 +18,7 @@ static CommandListPopulateFactory<IGFX_BMG, CommandListProductFamily<IGFX_BMG>>
 static CommandListImmediatePopulateFactory<IGFX_BMG, CommandListImmediateProductFamily<IGFX_BMG>>
     populateBMGImmediate;
 
+static MutableCommandListPopulateFactory<IGFX_BMG, MutableCommandListCoreFamily<IGFX_XE2_HPG_CORE>>
+    populateBMGMutable;
+
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,4 +18,7 @@ static CommandListPopulateFactory<IGFX_LUNARLAKE, CommandListProductFamily<IGFX_
 static CommandListImmediatePopulateFactory<IGFX_LUNARLAKE, CommandListImmediateProductFamily<IGFX_LUNARLAKE>>
     populateLNLImmediate;
 
+static MutableCommandListPopulateFactory<IGFX_LUNARLAKE, MutableCommandListCoreFamily<IGFX_XE2_HPG_CORE>>
+    populateLNLMutable;
+
 } // namespace L0
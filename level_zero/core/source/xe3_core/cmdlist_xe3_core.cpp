@@ -13,6 +13,7 @@
 #include "level_zero/core/source/cmdlist/cmdlist_hw_xe2_hpg_and_later.inl"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_xe_hpc_and_later.inl"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_xehp_and_later.inl"
+#include "level_zero/core/source/cmdlist/mutable_cmdlist_hw.inl"
 
 #include "cmdlist_extended.inl"
 
@@ -20,5 +21,6 @@ namespace L0 {
 
 template struct CommandListCoreFamily<IGFX_XE3_CORE>;
 template struct CommandListCoreFamilyImmediate<IGFX_XE3_CORE>;
+template struct MutableCommandListCoreFamily<IGFX_XE3_CORE>;
 
 } // namespace L0
@@ -10,6 +10,7 @@
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
+#include "level_zero/core/source/cmdlist/mutable_cmdlist_hw.h"
 
 namespace L0 {
 template <PRODUCT_FAMILY productFamily>
@@ -17,4 +17,7 @@ static CommandListPopulateFactory<IGFX_PTL, CommandListProductFamily<IGFX_PTL>>
 static CommandListImmediatePopulateFactory<IGFX_PTL, CommandListImmediateProductFamily<IGFX_PTL>>
     populatePTLImmediate;
 
+static MutableCommandListPopulateFactory<IGFX_PTL, MutableCommandListCoreFamily<IGFX_XE3_CORE>>
+    populatePTLMutable;
+
 } // namespace L0
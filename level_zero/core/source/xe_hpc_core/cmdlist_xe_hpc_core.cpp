@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.inl"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_xe_hpc_and_later.inl"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_xehp_and_later.inl"
+#include "level_zero/core/source/cmdlist/mutable_cmdlist_hw.inl"
 
 #include "cmdlist_extended.inl"
 
@@ -56,5 +57,6 @@ ze_result_t CommandListCoreFamily<IGFX_XE_HPC_CORE>::appendMemoryPrefetch(const
 
 template struct CommandListCoreFamily<IGFX_XE_HPC_CORE>;
 template struct CommandListCoreFamilyImmediate<IGFX_XE_HPC_CORE>;
+template struct MutableCommandListCoreFamily<IGFX_XE_HPC_CORE>;
 
 } // namespace L0
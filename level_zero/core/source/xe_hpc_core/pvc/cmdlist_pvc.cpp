@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,4 +15,7 @@ static CommandListPopulateFactory<IGFX_PVC, CommandListProductFamily<IGFX_PVC>>
 
 static CommandListImmediatePopulateFactory<IGFX_PVC, CommandListImmediateProductFamily<IGFX_PVC>>
     populatePVCImmediate;
+
+static MutableCommandListPopulateFactory<IGFX_PVC, MutableCommandListCoreFamily<IGFX_XE_HPC_CORE>>
+    populatePVCMutable;
 } // namespace L0
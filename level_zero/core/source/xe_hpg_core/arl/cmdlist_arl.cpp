@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,4 +17,7 @@ static CommandListPopulateFactory<IGFX_ARROWLAKE, CommandListProductFamily<IGFX_
 static CommandListImmediatePopulateFactory<IGFX_ARROWLAKE, CommandListImmediateProductFamily<IGFX_ARROWLAKE>>
     populateARLImmediate;
 
+static MutableCommandListPopulateFactory<IGFX_ARROWLAKE, MutableCommandListCoreFamily<IGFX_XE_HPG_CORE>>
+    populateARLMutable;
+
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,7 @@
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.inl"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_xehp_and_later.inl"
+#include "level_zero/core/source/cmdlist/mutable_cmdlist_hw.inl"
 
 #include "cmdlist_extended.inl"
 
@@ -66,5 +67,6 @@ void CommandListCoreFamily<IGFX_XE_HPG_CORE>::applyMemoryRangesBarrier(uint32_t
 
 template struct CommandListCoreFamily<IGFX_XE_HPG_CORE>;
 template struct CommandListCoreFamilyImmediate<IGFX_XE_HPG_CORE>;
+template struct MutableCommandListCoreFamily<IGFX_XE_HPG_CORE>;
 
 } // namespace L0
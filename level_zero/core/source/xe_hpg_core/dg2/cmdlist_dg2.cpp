@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2022 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,4 +14,7 @@ static CommandListPopulateFactory<IGFX_DG2, CommandListProductFamily<IGFX_DG2>>
 static CommandListImmediatePopulateFactory<IGFX_DG2, CommandListImmediateProductFamily<IGFX_DG2>>
     populateDG2Immediate;
 
+static MutableCommandListPopulateFactory<IGFX_DG2, MutableCommandListCoreFamily<IGFX_XE_HPG_CORE>>
+    populateDG2Mutable;
+
 } // namespace L0
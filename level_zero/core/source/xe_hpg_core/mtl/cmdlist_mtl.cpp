@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,4 +14,7 @@ static CommandListPopulateFactory<IGFX_METEORLAKE, CommandListProductFamily<IGFX
 static CommandListImmediatePopulateFactory<IGFX_METEORLAKE, CommandListImmediateProductFamily<IGFX_METEORLAKE>>
     populateMTLImmediate;
 
+static MutableCommandListPopulateFactory<IGFX_METEORLAKE, MutableCommandListCoreFamily<IGFX_XE_HPG_CORE>>
+    populateMTLMutable;
+
 } // namespace L0
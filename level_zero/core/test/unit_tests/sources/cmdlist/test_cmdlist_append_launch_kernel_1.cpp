@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,9 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdqueue.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_module.h"
 
+#include <atomic>
+#include <thread>
+
 namespace L0 {
 namespace ult {
 
@@ -209,6 +212,8 @@ HWTEST2_F(CommandListAppendLaunchKernel, givenNotEnoughSpaceInCommandStreamWhenA
         nullptr,                                  // cpuWalkerBuffer
         nullptr,                                  // cpuPayloadBuffer
         nullptr,                                  // outImplicitArgsPtr
+        nullptr,                                  // outIndirectDataPtr
+        nullptr,                                  // outSurfaceStatesPtr
         nullptr,                                  // additionalCommands
         PreemptionMode::MidBatch,                 // preemptionMode
         NEO::RequiredPartitionDim::none,          // requiredPartitionDim
@@ -1502,6 +1507,352 @@ HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListWhenAppendLaun
     EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
 }
 
+HWTEST2_F(CommandListAppendLaunchKernel, givenSubmissionCoalescingEnabledWhenAppendingKernelsWithoutEventsThenSubmissionIsDeferredUntilFlush, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateCmdListSubmissionCoalescing.set(1);
+    debugManager.flags.ImmediateCmdListSubmissionCoalescingWindowUs.set(std::numeric_limits<int32_t>::max());
+
+    createKernel();
+    device->getNEODevice()->getExecutionEnvironment()->periodicTaskScheduler = std::make_unique<NEO::PeriodicTaskScheduler>();
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    cmdList.heaplessModeEnabled = true;
+    cmdList.immediateCmdListHeapSharing = false;
+    static_cast<DeviceImp *>(device)->calculationForDisablingEuFusionWithDpasNeeded = false;
+    EXPECT_TRUE(cmdList.submissionCoalescingEnabled);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    }
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(3u, cmdList.getCoalescedAppendsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushCoalescedSubmission());
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getCoalescedAppendsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushCoalescedSubmission());
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenCoalescedAppendsWhenAppendingNonCoalescedOperationThenDeferredAppendsAreSubmittedFirst, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateCmdListSubmissionCoalescing.set(1);
+    debugManager.flags.ImmediateCmdListSubmissionCoalescingWindowUs.set(std::numeric_limits<int32_t>::max());
+
+    createKernel();
+    device->getNEODevice()->getExecutionEnvironment()->periodicTaskScheduler = std::make_unique<NEO::PeriodicTaskScheduler>();
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    cmdList.heaplessModeEnabled = true;
+    cmdList.immediateCmdListHeapSharing = false;
+    static_cast<DeviceImp *>(device)->calculationForDisablingEuFusionWithDpasNeeded = false;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList.getCoalescedAppendsCount());
+
+    CmdListKernelLaunchParams cooperativeParams = {};
+    cooperativeParams.isCooperative = true;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, cooperativeParams, false));
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getCoalescedAppendsCount());
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenSubmissionCoalescingWhenCoalescedSizeLimitIsReachedThenAppendsAreSubmitted, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateCmdListSubmissionCoalescing.set(1);
+    debugManager.flags.ImmediateCmdListSubmissionCoalescingMaxSize.set(0);
+    debugManager.flags.PrintImmediateCmdListSubmissionCoalescing.set(true);
+
+    createKernel();
+    device->getNEODevice()->getExecutionEnvironment()->periodicTaskScheduler = std::make_unique<NEO::PeriodicTaskScheduler>();
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    cmdList.heaplessModeEnabled = true;
+    cmdList.immediateCmdListHeapSharing = false;
+    static_cast<DeviceImp *>(device)->calculationForDisablingEuFusionWithDpasNeeded = false;
+    EXPECT_EQ(0u, cmdList.submissionCoalescingMaxSize);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getCoalescedAppendsCount());
+    EXPECT_EQ(std::string("Immediate command list submission coalesced 1 appends\n"), output);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenSubmissionCoalescingEnabledWhenCommandListIsNotHeaplessThenEachAppendIsSubmitted, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateCmdListSubmissionCoalescing.set(1);
+
+    createKernel();
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    cmdList.heaplessModeEnabled = false;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getCoalescedAppendsCount());
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenCoalescedAppendsWhenCsrFlushesDeferredSubmissionsThenAppendsAreSubmitted, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateCmdListSubmissionCoalescing.set(1);
+    debugManager.flags.ImmediateCmdListSubmissionCoalescingWindowUs.set(std::numeric_limits<int32_t>::max());
+
+    createKernel();
+    auto executionEnvironment = device->getNEODevice()->getExecutionEnvironment();
+    executionEnvironment->periodicTaskScheduler = std::make_unique<NEO::PeriodicTaskScheduler>();
+    auto csr = device->getNEODevice()->getDefaultEngine().commandStreamReceiver;
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, csr, &queueDesc);
+
+    {
+        MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+        cmdList.isFlushTaskSubmissionEnabled = true;
+        cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+        cmdList.cmdQImmediate = queue.get();
+        cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+        cmdList.commandContainer.setImmediateCmdListCsr(csr);
+        cmdList.heaplessModeEnabled = true;
+        cmdList.immediateCmdListHeapSharing = false;
+        static_cast<DeviceImp *>(device)->calculationForDisablingEuFusionWithDpasNeeded = false;
+
+        ze_group_count_t groupCount{1, 1, 1};
+        CmdListKernelLaunchParams launchParams = {};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+        EXPECT_EQ(2u, cmdList.getCoalescedAppendsCount());
+        EXPECT_EQ(1u, executionEnvironment->periodicTaskScheduler->getTasksCount());
+
+        csr->flushDeferredSubmissions(true);
+        EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+        EXPECT_EQ(0u, cmdList.getCoalescedAppendsCount());
+
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+        auto allocation = device->getNEODevice()->getMemoryManager()->allocateGraphicsMemoryWithProperties({device->getRootDeviceIndex(), MemoryConstants::pageSize, NEO::AllocationType::buffer, device->getNEODevice()->getDeviceBitfield()});
+        device->getNEODevice()->getMemoryManager()->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+        EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+        EXPECT_EQ(0u, cmdList.getCoalescedAppendsCount());
+    }
+    EXPECT_EQ(0u, executionEnvironment->periodicTaskScheduler->getTasksCount());
+
+    csr->flushDeferredSubmissions(true);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenCoalescingLockHeldByOtherThreadWhenCsrFlushesDeferredSubmissionsThenFlushWaitsForLockAndSubmitsAppends, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateCmdListSubmissionCoalescing.set(1);
+    debugManager.flags.ImmediateCmdListSubmissionCoalescingWindowUs.set(std::numeric_limits<int32_t>::max());
+
+    createKernel();
+    device->getNEODevice()->getExecutionEnvironment()->periodicTaskScheduler = std::make_unique<NEO::PeriodicTaskScheduler>();
+    auto csr = device->getNEODevice()->getDefaultEngine().commandStreamReceiver;
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, csr, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(csr);
+    cmdList.heaplessModeEnabled = true;
+    cmdList.immediateCmdListHeapSharing = false;
+    static_cast<DeviceImp *>(device)->calculationForDisablingEuFusionWithDpasNeeded = false;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList.getCoalescedAppendsCount());
+
+    std::atomic<bool> lockTaken = false;
+    std::atomic<bool> releaseLock = false;
+    std::thread appendingThread([&]() {
+        std::lock_guard<std::recursive_timed_mutex> lock(cmdList.submissionCoalescingMutex);
+        lockTaken = true;
+        while (!releaseLock) {
+            std::this_thread::yield();
+        }
+    });
+    while (!lockTaken) {
+        std::this_thread::yield();
+    }
+
+    std::atomic<bool> flushed = false;
+    std::thread freeingThread([&]() {
+        csr->flushDeferredSubmissions(true);
+        flushed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_FALSE(flushed);
+    EXPECT_EQ(1u, cmdList.getCoalescedAppendsCount());
+
+    releaseLock = true;
+    appendingThread.join();
+    freeingThread.join();
+    EXPECT_TRUE(flushed);
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getCoalescedAppendsCount());
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenCoalescingLockHeldByOtherThreadWhenCsrFlushesDeferredSubmissionsForWaitThenFlushGivesUpAfterWindow, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateCmdListSubmissionCoalescing.set(1);
+    debugManager.flags.ImmediateCmdListSubmissionCoalescingWindowUs.set(std::numeric_limits<int32_t>::max());
+
+    createKernel();
+    device->getNEODevice()->getExecutionEnvironment()->periodicTaskScheduler = std::make_unique<NEO::PeriodicTaskScheduler>();
+    auto csr = device->getNEODevice()->getDefaultEngine().commandStreamReceiver;
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, csr, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(csr);
+    cmdList.heaplessModeEnabled = true;
+    cmdList.immediateCmdListHeapSharing = false;
+    static_cast<DeviceImp *>(device)->calculationForDisablingEuFusionWithDpasNeeded = false;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList.getCoalescedAppendsCount());
+    cmdList.submissionCoalescingWindow = std::chrono::microseconds(1);
+
+    std::atomic<bool> lockTaken = false;
+    std::atomic<bool> releaseLock = false;
+    std::thread appendingThread([&]() {
+        std::lock_guard<std::recursive_timed_mutex> lock(cmdList.submissionCoalescingMutex);
+        lockTaken = true;
+        while (!releaseLock) {
+            std::this_thread::yield();
+        }
+    });
+    while (!lockTaken) {
+        std::this_thread::yield();
+    }
+
+    csr->flushDeferredSubmissions(false);
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, cmdList.getCoalescedAppendsCount());
+
+    releaseLock = true;
+    appendingThread.join();
+    csr->flushDeferredSubmissions(false);
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getCoalescedAppendsCount());
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenCoalescedAppendsWhenDeadlineTaskRunsThenAppendsAreSubmittedOnlyAfterWindowHasPassed, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateCmdListSubmissionCoalescing.set(1);
+    debugManager.flags.ImmediateCmdListSubmissionCoalescingWindowUs.set(std::numeric_limits<int32_t>::max());
+
+    createKernel();
+    device->getNEODevice()->getExecutionEnvironment()->periodicTaskScheduler = std::make_unique<NEO::PeriodicTaskScheduler>();
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    cmdList.heaplessModeEnabled = true;
+    cmdList.immediateCmdListHeapSharing = false;
+    static_cast<DeviceImp *>(device)->calculationForDisablingEuFusionWithDpasNeeded = false;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+
+    cmdList.flushCoalescedSubmissionOnDeadline();
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, cmdList.getCoalescedAppendsCount());
+
+    cmdList.submissionCoalescingWindow = std::chrono::microseconds::zero();
+    cmdList.flushCoalescedSubmissionOnDeadline();
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getCoalescedAppendsCount());
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenFailedFlushOfCoalescedAppendsRequestedByOtherThreadWhenAppendingNextKernelThenErrorIsReturnedByThisAppend, MatchAny) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateCmdListSubmissionCoalescing.set(1);
+    debugManager.flags.ImmediateCmdListSubmissionCoalescingWindowUs.set(std::numeric_limits<int32_t>::max());
+
+    createKernel();
+    device->getNEODevice()->getExecutionEnvironment()->periodicTaskScheduler = std::make_unique<NEO::PeriodicTaskScheduler>();
+    ze_command_queue_desc_t queueDesc = {};
+    auto queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.cmdQImmediate = queue.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    cmdList.heaplessModeEnabled = true;
+    cmdList.immediateCmdListHeapSharing = false;
+    static_cast<DeviceImp *>(device)->calculationForDisablingEuFusionWithDpasNeeded = false;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+
+    cmdList.executeCommandListImmediateWithFlushTaskReturnValue = ZE_RESULT_ERROR_DEVICE_LOST;
+    cmdList.flushCoalescedSubmissionOnCsrRequest(true);
+    EXPECT_EQ(0u, cmdList.getCoalescedAppendsCount());
+
+    cmdList.executeCommandListImmediateWithFlushTaskReturnValue = ZE_RESULT_SUCCESS;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, cmdList.getCoalescedAppendsCount());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.flushCoalescedSubmission());
+}
+
 HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListWhenAppendLaunchCooperativeKernelNotUsingFlushTaskThenExpectCorrectExecuteCall, MatchAny) {
     createKernel();
     ze_command_queue_desc_t queueDesc = {};
@@ -926,6 +926,8 @@ HWTEST2_F(CommandListAppendLaunchKernel, givenNotEnoughSpaceInCommandStreamWhenA
         nullptr,                                  // cpuWalkerBuffer
         nullptr,                                  // cpuPayloadBuffer
         nullptr,                                  // outImplicitArgsPtr
+        nullptr,                                  // outIndirectDataPtr
+        nullptr,                                  // outSurfaceStatesPtr
         nullptr,                                  // additionalCommands
         PreemptionMode::MidBatch,                 // preemptionMode
         NEO::RequiredPartitionDim::none,          // requiredPartitionDim
@@ -0,0 +1,345 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/core/source/cmdlist/mutable_cmdlist.h"
+#include "level_zero/core/source/cmdlist/mutable_cmdlist_hw.h"
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_module.h"
+
+#include <algorithm>
+
+namespace L0 {
+namespace ult {
+
+using MutableCommandListTest = Test<ModuleFixture>;
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+struct WhiteBoxMutableCommandList : public MutableCommandListCoreFamily<gfxCoreFamily> {
+    using BaseClass = MutableCommandListCoreFamily<gfxCoreFamily>;
+    using BaseClass::mutableDispatches;
+};
+
+struct MutableCommandListUpdateTest : public MutableCommandListTest {
+    void SetUp() override {
+        MutableCommandListTest::SetUp();
+
+        mockModule = std::make_unique<Mock<Module>>(device, nullptr);
+        mockKernel = std::make_unique<Mock<KernelImp>>();
+        mockKernel->module = mockModule.get();
+
+        NEO::ArgDescriptor valueArg(NEO::ArgDescriptor::argTValue);
+        NEO::ArgDescValue::Element element;
+        element.offset = valueArgOffset;
+        element.size = sizeof(uint32_t);
+        element.sourceOffset = 0;
+        valueArg.as<NEO::ArgDescValue>().elements.push_back(element);
+
+        NEO::ArgDescriptor pointerArg(NEO::ArgDescriptor::argTPointer);
+        pointerArg.as<NEO::ArgDescPointer>().stateless = pointerArgOffset;
+        pointerArg.as<NEO::ArgDescPointer>().pointerSize = sizeof(uint64_t);
+
+        auto &payloadMappings = mockKernel->descriptor.payloadMappings;
+        payloadMappings.explicitArgs.push_back(valueArg);
+        payloadMappings.explicitArgs.push_back(pointerArg);
+        payloadMappings.dispatchTraits.globalWorkOffset[0] = globalOffsetOffset;
+        payloadMappings.dispatchTraits.globalWorkOffset[1] = globalOffsetOffset + sizeof(uint32_t);
+        payloadMappings.dispatchTraits.globalWorkOffset[2] = globalOffsetOffset + 2 * sizeof(uint32_t);
+
+        mockKernel->crossThreadData = std::make_unique<uint8_t[]>(crossThreadDataSize);
+        mockKernel->crossThreadDataSize = crossThreadDataSize;
+        memset(mockKernel->crossThreadData.get(), 0, crossThreadDataSize);
+
+        ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+        eventPoolDesc.count = 2;
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        eventPool.reset(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+        ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    }
+
+    void TearDown() override {
+        events.clear();
+        eventPool.reset();
+        mockKernel.reset();
+        mockModule.reset();
+        MutableCommandListTest::TearDown();
+    }
+
+    template <typename FamilyType>
+    Event *createEvent(uint32_t index) {
+        ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+        eventDesc.index = index;
+        events.emplace_back(Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+        return events.back().get();
+    }
+
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    WhiteBoxMutableCommandList<gfxCoreFamily> *createCommandList(ze_mutable_command_exp_flags_t flags, ze_event_handle_t hSignalEvent,
+                                                                 uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+        ze_result_t returnValue;
+        commandList.reset(MutableCommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+        EXPECT_NE(nullptr, commandList);
+
+        ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+        commandIdDesc.flags = flags;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, 0, nullptr, &commandId));
+
+        ze_group_count_t groupCount = {1, 1, 1};
+        CmdListKernelLaunchParams launchParams = {};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel->toHandle(), groupCount, hSignalEvent, numWaitEvents, phWaitEvents, launchParams, false));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+        return static_cast<WhiteBoxMutableCommandList<gfxCoreFamily> *>(commandList.get());
+    }
+
+    size_t countInResidencyContainer(NEO::GraphicsAllocation *allocation) {
+        auto &residencyContainer = commandList->getCmdContainer().getResidencyContainer();
+        return static_cast<size_t>(std::count(residencyContainer.begin(), residencyContainer.end(), allocation));
+    }
+
+    static constexpr uint16_t valueArgOffset = 0;
+    static constexpr uint16_t pointerArgOffset = 8;
+    static constexpr uint16_t globalOffsetOffset = 16;
+    static constexpr uint32_t crossThreadDataSize = 32;
+
+    std::unique_ptr<Mock<Module>> mockModule;
+    std::unique_ptr<Mock<KernelImp>> mockKernel;
+    std::unique_ptr<EventPool> eventPool;
+    std::vector<std::unique_ptr<Event>> events;
+    std::unique_ptr<L0::CommandList> commandList;
+    uint64_t commandId = 0;
+};
+
+HWTEST2_F(MutableCommandListTest, givenRegularCommandListWhenGettingNextCommandIdThenUnsupportedFeatureIsReturned, IsAtLeastXeHpCore) {
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+    ASSERT_NE(nullptr, commandList);
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT;
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->getNextCommandId(&commandIdDesc, 0, nullptr, &commandId));
+    EXPECT_EQ(nullptr, commandList->asMutable());
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableCommandListWhenRequestingUnsupportedUpdateFlagsThenUnsupportedFeatureIsReturned, IsAtLeastXeHpCore) {
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(MutableCommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_NE(nullptr, commandList->asMutable());
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE;
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->getNextCommandId(&commandIdDesc, 0, nullptr, &commandId));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, commandList->getNextCommandId(&commandIdDesc, 0, nullptr, nullptr));
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableKernelLaunchWhenUpdatingGroupCountThenWalkerIsPatched, IsAtLeastXeHpCore) {
+    using WalkerType = typename FamilyType::DefaultWalkerType;
+    createKernel();
+    kernel->setGroupSize(1, 1, 1);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(MutableCommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+    ASSERT_NE(nullptr, commandList);
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, 0, nullptr, &commandId));
+    EXPECT_EQ(1u, commandId);
+
+    ze_group_count_t groupCount = {1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+
+    ze_group_count_t newGroupCount = {4, 2, 1};
+    ze_mutable_group_count_exp_desc_t groupCountDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC};
+    groupCountDesc.commandId = commandId;
+    groupCountDesc.pGroupCount = &newGroupCount;
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    mutableCommandsDesc.pNext = &groupCountDesc;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    auto commandStream = commandList->getCmdContainer().getCommandStream();
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(cmdList, commandStream->getCpuBase(), commandStream->getUsed()));
+    auto itorWalker = find<WalkerType *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(cmdList.end(), itorWalker);
+
+    auto walker = genCmdCast<WalkerType *>(*itorWalker);
+    EXPECT_EQ(4u, walker->getThreadGroupIdXDimension());
+    EXPECT_EQ(2u, walker->getThreadGroupIdYDimension());
+    EXPECT_EQ(1u, walker->getThreadGroupIdZDimension());
+}
+
+HWTEST2_F(MutableCommandListTest, givenInvalidCommandIdOrGroupSizeDescWhenUpdatingMutableCommandsThenErrorIsReturned, IsAtLeastXeHpCore) {
+    createKernel();
+    kernel->setGroupSize(1, 1, 1);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(MutableCommandList::create(productFamily, device, NEO::EngineGroupType::compute, 0u, returnValue, false));
+    ASSERT_NE(nullptr, commandList);
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, 0, nullptr, &commandId));
+
+    ze_group_count_t groupCount = {1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+
+    ze_group_count_t newGroupCount = {2, 1, 1};
+    ze_mutable_group_count_exp_desc_t groupCountDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC};
+    groupCountDesc.commandId = commandId;
+    groupCountDesc.pGroupCount = &newGroupCount;
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    mutableCommandsDesc.pNext = &groupCountDesc;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    ze_mutable_global_offset_exp_desc_t globalOffsetDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GLOBAL_OFFSET_EXP_DESC};
+    globalOffsetDesc.commandId = commandId + 1;
+    mutableCommandsDesc.pNext = &globalOffsetDesc;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    ze_mutable_group_size_exp_desc_t groupSizeDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_SIZE_EXP_DESC};
+    groupSizeDesc.commandId = commandId;
+    mutableCommandsDesc.pNext = &groupSizeDesc;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableCommands(&mutableCommandsDesc));
+}
+
+HWTEST2_F(MutableCommandListTest, givenOverriddenUpdateCapabilityWhenQueryingDevicePropertiesThenOnlySupportedMutableFlagsAreReported, IsAtLeastXeHpCore) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.OverrideCmdListUpdateCapability.set(ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT | ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE);
+
+    ze_mutable_command_list_exp_properties_t mutableProperties = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_EXP_PROPERTIES};
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    deviceProperties.pNext = &mutableProperties;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, device->getProperties(&deviceProperties));
+
+    EXPECT_EQ(0u, mutableProperties.mutableCommandListFlags);
+    EXPECT_EQ(static_cast<ze_mutable_command_exp_flags_t>(ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT), mutableProperties.mutableCommandFlags);
+}
+
+HWTEST2_F(MutableCommandListUpdateTest, givenMutableKernelLaunchWhenUpdatingArgumentsAndGlobalOffsetThenPayloadIsPatchedAndAllocationIsMadeResidentOnce, IsAtLeastXeHpCore) {
+    auto mutableCommandList = createCommandList<gfxCoreFamily>(ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS | ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET, nullptr, 0, nullptr);
+    ASSERT_EQ(1u, mutableCommandList->mutableDispatches.size());
+    auto &dispatch = *mutableCommandList->mutableDispatches[0];
+    ASSERT_NE(nullptr, dispatch.indirectData);
+    ASSERT_EQ(0u, dispatch.inlineDataSize);
+
+    void *buffer = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 4096u, &buffer));
+    auto allocation = driverHandle->getSvmAllocsManager()->getSVMAlloc(buffer)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    uint32_t value = 0x1234u;
+    ze_mutable_kernel_argument_exp_desc_t valueArgDesc = {ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC};
+    valueArgDesc.commandId = commandId;
+    valueArgDesc.argIndex = 0;
+    valueArgDesc.argSize = sizeof(value);
+    valueArgDesc.pArgValue = &value;
+
+    ze_mutable_kernel_argument_exp_desc_t bufferArgDesc = {ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC};
+    bufferArgDesc.commandId = commandId;
+    bufferArgDesc.argIndex = 1;
+    bufferArgDesc.argSize = sizeof(buffer);
+    bufferArgDesc.pArgValue = &buffer;
+    valueArgDesc.pNext = &bufferArgDesc;
+
+    ze_mutable_global_offset_exp_desc_t globalOffsetDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GLOBAL_OFFSET_EXP_DESC};
+    globalOffsetDesc.commandId = commandId;
+    globalOffsetDesc.offsetX = 1;
+    globalOffsetDesc.offsetY = 2;
+    globalOffsetDesc.offsetZ = 3;
+    bufferArgDesc.pNext = &globalOffsetDesc;
+
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC};
+    mutableCommandsDesc.pNext = &valueArgDesc;
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommands(&mutableCommandsDesc));
+    }
+
+    auto indirectData = reinterpret_cast<const uint8_t *>(dispatch.indirectData);
+    EXPECT_EQ(value, *reinterpret_cast<const uint32_t *>(indirectData + valueArgOffset));
+    EXPECT_EQ(reinterpret_cast<uint64_t>(buffer), *reinterpret_cast<const uint64_t *>(indirectData + pointerArgOffset));
+    auto globalOffsets = reinterpret_cast<const uint32_t *>(indirectData + globalOffsetOffset);
+    EXPECT_EQ(1u, globalOffsets[0]);
+    EXPECT_EQ(2u, globalOffsets[1]);
+    EXPECT_EQ(3u, globalOffsets[2]);
+    EXPECT_EQ(0, memcmp(indirectData, dispatch.crossThreadData.data(), crossThreadDataSize));
+
+    EXPECT_EQ(1u, countInResidencyContainer(allocation));
+
+    context->freeMem(buffer);
+}
+
+HWTEST2_F(MutableCommandListUpdateTest, givenMutableSignalEventWhenUpdatingSignalEventThenWalkerPostSyncIsPatched, IsAtLeastXeHpCore) {
+    using WalkerType = typename FamilyType::DefaultWalkerType;
+    DebugManagerStateRestore restore;
+    // event is signaled by walker post sync alone only when a single packet is signaled
+    debugManager.flags.SignalAllEventPackets.set(0);
+
+    auto event = createEvent<FamilyType>(0);
+    auto newEvent = createEvent<FamilyType>(1);
+    auto mutableCommandList = createCommandList<gfxCoreFamily>(ZE_MUTABLE_COMMAND_EXP_FLAG_SIGNAL_EVENT, event->toHandle(), 0, nullptr);
+    auto &dispatch = *mutableCommandList->mutableDispatches[0];
+    ASSERT_TRUE(dispatch.signalEventPatchable);
+
+    auto walker = reinterpret_cast<WalkerType *>(dispatch.walker);
+    ASSERT_NE(event->getPacketAddress(device), newEvent->getPacketAddress(device));
+    EXPECT_EQ(event->getPacketAddress(device), walker->getPostSync().getDestinationAddress());
+
+    auto residencyCount = countInResidencyContainer(newEvent->getAllocation(device));
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommandSignalEvent(commandId, newEvent->toHandle()));
+    }
+    EXPECT_EQ(newEvent->getPacketAddress(device), walker->getPostSync().getDestinationAddress());
+    EXPECT_EQ(newEvent, dispatch.signalEvent);
+    EXPECT_EQ(std::max<size_t>(residencyCount, 1u), countInResidencyContainer(newEvent->getAllocation(device)));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommandSignalEvent(commandId, nullptr));
+}
+
+HWTEST2_F(MutableCommandListUpdateTest, givenMutableWaitEventsWhenUpdatingWaitEventsThenSemaphoresArePatchedAndEventCountMustMatch, IsAtLeastXeHpCore) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    auto event = createEvent<FamilyType>(0);
+    auto newEvent = createEvent<FamilyType>(1);
+    auto hEvent = event->toHandle();
+    auto mutableCommandList = createCommandList<gfxCoreFamily>(ZE_MUTABLE_COMMAND_EXP_FLAG_WAIT_EVENTS, nullptr, 1, &hEvent);
+    auto &dispatch = *mutableCommandList->mutableDispatches[0];
+    ASSERT_EQ(1u, dispatch.waitEvents.size());
+    ASSERT_FALSE(dispatch.waitEventCommands[0].empty());
+
+    ze_event_handle_t newWaitEvents[2] = {newEvent->toHandle(), newEvent->toHandle()};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommandWaitEvents(commandId, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommandWaitEvents(commandId, 2, newWaitEvents));
+    EXPECT_EQ(event, dispatch.waitEvents[0]);
+
+    auto residencyCount = countInResidencyContainer(newEvent->getAllocation(device));
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommandWaitEvents(commandId, 1, newWaitEvents));
+    }
+    EXPECT_EQ(newEvent, dispatch.waitEvents[0]);
+    EXPECT_EQ(std::max<size_t>(residencyCount, 1u), countInResidencyContainer(newEvent->getAllocation(device)));
+
+    auto semaphore = reinterpret_cast<MI_SEMAPHORE_WAIT *>(dispatch.waitEventCommands[0][0].pDestination);
+    EXPECT_EQ(newEvent->getCompletionFieldGpuAddress(device), semaphore->getSemaphoreGraphicsAddress());
+}
+
+} // namespace ult
+} // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -765,7 +765,7 @@ HWTEST_F(CommandQueueExecuteCommandListsSimpleTest, GivenDirtyFlagForContextInBi
     auto commandQueue = whiteboxCast(CommandQueue::create(productFamily, device, neoDevice->getDefaultEngine().commandStreamReceiver, &queueDesc, false, false, false, returnValue));
     ASSERT_NE(nullptr, commandQueue);
 
-    bindlessHeapsHelperPtr->stateCacheDirtyForContext.set(commandQueue->getCsr()->getOsContext().getContextId());
+    bindlessHeapsHelperPtr->stateCacheDirtyForContext.fetch_or(1ull << commandQueue->getCsr()->getOsContext().getContextId());
 
     auto usedSpaceBefore = commandQueue->commandStream.getUsed();
 
@@ -879,7 +879,7 @@ HWTEST_F(CommandQueueExecuteCommandListsMultiDeviceTest, GivenDirtyFlagForContex
     uint32_t firstDeviceFirstContextId = neoDevice->getMemoryManager()->getFirstContextIdForRootDevice(0);
     EXPECT_EQ(0u, firstDeviceFirstContextId);
 
-    bindlessHeapsHelperPtr->stateCacheDirtyForContext.set();
+    bindlessHeapsHelperPtr->stateCacheDirtyForContext.store(std::numeric_limits<uint64_t>::max());
 
     auto usedSpaceBefore = commandQueue->commandStream.getUsed();
 
@@ -1734,6 +1734,56 @@ TEST_F(EventSynchronizeTest, givenCallToEventHostSynchronizeWithTimeoutZeroWhenO
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(EventSynchronizeTest, givenMultipleEventsWhenSynchronizingAnyOfThemThenIndexOfSignaledEventIsReturned) {
+    eventDesc.index = 1;
+    auto event2 = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device)));
+    ASSERT_NE(nullptr, event2);
+    event->setUsingContextEndOffset(false);
+    event2->setUsingContextEndOffset(false);
+
+    ze_event_handle_t eventHandles[] = {event->toHandle(), event2->toHandle()};
+    uint32_t signaledEventIndex = std::numeric_limits<uint32_t>::max();
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(2, eventHandles, 0, false, &signaledEventIndex));
+    EXPECT_EQ(std::numeric_limits<uint32_t>::max(), signaledEventIndex);
+
+    *static_cast<uint32_t *>(event2->getHostAddress()) = Event::STATE_SIGNALED;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventHostSynchronizeMultiple(2, eventHandles, std::numeric_limits<uint64_t>::max(), false, &signaledEventIndex));
+    EXPECT_EQ(1u, signaledEventIndex);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(2, eventHandles, 10, true, nullptr));
+
+    *static_cast<uint32_t *>(event->getHostAddress()) = Event::STATE_SIGNALED;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventHostSynchronizeMultiple(2, eventHandles, std::numeric_limits<uint64_t>::max(), true, nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenInvalidArgumentsWhenSynchronizingMultipleEventsThenErrorIsReturned) {
+    ze_event_handle_t eventHandles[] = {event->toHandle(), nullptr};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(0, eventHandles, 0, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(1, nullptr, 0, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(2, eventHandles, 0, true, nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenGpuHangWhenSynchronizingMultipleEventsThenDeviceLostIsReturned) {
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->isGpuHangDetectedReturnValue = true;
+
+    event->csrs[0] = csr.get();
+    event->gpuHangCheckPeriod = 0ms;
+
+    Event *events[] = {event.get()};
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, Event::hostSynchronizeMultiple(1, events, std::numeric_limits<uint64_t>::max(), false, nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenNotSignaledEventWhenQueryingStatusWithoutWaitThenCpuIsNotPaused) {
+    event->setUsingContextEndOffset(false);
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatusNoWait());
+    EXPECT_EQ(oldCount, CpuIntrinsicsTests::pauseCounter.load());
+    EXPECT_EQ(event->getCompletionFieldHostAddress(), event->getCompletionMonitorAddress());
+
+    *static_cast<uint32_t *>(event->getHostAddress()) = Event::STATE_SIGNALED;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatusNoWait());
+}
+
 TEST_F(EventUsedPacketSignalSynchronizeTest, givenInfiniteTimeoutWhenWaitingForNonTimestampEventCompletionThenReturnOnlyAfterAllEventPacketsAreCompleted) {
     constexpr uint32_t packetsInUse = 2;
     event->setPacketsInUse(packetsInUse);
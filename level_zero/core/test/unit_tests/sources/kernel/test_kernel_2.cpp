@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -824,6 +824,69 @@ HWTEST2_F(KernelImmutableDataBindlessTest, givenGlobalVarBufferAndBindlessExplic
     }
 }
 
+HWTEST2_F(KernelImmutableDataBindlessTest, givenGlobalSurfaceStatePresetInBindlessHeapWhenInitializeKernelImmutableDatasThenSurfaceStateIsEncodedOnceAndImplicitArgBindlessOffsetIsPatched, IsAtLeastXeHpgCore) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    HardwareInfo hwInfo = *defaultHwInfo;
+
+    auto device = std::unique_ptr<NEO::MockDevice>(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    device->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->memoryOperationsInterface = std::make_unique<MockMemoryOperations>();
+    auto mockHelper = std::make_unique<MockBindlesHeapsHelper>(device.get(),
+                                                               device->getNumGenericSubDevices() > 1);
+    device->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->bindlessHeapsHelper.reset(mockHelper.release());
+
+    static size_t encodeBufferSurfaceStateCalled{};
+    encodeBufferSurfaceStateCalled = {};
+    struct MockGfxCoreHelper : NEO::GfxCoreHelperHw<FamilyType> {
+        void encodeBufferSurfaceState(EncodeSurfaceStateArgs &args) const override {
+            ++encodeBufferSurfaceStateCalled;
+            NEO::GfxCoreHelperHw<FamilyType>::encodeBufferSurfaceState(args);
+        }
+    };
+
+    RAIIGfxCoreHelperFactory<MockGfxCoreHelper> raii(*device->getExecutionEnvironment()->rootDeviceEnvironments[0]);
+
+    {
+        device->incRefInternal();
+        MockDeviceImp deviceImp(device.get(), device->getExecutionEnvironment());
+
+        uint64_t gpuAddress = 0x1200;
+        void *buffer = reinterpret_cast<void *>(gpuAddress);
+        size_t allocSize = 0x1100;
+        NEO::MockGraphicsAllocation globalConstBuffer(buffer, gpuAddress, allocSize);
+
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        kernelInfo->kernelDescriptor.kernelMetadata.kernelName = ZebinTestData::ValidEmptyProgram<>::kernelName;
+        kernelInfo->kernelDescriptor.kernelAttributes.bufferAddressingMode = NEO::KernelDescriptor::BindlessAndStateless;
+
+        NEO::CrossThreadDataOffset globalConstSurfaceAddressBindlessOffset = 8;
+        kernelInfo->kernelDescriptor.payloadMappings.implicitArgs.globalConstantsSurfaceAddress.bindless = globalConstSurfaceAddressBindlessOffset;
+        kernelInfo->kernelDescriptor.kernelAttributes.numArgsStateful = 1;
+        kernelInfo->kernelDescriptor.kernelAttributes.crossThreadDataSize = 4 * sizeof(uint64_t);
+        kernelInfo->kernelDescriptor.initBindlessOffsetToSurfaceState();
+
+        ASSERT_TRUE(device->getMemoryManager()->allocateBindlessSlot(&globalConstBuffer));
+        KernelImmutableData::setGlobalSurfaceStateInBindlessHeap(&globalConstBuffer, &deviceImp);
+        EXPECT_EQ(1u, encodeBufferSurfaceStateCalled);
+
+        auto &gfxCoreHelper = device->getGfxCoreHelper();
+        auto patchValue = gfxCoreHelper.getBindlessSurfaceExtendedMessageDescriptorValue(static_cast<uint32_t>(globalConstBuffer.getBindlessInfo().surfaceStateOffset));
+
+        for (uint32_t i = 0; i < 2; i++) {
+            auto kernelImmutableData = std::make_unique<KernelImmutableData>(&deviceImp);
+            kernelImmutableData->setGlobalSurfaceStatesInBindlessHeapPreset(true);
+            EXPECT_EQ(ZE_RESULT_SUCCESS, kernelImmutableData->initialize(kernelInfo.get(), &deviceImp, 0, &globalConstBuffer, nullptr, false));
+
+            auto patchLocation = reinterpret_cast<const uint32_t *>(ptrOffset(kernelImmutableData->getCrossThreadDataTemplate(), globalConstSurfaceAddressBindlessOffset));
+            EXPECT_EQ(patchValue, *patchLocation);
+        }
+        EXPECT_EQ(1u, encodeBufferSurfaceStateCalled);
+
+        const auto surfState = reinterpret_cast<RENDER_SURFACE_STATE *>(globalConstBuffer.getBindlessInfo().ssPtr);
+        ASSERT_NE(nullptr, surfState);
+        EXPECT_EQ(gpuAddress, surfState->getSurfaceBaseAddress());
+    }
+}
+
 TEST_F(KernelImpTest, GivenGroupSizeRequiresSwLocalIdsGenerationWhenNextGroupSizeDoesNotRequireSwLocalIdsGenerationThenResetPerThreadDataSizes) {
     Mock<Module> module(device, nullptr);
     Mock<::L0::KernelImp> kernel;
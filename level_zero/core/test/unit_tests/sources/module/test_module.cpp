@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/os_interface/os_inc_base.h"
 #include "shared/source/program/kernel_info.h"
+#include "shared/source/utilities/worker_thread_pool.h"
 #include "shared/test/common/compiler_interface/linker_mock.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -5038,6 +5039,53 @@ TEST_F(ModuleKernelImmDatasTest, givenDeviceOOMWhenMemoryManagerFailsToAllocateM
     device->getNEODevice()->getIsaPoolAllocator().freeSharedIsaAllocation(alloc);
 };
 
+TEST_F(ModuleKernelImmDatasTest, givenModuleBuildThreadsCountSetWhenInitializingModuleThenAllKernelImmutableDatasAreInitializedAndStageTimesArePrinted) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.FailBuildProgramWithStatefulAccess.set(0);
+    debugManager.flags.ModuleBuildThreadsCount.set(4);
+    debugManager.flags.PrintModuleBuildStageTimes.set(1);
+
+    auto zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+    const auto &src = zebinData->storage;
+
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(src.data());
+    moduleDesc.inputSize = src.size();
+
+    ModuleBuildLog *moduleBuildLog = nullptr;
+    module.reset(nullptr);
+    auto module = std::make_unique<Module>(device, moduleBuildLog, ModuleType::user);
+    ASSERT_NE(nullptr, module.get());
+
+    testing::internal::CaptureStdout();
+    auto result = module->initialize(&moduleDesc, neoDevice);
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    const auto &kernelInfos = module->getTranslationUnit()->programInfo.kernelInfos;
+    ASSERT_EQ(kernelInfos.size(), module->kernelImmDatas.size());
+    for (size_t i = 0; i < kernelInfos.size(); i++) {
+        ASSERT_NE(nullptr, module->kernelImmDatas[i]);
+        EXPECT_EQ(kernelInfos[i], module->kernelImmDatas[i]->getKernelInfo());
+    }
+    EXPECT_TRUE(module->getTranslationUnit()->deviceInfoConstants.has_value());
+
+    auto workers = neoDevice->getExecutionEnvironment()->initializeModuleBuildWorkers();
+    ASSERT_NE(nullptr, workers);
+    EXPECT_EQ(3u, workers->getWorkersCount());
+
+    auto secondModule = std::make_unique<Module>(device, moduleBuildLog, ModuleType::user);
+    testing::internal::CaptureStdout();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, secondModule->initialize(&moduleDesc, neoDevice));
+    testing::internal::GetCapturedStdout();
+    EXPECT_EQ(workers, neoDevice->getExecutionEnvironment()->initializeModuleBuildWorkers());
+
+    EXPECT_NE(std::string::npos, output.find("Module build stage translation"));
+    EXPECT_NE(std::string::npos, output.find("Module build stage kernel immutable data"));
+    EXPECT_NE(std::string::npos, output.find("Module build stage linking"));
+}
+
 using MultiTileModuleTest = Test<MultiTileModuleFixture>;
 HWTEST2_F(MultiTileModuleTest, givenTwoKernelPrivateAllocsWhichExceedGlobalMemSizeOfSingleTileButNotEntireGlobalMemSizeThenPrivateMemoryShouldBeAllocatedPerDispatch, MatchAny) {
     auto devInfo = device->getNEODevice()->getDeviceInfo();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,6 +18,16 @@ zexEventGetDeviceAddress(
     uint64_t *completionValue,
     uint64_t *address);
 
+// Waits on host until all (waitAll set) or any of events is signaled.
+// With waitAll not set, index of signaled event is returned in pSignaledEventIndex (optional).
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    uint64_t timeout,
+    ze_bool_t waitAll,
+    uint32_t *pSignaledEventIndex);
+
 // deprecated
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zexCounterBasedEventCreate(
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -76,6 +76,17 @@ ze_result_t LinuxEngineImp::getActivity(zes_engine_stats_t *pStats) {
         NEO::printDebugString(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Error@ %s(): as fileDescriptor value = %d it's returning error:0x%x \n", __FUNCTION__, fd, ZE_RESULT_ERROR_UNSUPPORTED_FEATURE);
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
+    if (pTelemetrySampler != nullptr) {
+        if (telemetryCounterId == SysmanTelemetrySampler::invalidCounterId) {
+            telemetryCounterId = pTelemetrySampler->registerPmuCounter(fd);
+        }
+        SysmanTelemetrySampler::Sample sample;
+        if (pTelemetrySampler->readCounter(telemetryCounterId, sample)) {
+            pStats->activeTime = sample.values[0] / microSecondsToNanoSeconds;
+            pStats->timestamp = sample.values[1] / microSecondsToNanoSeconds;
+            return ZE_RESULT_SUCCESS;
+        }
+    }
     uint64_t data[2] = {};
     auto ret = pPmuInterface->pmuRead(static_cast<int>(fd), data, sizeof(data));
     if (ret < 0) {
@@ -112,10 +123,21 @@ LinuxEngineImp::LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uin
     pDrm = pLinuxSysmanImp->getDrm();
     pDevice = pLinuxSysmanImp->getSysmanDeviceImp();
     pPmuInterface = pLinuxSysmanImp->getPmuInterface();
+    pTelemetrySampler = pLinuxSysmanImp->getTelemetrySampler();
     pSysmanKmdInterface = pLinuxSysmanImp->getSysmanKmdInterface();
     init();
 }
 
+LinuxEngineImp::~LinuxEngineImp() {
+    if (pTelemetrySampler != nullptr) {
+        pTelemetrySampler->unregisterCounter(telemetryCounterId);
+    }
+    if (fd != -1) {
+        close(static_cast<int>(fd));
+        fd = -1;
+    }
+}
+
 std::unique_ptr<OsEngine> OsEngine::create(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance, uint32_t subDeviceId, ze_bool_t onSubDevice) {
     std::unique_ptr<LinuxEngineImp> pLinuxEngineImp = std::make_unique<LinuxEngineImp>(pOsSysman, type, engineInstance, subDeviceId, onSubDevice);
     return pLinuxEngineImp;
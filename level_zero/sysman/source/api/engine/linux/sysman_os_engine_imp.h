@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 
 #include "level_zero/sysman/source/api/engine/sysman_os_engine.h"
 #include "level_zero/sysman/source/device/sysman_device_imp.h"
+#include "level_zero/sysman/source/shared/linux/sysman_telemetry_sampler.h"
 
 #include <unistd.h>
 
@@ -31,18 +32,14 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
     static zes_engine_group_t getGroupFromEngineType(zes_engine_group_t type);
     LinuxEngineImp() = default;
     LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance, uint32_t subDeviceId, ze_bool_t onSubDevice);
-    ~LinuxEngineImp() override {
-        if (fd != -1) {
-            close(static_cast<int>(fd));
-            fd = -1;
-        }
-    }
+    ~LinuxEngineImp() override;
 
   protected:
     SysmanKmdInterface *pSysmanKmdInterface = nullptr;
     zes_engine_group_t engineGroup = ZES_ENGINE_GROUP_ALL;
     uint32_t engineInstance = 0;
     PmuInterface *pPmuInterface = nullptr;
+    SysmanTelemetrySampler *pTelemetrySampler = nullptr;
     NEO::Drm *pDrm = nullptr;
     SysmanDeviceImp *pDevice = nullptr;
     uint32_t subDeviceId = 0;
@@ -51,6 +48,7 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
   private:
     void init();
     int64_t fd = -1;
+    uint32_t telemetryCounterId = SysmanTelemetrySampler::invalidCounterId;
 };
 
 } // namespace Sysman
@@ -270,6 +270,10 @@ ze_result_t LinuxFrequencyImp::setMax(double max) {
 
 ze_result_t LinuxFrequencyImp::getRequest(double &request) {
     double freqVal = 0;
+    if (readSampledFrequency(requestCounterId, requestFreqFile, freqVal)) {
+        request = freqVal;
+        return ZE_RESULT_SUCCESS;
+    }
 
     ze_result_t result = pSysfsAccess->read(requestFreqFile, freqVal);
     if (ZE_RESULT_SUCCESS != result) {
@@ -307,6 +311,10 @@ ze_result_t LinuxFrequencyImp::getTdp(double &tdp) {
 
 ze_result_t LinuxFrequencyImp::getActual(double &actual) {
     double freqVal = 0;
+    if (readSampledFrequency(actualCounterId, actualFreqFile, freqVal)) {
+        actual = freqVal;
+        return ZE_RESULT_SUCCESS;
+    }
 
     ze_result_t result = pSysfsAccess->read(actualFreqFile, freqVal);
     if (ZE_RESULT_SUCCESS != result) {
@@ -369,6 +377,16 @@ ze_result_t LinuxFrequencyImp::getMinVal(double &minVal) {
     return ZE_RESULT_SUCCESS;
 }
 
+bool LinuxFrequencyImp::readSampledFrequency(uint32_t &counterId, const std::string &file, double &freqVal) {
+    if (pTelemetrySampler == nullptr) {
+        return false;
+    }
+    if (counterId == SysmanTelemetrySampler::invalidCounterId) {
+        counterId = pTelemetrySampler->registerSysfsCounter(file, SysmanTelemetrySampler::CounterType::sysfsDouble);
+    }
+    return pTelemetrySampler->readCounter(counterId, freqVal);
+}
+
 void LinuxFrequencyImp::getCurrentVoltage(double &voltage) {
     voltage = -1.0;
 }
@@ -410,9 +428,17 @@ LinuxFrequencyImp::LinuxFrequencyImp(OsSysman *pOsSysman, ze_bool_t onSubdevice,
     pSysfsAccess = &pLinuxSysmanImp->getSysfsAccess();
     pSysmanProductHelper = pLinuxSysmanImp->getSysmanProductHelper();
     pSysmanKmdInterface = pLinuxSysmanImp->getSysmanKmdInterface();
+    pTelemetrySampler = pLinuxSysmanImp->getTelemetrySampler();
     init();
 }
 
+LinuxFrequencyImp::~LinuxFrequencyImp() {
+    if (pTelemetrySampler != nullptr) {
+        pTelemetrySampler->unregisterCounter(requestCounterId);
+        pTelemetrySampler->unregisterCounter(actualCounterId);
+    }
+}
+
 OsFrequency *OsFrequency::create(OsSysman *pOsSysman, ze_bool_t onSubdevice, uint32_t subdeviceId, zes_freq_domain_t frequencyDomainNumber) {
     LinuxFrequencyImp *pLinuxFrequencyImp = new LinuxFrequencyImp(pOsSysman, onSubdevice, subdeviceId, frequencyDomainNumber);
     return static_cast<OsFrequency *>(pLinuxFrequencyImp);
@@ -10,6 +10,7 @@
 
 #include "level_zero/sysman/source/api/frequency/sysman_frequency_imp.h"
 #include "level_zero/sysman/source/api/frequency/sysman_os_frequency.h"
+#include "level_zero/sysman/source/shared/linux/sysman_telemetry_sampler.h"
 
 #include "igfxfmid.h"
 namespace L0 {
@@ -41,12 +42,13 @@ class LinuxFrequencyImp : public OsFrequency, NEO::NonCopyableOrMovableClass {
     ze_result_t setOcTjMax(double ocTjMax) override;
     LinuxFrequencyImp() = default;
     LinuxFrequencyImp(OsSysman *pOsSysman, ze_bool_t onSubdevice, uint32_t subdeviceId, zes_freq_domain_t frequencyDomainNumber);
-    ~LinuxFrequencyImp() override = default;
+    ~LinuxFrequencyImp() override;
 
   protected:
     LinuxSysmanImp *pLinuxSysmanImp = nullptr;
     SysmanKmdInterface *pSysmanKmdInterface = nullptr;
     SysFsAccessInterface *pSysfsAccess = nullptr;
+    SysmanTelemetrySampler *pTelemetrySampler = nullptr;
     ze_result_t getMin(double &min);
     ze_result_t setMin(double min);
     ze_result_t getMax(double &max);
@@ -76,7 +78,10 @@ class LinuxFrequencyImp : public OsFrequency, NEO::NonCopyableOrMovableClass {
     uint32_t subdeviceId = 0;
     zes_freq_domain_t frequencyDomainNumber = ZES_FREQ_DOMAIN_GPU;
     SysmanProductHelper *pSysmanProductHelper = nullptr;
+    uint32_t requestCounterId = SysmanTelemetrySampler::invalidCounterId;
+    uint32_t actualCounterId = SysmanTelemetrySampler::invalidCounterId;
     void init();
+    bool readSampledFrequency(uint32_t &counterId, const std::string &file, double &freqVal);
 };
 
 } // namespace Sysman
@@ -111,8 +111,19 @@ ze_result_t LinuxPowerImp::getPmtEnergyCounter(zes_power_energy_counter_t *pEner
 }
 
 ze_result_t LinuxPowerImp::getEnergyCounter(zes_power_energy_counter_t *pEnergy) {
-    pEnergy->timestamp = SysmanDevice::getSysmanTimestamp();
     std::string energyCounterNode = intelGraphicsHwmonDir + "/" + pSysmanKmdInterface->getSysfsFilePath(SysfsName::sysfsNameEnergyCounterNode, subdeviceId, false);
+    if (pTelemetrySampler != nullptr && !intelGraphicsHwmonDir.empty()) {
+        if (energyCounterId == SysmanTelemetrySampler::invalidCounterId) {
+            energyCounterId = pTelemetrySampler->registerSysfsCounter(energyCounterNode, SysmanTelemetrySampler::CounterType::sysfsUint64);
+        }
+        SysmanTelemetrySampler::Sample sample;
+        if (pTelemetrySampler->readCounter(energyCounterId, sample)) {
+            pEnergy->energy = sample.values[0];
+            pEnergy->timestamp = sample.timestamp;
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+    pEnergy->timestamp = SysmanDevice::getSysmanTimestamp();
     ze_result_t result = pSysfsAccess->read(energyCounterNode, pEnergy->energy);
     if (result != ZE_RESULT_SUCCESS) {
         if (isTelemetrySupportAvailable) {
@@ -338,6 +349,13 @@ LinuxPowerImp::LinuxPowerImp(OsSysman *pOsSysman, ze_bool_t onSubdevice, uint32_
     pSysmanKmdInterface = pLinuxSysmanImp->getSysmanKmdInterface();
     pSysfsAccess = pSysmanKmdInterface->getSysFsAccess();
     pSysmanProductHelper = pLinuxSysmanImp->getSysmanProductHelper();
+    pTelemetrySampler = pLinuxSysmanImp->getTelemetrySampler();
+}
+
+LinuxPowerImp::~LinuxPowerImp() {
+    if (pTelemetrySampler != nullptr) {
+        pTelemetrySampler->unregisterCounter(energyCounterId);
+    }
 }
 
 std::vector<zes_power_domain_t> OsPower::getNumberOfPowerDomainsSupported(OsSysman *pOsSysman) {
@@ -9,6 +9,7 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 
 #include "level_zero/sysman/source/api/power/sysman_os_power.h"
+#include "level_zero/sysman/source/shared/linux/sysman_telemetry_sampler.h"
 
 #include <memory>
 #include <mutex>
@@ -38,13 +39,14 @@ class LinuxPowerImp : public OsPower, NEO::NonCopyableOrMovableClass {
     ze_result_t getPmtEnergyCounter(zes_power_energy_counter_t *pEnergy);
     LinuxPowerImp(OsSysman *pOsSysman, ze_bool_t onSubdevice, uint32_t subdeviceId, zes_power_domain_t powerDomain);
     LinuxPowerImp() = default;
-    ~LinuxPowerImp() override = default;
+    ~LinuxPowerImp() override;
 
   protected:
     LinuxSysmanImp *pLinuxSysmanImp = nullptr;
     SysFsAccessInterface *pSysfsAccess = nullptr;
     SysmanKmdInterface *pSysmanKmdInterface = nullptr;
     SysmanProductHelper *pSysmanProductHelper = nullptr;
+    SysmanTelemetrySampler *pTelemetrySampler = nullptr;
     bool isTelemetrySupportAvailable = false;
 
   private:
@@ -57,6 +59,7 @@ class LinuxPowerImp : public OsPower, NEO::NonCopyableOrMovableClass {
     uint32_t subdeviceId = 0;
     uint32_t powerLimitCount = 0;
     zes_power_domain_t powerDomain = ZES_POWER_DOMAIN_CARD;
+    uint32_t energyCounterId = SysmanTelemetrySampler::invalidCounterId;
 
     ze_result_t getErrorCode(ze_result_t result) {
         if (result == ZE_RESULT_ERROR_NOT_AVAILABLE) {
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/sysman/source/shared/linux/sysman_telemetry_sampler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include "level_zero/sysman/source/device/sysman_device.h"
+#include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu.h"
+#include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
+
+#include <chrono>
+
+namespace L0 {
+namespace Sysman {
+
+SysmanTelemetrySampler::SysmanTelemetrySampler(SysFsAccessInterface *pSysfsAccess, PmuInterface *pPmuInterface) : pSysfsAccess(pSysfsAccess), pPmuInterface(pPmuInterface) {
+    if (NEO::debugManager.flags.SysmanTelemetrySamplerPeriodMs.get() > 0) {
+        samplingPeriodMs = static_cast<uint32_t>(NEO::debugManager.flags.SysmanTelemetrySamplerPeriodMs.get());
+    }
+}
+
+SysmanTelemetrySampler::~SysmanTelemetrySampler() {
+    stopThread();
+}
+
+void SysmanTelemetrySampler::startThread() {
+    samplerThread = NEO::Thread::createFunc(run, reinterpret_cast<void *>(this));
+}
+
+void SysmanTelemetrySampler::stopThread() {
+    if (!samplerThread) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(threadMutex);
+        keepRunning = false;
+    }
+    threadCondVar.notify_one();
+    samplerThread->join();
+    samplerThread.reset();
+}
+
+void *SysmanTelemetrySampler::run(void *self) {
+    auto sampler = reinterpret_cast<SysmanTelemetrySampler *>(self);
+    std::unique_lock<std::mutex> lock(sampler->threadMutex);
+    while (sampler->keepRunning) {
+        lock.unlock();
+        sampler->samplePass();
+        lock.lock();
+        sampler->threadCondVar.wait_for(lock, std::chrono::milliseconds(sampler->samplingPeriodMs), [&sampler]() { return !sampler->keepRunning; });
+    }
+    return nullptr;
+}
+
+uint32_t SysmanTelemetrySampler::registerSysfsCounter(const std::string &file, CounterType type) {
+    Counter counter;
+    counter.file = file;
+    counter.type = type;
+    return registerCounter(counter);
+}
+
+uint32_t SysmanTelemetrySampler::registerPmuCounter(int64_t fd) {
+    if (fd < 0) {
+        return invalidCounterId;
+    }
+    Counter counter;
+    counter.fd = fd;
+    counter.type = CounterType::pmu;
+    return registerCounter(counter);
+}
+
+uint32_t SysmanTelemetrySampler::registerCounter(const Counter &counter) {
+    std::lock_guard<std::mutex> lock(countersMutex);
+    for (uint32_t counterId = 0; counterId < maxCountersCount; counterId++) {
+        if (!counters[counterId].registered) {
+            counters[counterId] = counter;
+            counters[counterId].registered = true;
+            return counterId;
+        }
+    }
+    return invalidCounterId;
+}
+
+void SysmanTelemetrySampler::unregisterCounter(uint32_t counterId) {
+    if (counterId >= maxCountersCount) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(countersMutex);
+    counters[counterId] = {};
+    beginSnapshotUpdate();
+    snapshot[counterId].valid.store(false, std::memory_order_relaxed);
+    endSnapshotUpdate();
+}
+
+bool SysmanTelemetrySampler::sampleCounter(const Counter &counter, uint64_t timestamp, Sample &sample) {
+    sample.timestamp = timestamp;
+    switch (counter.type) {
+    case CounterType::sysfsUint64:
+        return pSysfsAccess->read(counter.file, sample.values[0]) == ZE_RESULT_SUCCESS;
+    case CounterType::sysfsDouble: {
+        double value = 0;
+        if (pSysfsAccess->read(counter.file, value) != ZE_RESULT_SUCCESS) {
+            return false;
+        }
+        memcpy_s(&sample.values[0], sizeof(sample.values[0]), &value, sizeof(value));
+        return true;
+    }
+    case CounterType::pmu:
+        return pPmuInterface->pmuRead(static_cast<int>(counter.fd), sample.values, sizeof(sample.values)) >= 0;
+    }
+    return false;
+}
+
+void SysmanTelemetrySampler::samplePass() {
+    std::lock_guard<std::mutex> lock(countersMutex);
+
+    // all reads are done before snapshot is opened for update, so readers never spin on syscalls
+    Sample samples[maxCountersCount];
+    bool sampled[maxCountersCount] = {};
+    auto timestamp = SysmanDevice::getSysmanTimestamp();
+    for (uint32_t counterId = 0; counterId < maxCountersCount; counterId++) {
+        if (counters[counterId].registered) {
+            sampled[counterId] = sampleCounter(counters[counterId], timestamp, samples[counterId]);
+        }
+    }
+
+    beginSnapshotUpdate();
+    for (uint32_t counterId = 0; counterId < maxCountersCount; counterId++) {
+        auto &entry = snapshot[counterId];
+        entry.values[0].store(samples[counterId].values[0], std::memory_order_relaxed);
+        entry.values[1].store(samples[counterId].values[1], std::memory_order_relaxed);
+        entry.timestamp.store(samples[counterId].timestamp, std::memory_order_relaxed);
+        entry.valid.store(sampled[counterId], std::memory_order_relaxed);
+    }
+    endSnapshotUpdate();
+}
+
+void SysmanTelemetrySampler::beginSnapshotUpdate() {
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void SysmanTelemetrySampler::endSnapshotUpdate() {
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+bool SysmanTelemetrySampler::readCounter(uint32_t counterId, Sample &sample) const {
+    if (counterId >= maxCountersCount) {
+        return false;
+    }
+    const auto &entry = snapshot[counterId];
+    while (true) {
+        auto sequenceBefore = sequence.load(std::memory_order_acquire);
+        if ((sequenceBefore & 1u) == 0u) {
+            auto valid = entry.valid.load(std::memory_order_relaxed);
+            sample.values[0] = entry.values[0].load(std::memory_order_relaxed);
+            sample.values[1] = entry.values[1].load(std::memory_order_relaxed);
+            sample.timestamp = entry.timestamp.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == sequenceBefore) {
+                return valid;
+            }
+        }
+        NEO::CpuIntrinsics::pause();
+    }
+}
+
+bool SysmanTelemetrySampler::readCounter(uint32_t counterId, double &value) const {
+    Sample sample;
+    if (!readCounter(counterId, sample)) {
+        return false;
+    }
+    memcpy_s(&value, sizeof(value), &sample.values[0], sizeof(sample.values[0]));
+    return true;
+}
+
+} // namespace Sysman
+} // namespace L0
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <level_zero/zes_api.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace NEO {
+class Thread;
+} // namespace NEO
+
+namespace L0 {
+namespace Sysman {
+
+class SysFsAccessInterface;
+class PmuInterface;
+
+// Reads registered sysfs and PMU counters of a device in one pass on a background thread.
+// Every pass is published as a seqlock protected snapshot, so queries return the last
+// sampled values without any syscalls. Counters are registered by their first query.
+class SysmanTelemetrySampler : NEO::NonCopyableOrMovableClass {
+  public:
+    enum class CounterType : uint32_t {
+        sysfsUint64,
+        sysfsDouble,
+        pmu
+    };
+
+    struct Sample {
+        // sysfs counters use values[0] (double counters are stored bitwise), PMU counters return both values read from event fd
+        uint64_t values[2] = {};
+        uint64_t timestamp = 0u;
+    };
+
+    static constexpr uint32_t invalidCounterId = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t maxCountersCount = 64u;
+    static constexpr uint32_t defaultSamplingPeriodMs = 50u;
+
+    SysmanTelemetrySampler(SysFsAccessInterface *pSysfsAccess, PmuInterface *pPmuInterface);
+    virtual ~SysmanTelemetrySampler();
+
+    MOCKABLE_VIRTUAL void startThread();
+    void stopThread();
+
+    uint32_t registerSysfsCounter(const std::string &file, CounterType type);
+    uint32_t registerPmuCounter(int64_t fd);
+    void unregisterCounter(uint32_t counterId);
+
+    bool readCounter(uint32_t counterId, Sample &sample) const;
+    bool readCounter(uint32_t counterId, double &value) const;
+
+    uint32_t getSamplingPeriodMs() const { return samplingPeriodMs; }
+
+  protected:
+    struct Counter {
+        std::string file;
+        int64_t fd = -1;
+        CounterType type = CounterType::sysfsUint64;
+        bool registered = false;
+    };
+
+    struct SnapshotEntry {
+        std::atomic<uint64_t> values[2] = {};
+        std::atomic<uint64_t> timestamp{0u};
+        std::atomic<bool> valid{false};
+    };
+
+    static void *run(void *self);
+    uint32_t registerCounter(const Counter &counter);
+    bool sampleCounter(const Counter &counter, uint64_t timestamp, Sample &sample);
+    MOCKABLE_VIRTUAL void samplePass();
+
+    void beginSnapshotUpdate();
+    void endSnapshotUpdate();
+
+    SysFsAccessInterface *pSysfsAccess = nullptr;
+    PmuInterface *pPmuInterface = nullptr;
+
+    std::mutex countersMutex;
+    Counter counters[maxCountersCount];
+
+    std::atomic<uint64_t> sequence{0u};
+    SnapshotEntry snapshot[maxCountersCount];
+
+    std::unique_ptr<NEO::Thread> samplerThread;
+    std::mutex threadMutex;
+    std::condition_variable threadCondVar;
+    bool keepRunning = true;
+    uint32_t samplingPeriodMs = defaultSamplingPeriodMs;
+};
+
+} // namespace Sysman
+} // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu.h"
 #include "level_zero/sysman/source/shared/linux/product_helper/sysman_product_helper.h"
 #include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
+#include "level_zero/sysman/source/shared/linux/sysman_telemetry_sampler.h"
 
 namespace L0 {
 namespace Sysman {
@@ -72,6 +73,10 @@ ze_result_t LinuxSysmanImp::init() {
 
     osInterface.getDriverModel()->as<NEO::Drm>()->cleanup();
     pPmuInterface = PmuInterface::create(this);
+    if (NEO::debugManager.flags.EnableSysmanTelemetrySampler.get() == 1) {
+        pTelemetrySampler = std::make_unique<SysmanTelemetrySampler>(pSysfsAccess, pPmuInterface);
+        pTelemetrySampler->startThread();
+    }
     return result;
 }
 
@@ -206,6 +211,7 @@ void LinuxSysmanImp::releaseFwUtilInterface() {
 }
 
 LinuxSysmanImp::~LinuxSysmanImp() {
+    pTelemetrySampler.reset();
     if (nullptr != pPmuInterface) {
         delete pPmuInterface;
         pPmuInterface = nullptr;
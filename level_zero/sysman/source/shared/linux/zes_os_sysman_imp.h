@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@ class SysmanKmdInterface;
 class FsAccessInterface;
 class SysFsAccessInterface;
 class ProcFsAccessInterface;
+class SysmanTelemetrySampler;
 
 class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
   public:
@@ -44,6 +45,7 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
 
     FirmwareUtil *getFwUtilInterface();
     PmuInterface *getPmuInterface() { return pPmuInterface; }
+    SysmanTelemetrySampler *getTelemetrySampler() { return pTelemetrySampler.get(); }
     FsAccessInterface &getFsAccess();
     ProcFsAccessInterface &getProcfsAccess();
     SysFsAccessInterface &getSysfsAccess();
@@ -88,6 +90,7 @@ class LinuxSysmanImp : public OsSysman, NEO::NonCopyableOrMovableClass {
     uint32_t subDeviceCount = 0;
     FirmwareUtil *pFwUtilInterface = nullptr;
     PmuInterface *pPmuInterface = nullptr;
+    std::unique_ptr<SysmanTelemetrySampler> pTelemetrySampler;
     std::string rootPath;
     void releaseFwUtilInterface();
     uint32_t memType = unknownMemoryType;
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "level_zero/sysman/source/shared/linux/pmu/sysman_pmu.h"
+#include "level_zero/sysman/source/shared/linux/sysman_fs_access_interface.h"
+#include "level_zero/sysman/source/shared/linux/sysman_telemetry_sampler.h"
+
+#include "gtest/gtest.h"
+
+#include <map>
+
+namespace L0 {
+namespace Sysman {
+namespace ult {
+
+struct MockSamplerSysfsAccess : public L0::Sysman::SysFsAccessInterface {
+    ze_result_t read(const std::string file, uint64_t &val) override {
+        readCalls++;
+        auto it = uint64Values.find(file);
+        if (it == uint64Values.end()) {
+            return ZE_RESULT_ERROR_NOT_AVAILABLE;
+        }
+        val = it->second;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t read(const std::string file, double &val) override {
+        readCalls++;
+        auto it = doubleValues.find(file);
+        if (it == doubleValues.end()) {
+            return ZE_RESULT_ERROR_NOT_AVAILABLE;
+        }
+        val = it->second;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    std::map<std::string, uint64_t> uint64Values;
+    std::map<std::string, double> doubleValues;
+    uint32_t readCalls = 0u;
+};
+
+struct MockSamplerPmuInterface : public L0::Sysman::PmuInterface {
+    int64_t pmuInterfaceOpen(uint64_t config, int group, uint32_t format) override {
+        return -1;
+    }
+
+    int pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) override {
+        readCalls++;
+        if (readFailure) {
+            return -1;
+        }
+        data[0] = activeTime;
+        data[1] = timestamp;
+        return 0;
+    }
+
+    uint64_t activeTime = 0u;
+    uint64_t timestamp = 0u;
+    uint32_t readCalls = 0u;
+    bool readFailure = false;
+};
+
+struct MockSysmanTelemetrySampler : public L0::Sysman::SysmanTelemetrySampler {
+    using SysmanTelemetrySampler::samplePass;
+    using SysmanTelemetrySampler::samplerThread;
+    using SysmanTelemetrySampler::sequence;
+    using SysmanTelemetrySampler::SysmanTelemetrySampler;
+};
+
+TEST(SysmanTelemetrySamplerTest, givenRegisteredCountersWhenSamplePassIsDoneThenSnapshotIsReadWithoutSyscalls) {
+    MockSamplerSysfsAccess sysfsAccess;
+    MockSamplerPmuInterface pmuInterface;
+    sysfsAccess.uint64Values["energy"] = 1234u;
+    sysfsAccess.doubleValues["freq"] = 1100.0;
+    pmuInterface.activeTime = 500u;
+    pmuInterface.timestamp = 2000u;
+
+    MockSysmanTelemetrySampler sampler(&sysfsAccess, &pmuInterface);
+    auto energyId = sampler.registerSysfsCounter("energy", SysmanTelemetrySampler::CounterType::sysfsUint64);
+    auto freqId = sampler.registerSysfsCounter("freq", SysmanTelemetrySampler::CounterType::sysfsDouble);
+    auto pmuId = sampler.registerPmuCounter(5);
+    EXPECT_NE(SysmanTelemetrySampler::invalidCounterId, energyId);
+    EXPECT_NE(SysmanTelemetrySampler::invalidCounterId, freqId);
+    EXPECT_NE(SysmanTelemetrySampler::invalidCounterId, pmuId);
+    EXPECT_EQ(SysmanTelemetrySampler::invalidCounterId, sampler.registerPmuCounter(-1));
+
+    SysmanTelemetrySampler::Sample sample;
+    EXPECT_FALSE(sampler.readCounter(energyId, sample));
+
+    sampler.samplePass();
+    EXPECT_EQ(2u, sysfsAccess.readCalls);
+    EXPECT_EQ(1u, pmuInterface.readCalls);
+    EXPECT_EQ(0u, sampler.sequence.load() % 2);
+
+    EXPECT_TRUE(sampler.readCounter(energyId, sample));
+    EXPECT_EQ(1234u, sample.values[0]);
+    EXPECT_NE(0u, sample.timestamp);
+
+    double freq = 0.0;
+    EXPECT_TRUE(sampler.readCounter(freqId, freq));
+    EXPECT_EQ(1100.0, freq);
+
+    EXPECT_TRUE(sampler.readCounter(pmuId, sample));
+    EXPECT_EQ(500u, sample.values[0]);
+    EXPECT_EQ(2000u, sample.values[1]);
+
+    EXPECT_EQ(2u, sysfsAccess.readCalls);
+    EXPECT_EQ(1u, pmuInterface.readCalls);
+    EXPECT_FALSE(sampler.readCounter(SysmanTelemetrySampler::invalidCounterId, sample));
+}
+
+TEST(SysmanTelemetrySamplerTest, givenCounterFailingToReadWhenSamplePassIsDoneThenSampleIsNotValid) {
+    MockSamplerSysfsAccess sysfsAccess;
+    MockSamplerPmuInterface pmuInterface;
+    pmuInterface.readFailure = true;
+
+    MockSysmanTelemetrySampler sampler(&sysfsAccess, &pmuInterface);
+    auto energyId = sampler.registerSysfsCounter("energy", SysmanTelemetrySampler::CounterType::sysfsUint64);
+    auto freqId = sampler.registerSysfsCounter("freq", SysmanTelemetrySampler::CounterType::sysfsDouble);
+    auto pmuId = sampler.registerPmuCounter(5);
+    sampler.samplePass();
+
+    SysmanTelemetrySampler::Sample sample;
+    double freq = 0.0;
+    EXPECT_FALSE(sampler.readCounter(energyId, sample));
+    EXPECT_FALSE(sampler.readCounter(freqId, freq));
+    EXPECT_FALSE(sampler.readCounter(pmuId, sample));
+}
+
+TEST(SysmanTelemetrySamplerTest, givenUnregisteredCounterWhenSamplePassIsDoneThenCounterIsNotReadAndSlotIsReused) {
+    MockSamplerSysfsAccess sysfsAccess;
+    MockSamplerPmuInterface pmuInterface;
+    sysfsAccess.uint64Values["energy"] = 1u;
+
+    MockSysmanTelemetrySampler sampler(&sysfsAccess, &pmuInterface);
+    auto energyId = sampler.registerSysfsCounter("energy", SysmanTelemetrySampler::CounterType::sysfsUint64);
+    sampler.samplePass();
+    SysmanTelemetrySampler::Sample sample;
+    EXPECT_TRUE(sampler.readCounter(energyId, sample));
+
+    sampler.unregisterCounter(energyId);
+    sampler.unregisterCounter(SysmanTelemetrySampler::invalidCounterId);
+    EXPECT_FALSE(sampler.readCounter(energyId, sample));
+    sampler.samplePass();
+    EXPECT_EQ(1u, sysfsAccess.readCalls);
+
+    EXPECT_EQ(energyId, sampler.registerPmuCounter(5));
+    for (uint32_t i = 1; i < SysmanTelemetrySampler::maxCountersCount; i++) {
+        EXPECT_NE(SysmanTelemetrySampler::invalidCounterId, sampler.registerPmuCounter(5));
+    }
+    EXPECT_EQ(SysmanTelemetrySampler::invalidCounterId, sampler.registerPmuCounter(5));
+}
+
+TEST(SysmanTelemetrySamplerTest, givenSamplerThreadStartedWhenCountersAreRegisteredThenSnapshotIsPublishedPeriodically) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SysmanTelemetrySamplerPeriodMs.set(1);
+    MockSamplerSysfsAccess sysfsAccess;
+    MockSamplerPmuInterface pmuInterface;
+    pmuInterface.activeTime = 7u;
+
+    MockSysmanTelemetrySampler sampler(&sysfsAccess, &pmuInterface);
+    EXPECT_EQ(1u, sampler.getSamplingPeriodMs());
+    auto pmuId = sampler.registerPmuCounter(5);
+    sampler.startThread();
+    EXPECT_NE(nullptr, sampler.samplerThread.get());
+
+    SysmanTelemetrySampler::Sample sample;
+    while (!sampler.readCounter(pmuId, sample)) {
+    }
+    EXPECT_EQ(7u, sample.values[0]);
+
+    sampler.stopThread();
+    EXPECT_EQ(nullptr, sampler.samplerThread.get());
+    sampler.stopThread();
+}
+
+} // namespace ult
+} // namespace Sysman
+} // namespace L0
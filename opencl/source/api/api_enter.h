@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,8 @@
 
 #include "shared/source/utilities/logger.h"
 #include "shared/source/utilities/perf_profiler.h"
+#include "shared/source/utilities/perf_trace.h"
 
-#define API_ENTER(retValPointer) \
-    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
+#define API_ENTER(retValPointer)                                                                                                       \
+    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer); \
+    NEO::PerfTraceScope perfTraceScopeForSingleCall(NEO::PerfTraceEventType::api, __FUNCTION__)
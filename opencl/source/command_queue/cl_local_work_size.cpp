@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/local_work_size.h"
+#include "shared/source/helpers/work_group_size_autotuner.h"
 #include "shared/source/utilities/logger.h"
 
 #include "opencl/source/context/context.h"
@@ -55,6 +56,19 @@ Vec3<size_t> generateWorkgroupsNumber(const DispatchInfo &dispatchInfo) {
     return generateWorkgroupsNumber(dispatchInfo.getGWS(), dispatchInfo.getLocalWorkgroupSize());
 }
 
+Vec3<size_t> generateAutotunedWorkgroupSize(const DispatchInfo &dispatchInfo, WorkGroupSizeAutotuner &autotuner, bool canSample,
+                                            WorkGroupSizeAutotunerKey &outKey, bool &sampleRequested) {
+    auto kernel = dispatchInfo.getKernel();
+    auto gws = canonizeWorkgroup(dispatchInfo.getGWS());
+    auto heuristicLws = computeWorkgroupSize(dispatchInfo);
+    outKey = WorkGroupSizeAutotuner::createKey(kernel->getWorkGroupSizeAutotunerKernelHash(), gws, dispatchInfo.getDim(), kernel->getSlmTotalSize());
+    auto lws = autotuner.selectWorkGroupSize(outKey, canonizeWorkgroup(heuristicLws), gws, dispatchInfo.getDim(), kernel->getMaxKernelWorkGroupSize(),
+                                             static_cast<uint32_t>(kernel->getKernelInfo().getMaxSimdSize()), canSample, sampleRequested);
+    DBG_LOG(PrintLWSSizes, "Input GWS enqueueBlocked", gws.x, gws.y, gws.z,
+            " Autotuned LWS", lws.x, lws.y, lws.z);
+    return lws;
+}
+
 void provideLocalWorkGroupSizeHints(Context *context, const DispatchInfo &dispatchInfo) {
     if (context != nullptr && context->isProvidingPerformanceHints() && dispatchInfo.getDim() <= 3) {
         size_t preferredWorkGroupSize[3];
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,8 @@
 namespace NEO {
 class Context;
 class DispatchInfo;
+class WorkGroupSizeAutotuner;
+struct WorkGroupSizeAutotunerKey;
 
 Vec3<size_t> computeWorkgroupSize(
     const DispatchInfo &dispatchInfo);
@@ -22,6 +24,9 @@ Vec3<size_t> generateWorkgroupSize(
 Vec3<size_t> generateWorkgroupsNumber(
     const DispatchInfo &dispatchInfo);
 
+Vec3<size_t> generateAutotunedWorkgroupSize(const DispatchInfo &dispatchInfo, WorkGroupSizeAutotuner &autotuner, bool canSample,
+                                            WorkGroupSizeAutotunerKey &outKey, bool &sampleRequested);
+
 void provideLocalWorkGroupSizeHints(Context *context, const DispatchInfo &dispatchInfo);
 
 WorkSizeInfo createWorkSizeInfoFromDispatchInfo(const DispatchInfo &dispatchInfo);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,8 +7,10 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/logger.h"
 
@@ -119,6 +121,10 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
         }
 
         UNRECOVERABLE_IF((transferProperties.memObj->isMemObjZeroCopy() == false) && isMipMapped(transferProperties.memObj));
+        CpuCopyEngine *cpuCopyEngine = nullptr;
+        if (transferProperties.cmdType == CL_COMMAND_READ_BUFFER || transferProperties.cmdType == CL_COMMAND_WRITE_BUFFER) {
+            cpuCopyEngine = getDevice().getExecutionEnvironment()->initializeCpuCopyEngine();
+        }
         switch (transferProperties.cmdType) {
         case CL_COMMAND_MAP_BUFFER:
             if (!transferProperties.memObj->isMemObjZeroCopy()) {
@@ -152,11 +158,20 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             }
             break;
         case CL_COMMAND_READ_BUFFER:
-            memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            if (cpuCopyEngine) {
+                cpuCopyEngine->copy(transferProperties.ptr, transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], false);
+            } else {
+                memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            }
             eventCompleted = true;
             break;
         case CL_COMMAND_WRITE_BUFFER:
-            memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            if (cpuCopyEngine) {
+                // locked device memory is mapped write combined
+                cpuCopyEngine->copy(transferProperties.getCpuPtrForReadWrite(), transferProperties.ptr, transferProperties.size[0], transferProperties.lockedPtr != nullptr);
+            } else {
+                memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            }
             eventCompleted = true;
             modifySimulationFlags = true;
             break;
@@ -9,6 +9,7 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/bcs_ccs_dependency_pair_container.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/flat_batch_buffer_helper.h"
@@ -16,6 +17,7 @@
 #include "shared/source/helpers/kernel_helpers.h"
 #include "shared/source/helpers/pipe_control_args.h"
 #include "shared/source/helpers/timestamp_packet.h"
+#include "shared/source/helpers/work_group_size_autotuner.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/surface.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -25,6 +27,7 @@
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
+#include "opencl/source/command_queue/cl_local_work_size.h"
 #include "opencl/source/command_queue/command_queue_hw.h"
 #include "opencl/source/command_queue/hardware_interface.h"
 #include "opencl/source/event/event_builder.h"
@@ -83,6 +86,25 @@ cl_int CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCou
         dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::auxToNonAux);
     }
 
+    WorkGroupSizeAutotuner *workGroupSizeAutotuner = nullptr;
+    WorkGroupSizeAutotunerKey workGroupSizeAutotunerKey = {};
+    size_t autotunedWorkSizes[3] = {};
+    bool workGroupSizeSampleRequested = false;
+    if constexpr (commandType == CL_COMMAND_NDRANGE_KERNEL) {
+        if (localWorkSizesIn == nullptr && kernel->getKernelInfo().builtinDispatchBuilder == nullptr) {
+            workGroupSizeAutotuner = device->getDevice().getRootDeviceEnvironmentRef().getWorkGroupSizeAutotuner();
+        }
+        if (workGroupSizeAutotuner != nullptr) {
+            DispatchInfo dispatchInfo(&getClDevice(), kernel, workDim, workItems, enqueuedWorkSizes, globalOffsets);
+            bool canSample = (event != nullptr) && isProfilingEnabled();
+            auto lws = generateAutotunedWorkgroupSize(dispatchInfo, *workGroupSizeAutotuner, canSample, workGroupSizeAutotunerKey, workGroupSizeSampleRequested);
+            autotunedWorkSizes[0] = lws.x;
+            autotunedWorkSizes[1] = lws.y;
+            autotunedWorkSizes[2] = lws.z;
+            localWorkSizesIn = autotunedWorkSizes;
+        }
+    }
+
     if (kernel->getKernelInfo().builtinDispatchBuilder == nullptr) {
         DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::walkerSplit> builder(getClDevice());
         builder.setDispatchGeometry(workDim, workItems, enqueuedWorkSizes, globalOffsets, Vec3<size_t>{0, 0, 0}, localWorkSizesIn);
@@ -120,7 +142,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCou
         setupBlitAuxTranslation(multiDispatchInfo);
     }
 
-    return enqueueHandler<commandType>(surfaces, blocking, multiDispatchInfo, numEventsInWaitList, eventWaitList, event);
+    auto enqueueResult = enqueueHandler<commandType>(surfaces, blocking, multiDispatchInfo, numEventsInWaitList, eventWaitList, event);
+    if (workGroupSizeSampleRequested && enqueueResult == CL_SUCCESS) {
+        castToObjectOrAbort<Event>(*event)->setWorkGroupSizeAutotuningSample(workGroupSizeAutotuner, workGroupSizeAutotunerKey, Vec3<size_t>(autotunedWorkSizes));
+    }
+    return enqueueResult;
 }
 
 template <typename GfxFamily>
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
 #include "shared/source/utilities/perf_counter.h"
 #include "shared/source/utilities/range.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/wait_util.h"
 
 #include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/api/cl_types.h"
@@ -462,6 +463,20 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
     dataCalculated = true;
 }
 
+void Event::setWorkGroupSizeAutotuningSample(WorkGroupSizeAutotuner *autotuner, const WorkGroupSizeAutotunerKey &key, const Vec3<size_t> &lws) {
+    workGroupSizeAutotunerKey = key;
+    workGroupSizeAutotunerLws = lws;
+    workGroupSizeAutotuner.store(autotuner);
+}
+
+void Event::reportWorkGroupSizeAutotuningSample() {
+    auto autotuner = workGroupSizeAutotuner.exchange(nullptr);
+    if (autotuner == nullptr || !calcProfilingData()) {
+        return;
+    }
+    autotuner->reportDuration(workGroupSizeAutotunerKey, workGroupSizeAutotunerLws, endTimeStamp.cpuTimeInNs - startTimeStamp.cpuTimeInNs);
+}
+
 void Event::getBoundaryTimestampValues(TimestampPacketContainer *timestampContainer, uint64_t &globalStartTS, uint64_t &globalEndTS) {
     const auto timestamps = timestampContainer->peekNodes();
 
@@ -548,6 +563,7 @@ void Event::updateExecutionStatus() {
 
     if ((cmdQueue != nullptr) && this->isCompleted()) {
         transitionExecutionStatus(CL_COMPLETE);
+        reportWorkGroupSizeAutotuningSample();
         executeCallbacks(CL_COMPLETE);
         unblockEventsBlockedByThis(CL_COMPLETE);
         auto *allocationStorage = cmdQueue->getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
@@ -747,6 +763,11 @@ cl_int Event::waitForEvents(cl_uint numEvents,
             }
         }
 
+        if (!pendingEventsLeft->empty() && pendingEventsLeft->size() == currentlyPendingEvents->size()) {
+            // none of events got submitted in this pass, sleep until first of them gets its task count
+            WaitUtils::waitFunctionForMultiple(&castToObjectOrAbort<Event>((*pendingEventsLeft)[0])->taskCount);
+        }
+
         std::swap(currentlyPendingEvents, pendingEventsLeft);
         pendingEventsLeft->clear();
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/helpers/completion_stamp.h"
+#include "shared/source/helpers/work_group_size_autotuner.h"
 #include "shared/source/os_interface/os_time.h"
 #include "shared/source/utilities/idlist.h"
 #include "shared/source/utilities/iflist.h"
@@ -314,7 +315,11 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
 
     void copyTimestamps(Event &srcEvent);
 
+    void setWorkGroupSizeAutotuningSample(WorkGroupSizeAutotuner *autotuner, const WorkGroupSizeAutotunerKey &key, const Vec3<size_t> &lws);
+
   protected:
+    void reportWorkGroupSizeAutotuningSample();
+
     Event(Context *ctx, CommandQueue *cmdQueue, cl_command_type cmdType,
           TaskCountType taskLevel, TaskCountType taskCount);
 
@@ -402,6 +407,9 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     std::unique_ptr<TimestampPacketContainer> multiRootDeviceTimestampPacketContainer;
     std::atomic<int> parentCount{0u};
     std::atomic<bool> gpuStateWaited{false};
+    std::atomic<WorkGroupSizeAutotuner *> workGroupSizeAutotuner{nullptr};
+    WorkGroupSizeAutotunerKey workGroupSizeAutotunerKey = {};
+    Vec3<size_t> workGroupSizeAutotunerLws{0, 0, 0};
     // event parents
     std::vector<Event *> parentEvents;
 
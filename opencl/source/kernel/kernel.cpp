@@ -28,6 +28,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/simd_helper.h"
 #include "shared/source/helpers/surface_format_info.h"
+#include "shared/source/helpers/work_group_size_autotuner.h"
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/kernel/kernel_arg_descriptor_extended_vme.h"
 #include "shared/source/kernel/local_ids_cache.h"
@@ -315,6 +316,10 @@ cl_int Kernel::initialize() {
 
     this->setInlineSamplers();
 
+    if (pClDevice->getDevice().getRootDeviceEnvironmentRef().getWorkGroupSizeAutotuner() != nullptr) {
+        this->workGroupSizeAutotunerKernelHash = WorkGroupSizeAutotuner::getKernelHash(kernelDescriptor.kernelMetadata.kernelName, heapInfo.pKernelHeap, heapInfo.kernelHeapSize);
+    }
+
     bool detectIndirectAccessInKernel = productHelper.isDetectIndirectAccessInKernelSupported(kernelDescriptor, program->getCreatedFromBinary(), program->getIndirectDetectionVersion());
     if (debugManager.flags.DetectIndirectAccessInKernel.get() != -1) {
         detectIndirectAccessInKernel = debugManager.flags.DetectIndirectAccessInKernel.get() == 1;
@@ -374,6 +374,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     uint32_t getMaxKernelWorkGroupSize() const;
     uint32_t getSlmTotalSize() const;
+    uint64_t getWorkGroupSizeAutotunerKernelHash() const { return workGroupSizeAutotunerKernelHash; }
     bool getHasIndirectAccess() const {
         return this->kernelHasIndirectAccess;
     }
@@ -511,6 +512,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     uint32_t startOffset = 0;
     uint32_t statelessUncacheableArgsCount = 0;
     uint32_t additionalKernelExecInfo = AdditionalKernelExecInfo::disableOverdispatch;
+    uint64_t workGroupSizeAutotunerKernelHash = 0u;
     uint32_t maxKernelWorkGroupSize = 0;
     uint32_t slmTotalSize = 0u;
     uint32_t sshLocalSize = 0u;
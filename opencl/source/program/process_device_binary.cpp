@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "shared/source/device_binary_format/zebin/zebin_decoder.h"
 #include "shared/source/device_binary_format/zebin/zeinfo_decoder.h"
 #include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/debug_helpers.h"
@@ -223,6 +224,7 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
         SingleDeviceBinary binary = {};
         binary.deviceBinary = blob;
         binary.targetDevice = NEO::getTargetDevice(clDevice.getRootDeviceEnvironment());
+        binary.decodedProgramCache = clDevice.getRootDeviceEnvironment().getDecodedProgramCache();
 
         auto &gfxCoreHelper = clDevice.getGfxCoreHelper();
         std::tie(decodedSingleDeviceBinary.decodeError, std::ignore) = NEO::decodeSingleDeviceBinary(decodedSingleDeviceBinary.programInfo, binary, decodedSingleDeviceBinary.decodeErrors, decodedSingleDeviceBinary.decodeWarnings, gfxCoreHelper);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -199,6 +199,7 @@ cl_int Program::createProgramFromBinary(
             SingleDeviceBinary binary = {};
             binary.deviceBinary = blob;
             binary.targetDevice = NEO::getTargetDevice(clDevice.getRootDeviceEnvironment());
+            binary.decodedProgramCache = clDevice.getRootDeviceEnvironment().getDecodedProgramCache();
 
             auto &gfxCoreHelper = clDevice.getGfxCoreHelper();
             std::tie(decodedSingleDeviceBinary.decodeError, std::ignore) = NEO::decodeSingleDeviceBinary(decodedSingleDeviceBinary.programInfo,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/local_work_size.h"
+#include "shared/source/helpers/work_group_size_autotuner.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
@@ -957,3 +958,40 @@ TEST_F(LocalWorkSizeTest, givenGwsWithSmallXAndBigYWhenLwsIsCalculatedThenDescen
     EXPECT_EQ(workGroupSize[1], 128u);
     EXPECT_EQ(workGroupSize[2], 1u);
 }
+
+TEST_F(LocalWorkSizeTest, givenWorkGroupSizeAutotunerWhenGeneratingWorkgroupSizeThenCandidatesAreTriedAndFastestIsReusedAfterConvergence) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.WorkGroupSizeAutotuningSamples.set(1);
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo(&device, kernel.mockKernel, 1, {4096, 1, 1}, {0, 0, 0}, {0, 0, 0});
+    WorkGroupSizeAutotuner autotuner(0u, nullptr);
+    WorkGroupSizeAutotunerKey key;
+
+    auto heuristicLws = canonizeWorkgroup(computeWorkgroupSize(dispatchInfo));
+    bool sampleRequested = true;
+    EXPECT_EQ(heuristicLws, generateAutotunedWorkgroupSize(dispatchInfo, autotuner, false, key, sampleRequested));
+    EXPECT_FALSE(sampleRequested);
+
+    auto lws = generateAutotunedWorkgroupSize(dispatchInfo, autotuner, true, key, sampleRequested);
+    EXPECT_TRUE(sampleRequested);
+    EXPECT_EQ(heuristicLws, lws);
+    autotuner.reportDuration(key, lws, 200u);
+
+    lws = generateAutotunedWorkgroupSize(dispatchInfo, autotuner, true, key, sampleRequested);
+    ASSERT_TRUE(sampleRequested);
+    EXPECT_NE(heuristicLws, lws);
+    auto fastestLws = lws;
+    autotuner.reportDuration(key, lws, 100u);
+
+    for (uint32_t i = 0; i < WorkGroupSizeAutotuner::maxCandidates; i++) {
+        lws = generateAutotunedWorkgroupSize(dispatchInfo, autotuner, true, key, sampleRequested);
+        if (!sampleRequested) {
+            break;
+        }
+        autotuner.reportDuration(key, lws, 300u);
+    }
+    EXPECT_FALSE(sampleRequested);
+    EXPECT_EQ(fastestLws, lws);
+    EXPECT_EQ(fastestLws, generateAutotunedWorkgroupSize(dispatchInfo, autotuner, false, key, sampleRequested));
+}
@@ -1,10 +1,11 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/utilities/periodic_task_scheduler.h"
 #include "shared/test/common/mocks/mock_deferrable_deletion.h"
 #include "shared/test/common/mocks/mock_deferred_deleter.h"
 
@@ -223,3 +224,22 @@ TEST_F(DeferredDeleterTest, givenDeferredDeleterWhenNonBlockingDrainIsCalledThen
     EXPECT_EQ(0, deleter->areElementsReleasedCalled);
     EXPECT_EQ(1, deleter->drainCalled);
 }
+
+TEST(DeferredDeleterSchedulerTest, givenDeferredDeleterRunningInSchedulerWhenDeletionIsDeferredThenItIsAppliedOnSchedulerThread) {
+    struct SchedulerDeferredDeleter : public DeferredDeleter {
+        using DeferredDeleter::areElementsReleased;
+    };
+
+    PeriodicTaskScheduler scheduler;
+    scheduler.startThread();
+
+    SchedulerDeferredDeleter deleter;
+    deleter.setScheduler(&scheduler);
+    deleter.addClient();
+    deleter.deferDeletion(new MockDeferrableDeletion());
+    while (!deleter.areElementsReleased(false)) {
+        std::this_thread::yield();
+    }
+    deleter.removeClient();
+    scheduler.stopThread();
+}
@@ -43,4 +43,23 @@ TEST(UnifiedMemoryReuseCleanerTestsMt, givenUnifiedMemoryReuseCleanerWithNotStar
     cleaner.stopThread();
 }
 
+TEST(UnifiedMemoryReuseCleanerTestsMt, givenUnifiedMemoryReuseCleanerStartedInSchedulerWhenPeriodExpiredThenTrimOldInCachesIsCalledOnSchedulerThread) {
+    PeriodicTaskScheduler scheduler;
+    scheduler.startThread();
+
+    MockUnifiedMemoryReuseCleaner cleaner;
+    cleaner.callBaseTrimOldInCaches = false;
+    cleaner.startInScheduler(scheduler);
+    EXPECT_EQ(nullptr, cleaner.unifiedMemoryReuseCleanerThread);
+    EXPECT_EQ(1u, scheduler.getTasksCount());
+
+    cleaner.registerSvmAllocationCache(nullptr);
+    while (false == cleaner.trimOldInCachesCalled) {
+        std::this_thread::yield();
+    }
+    cleaner.stopThread();
+    EXPECT_EQ(0u, scheduler.getTasksCount());
+    scheduler.stopThread();
+}
+
 } // namespace NEO
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,8 @@
 
 #include "opencl/test/unit_test/offline_compiler/mock/mock_argument_helper.h"
 
+#include <atomic>
+#include <map>
 #include <optional>
 #include <string>
 
@@ -19,7 +21,9 @@ namespace NEO {
 class MockMultiCommand : public MultiCommand {
   public:
     using MultiCommand::argHelper;
+    using MultiCommand::jobsCount;
     using MultiCommand::lines;
+    using MultiCommand::outputFile;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
 
@@ -39,19 +43,21 @@ class MockMultiCommand : public MultiCommand {
 
     ~MockMultiCommand() override = default;
 
-    int singleBuild(const std::vector<std::string> &args) override {
+    int singleBuild(SingleBuild &build) override {
         ++singleBuildCalledCount;
 
         if (callBaseSingleBuild) {
-            return MultiCommand::singleBuild(args);
+            return MultiCommand::singleBuild(build);
         }
 
-        return OCLOC_SUCCESS;
+        build.outputFileEntry = build.outFileName;
+        return singleBuildResults.count(build.outFileName) ? singleBuildResults.at(build.outFileName) : OCLOC_SUCCESS;
     }
 
     std::map<std::string, std::string> filesMap{};
     std::unique_ptr<MockOclocArgHelper> uniqueHelper{};
-    int singleBuildCalledCount{0};
+    std::map<std::string, int> singleBuildResults{};
+    std::atomic<int> singleBuildCalledCount{0};
     bool callBaseSingleBuild{true};
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,8 +16,10 @@
 #include "shared/source/device_binary_format/elf/elf_decoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
 #include "shared/source/helpers/compiler_product_helper.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/product_config_helper.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/release_helper/release_helper.h"
 #include "shared/test/common/helpers/gtest_helpers.h"
 
@@ -27,6 +29,7 @@
 #include "platforms.h"
 
 #include <algorithm>
+#include <atomic>
 #include <unordered_set>
 
 extern Environment *gEnvironment;
@@ -1767,6 +1770,92 @@ TEST_F(OclocFatBinaryTest, givenBitFlagsWhenBuildingFatbinaryThenFilesInArchiveH
     }
 }
 
+TEST_F(OclocFatBinaryTest, givenJobsFlagWhenBuildingFatbinaryThenArchiveIsIdenticalToSerialBuild) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    ASSERT_EQ(OCLOC_SUCCESS, buildFatBinary(args, &mockArgHelper));
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    const auto serialArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    mockArgHelper.interceptedFiles.clear();
+
+    args.push_back("-j");
+    args.push_back("2");
+    ASSERT_EQ(OCLOC_SUCCESS, buildFatBinary(args, &mockArgHelper));
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    EXPECT_EQ(serialArchive, mockArgHelper.interceptedFiles[outputArchiveName]);
+}
+
+TEST_F(OclocFatBinaryTest, givenDedupBinariesFlagWhenBuildingFatbinaryThenArchiveHasIndexAndPageAlignedBinaries) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-dedup_binaries",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    ASSERT_EQ(OCLOC_SUCCESS, buildFatBinary(args, &mockArgHelper));
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+
+    const auto &rawArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    const auto archiveBytes = ArrayRef<const std::uint8_t>::fromAny(rawArchive.data(), rawArchive.size());
+
+    std::string outErrReason{};
+    std::string outWarning{};
+    const auto decodedArchive = NEO::Ar::decodeAr(archiveBytes, outErrReason, outWarning);
+    ASSERT_NE(nullptr, decodedArchive.magic);
+    EXPECT_TRUE(outErrReason.empty());
+    EXPECT_TRUE(outWarning.empty());
+    EXPECT_EQ(NEO::Ar::SpecialFileNames::indexFile, decodedArchive.indexEntry.fileName);
+
+    ASSERT_EQ(3u, decodedArchive.files.size());
+    for (const auto &file : decodedArchive.files) {
+        EXPECT_EQ(0u, ptrDiff(file.fileData.begin(), archiveBytes.begin()) % MemoryConstants::pageSize);
+    }
+}
+
+TEST(OclocFatBinaryHelpersTest, givenJobsCountArgWhenGettingJobsCountThenZeroMeansAllHardwareThreads) {
+    EXPECT_EQ(4u, getJobsCount("4"));
+    EXPECT_LE(1u, getJobsCount("0"));
+    EXPECT_EQ(getJobsCount("0"), getJobsCount("abc"));
+}
+
+TEST(OclocFatBinaryHelpersTest, givenMoreJobsThanThreadsWhenRunningParallelJobsThenEachJobIsRunOnce) {
+    std::vector<std::atomic<uint32_t>> jobsRunCount(17);
+    runParallelJobs(jobsRunCount.size(), 4u, [&](size_t jobId) { jobsRunCount[jobId]++; });
+    for (const auto &runCount : jobsRunCount) {
+        EXPECT_EQ(1u, runCount.load());
+    }
+
+    runParallelJobs(0u, 4u, [&](size_t jobId) { jobsRunCount[jobId]++; });
+    EXPECT_EQ(1u, jobsRunCount[0].load());
+}
+
 TEST_F(OclocFatBinaryTest, givenOutputDirectoryFlagWhenBuildingFatbinaryThenArchiveIsStoredInThatDirectory) {
     const auto devices = prepareTwoDevices(&mockArgHelper);
     if (devices.empty()) {
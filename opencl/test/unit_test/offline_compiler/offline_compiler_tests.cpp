@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -392,6 +392,9 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs_count>               Number of builds run in parallel.
+                                0 uses all hardware threads.
+
 )===";
 
     EXPECT_EQ(expectedOutput, output);
@@ -448,7 +451,7 @@ TEST(MultiCommandWhiteboxTest, GivenCommandLineWithMissingApostropheWhenRunningB
 
     mockMultiCommand.argHelper->getPrinterRef().setSuppressMessages(true);
     mockMultiCommand.runBuilds("ocloc");
-    EXPECT_EQ(0, mockMultiCommand.singleBuildCalledCount);
+    EXPECT_EQ(0, mockMultiCommand.singleBuildCalledCount.load());
 
     ASSERT_EQ(1u, mockMultiCommand.retValues.size());
     EXPECT_EQ(OCLOC_INVALID_FILE, mockMultiCommand.retValues[0]);
@@ -467,7 +470,7 @@ TEST(MultiCommandWhiteboxTest, GivenTwoValidCommandLinesAndVerboseModeWhenRunnin
     mockMultiCommand.runBuilds("ocloc");
     const auto output = testing::internal::GetCapturedStdout();
 
-    EXPECT_EQ(2, mockMultiCommand.singleBuildCalledCount);
+    EXPECT_EQ(2, mockMultiCommand.singleBuildCalledCount.load());
 
     ASSERT_EQ(2u, mockMultiCommand.retValues.size());
     EXPECT_EQ(OCLOC_SUCCESS, mockMultiCommand.retValues[0]);
@@ -478,6 +481,31 @@ TEST(MultiCommandWhiteboxTest, GivenTwoValidCommandLinesAndVerboseModeWhenRunnin
     EXPECT_EQ(expectedOutput, output);
 }
 
+TEST(MultiCommandWhiteboxTest, GivenMultipleJobsWhenRunningBuildsThenAllBuildsAreStartedAndResultsAreStoredInCommandsOrder) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = true;
+    mockMultiCommand.callBaseSingleBuild = false;
+    mockMultiCommand.jobsCount = 3u;
+    mockMultiCommand.singleBuildResults["build_no_3"] = OCLOC_INVALID_FILE;
+
+    const std::string validLine{"-file test_files/copybuffer.cl -out_dir SomeOutputDirectory -device " + gEnvironment->devicePrefix};
+    for (int i = 0; i < 5; i++) {
+        mockMultiCommand.lines.push_back(validLine);
+    }
+    mockMultiCommand.lines.push_back("-out_dir \"Some Directory");
+
+    mockMultiCommand.argHelper->getPrinterRef().setSuppressMessages(true);
+    mockMultiCommand.runBuilds("ocloc");
+    EXPECT_EQ(5, mockMultiCommand.singleBuildCalledCount.load());
+
+    ASSERT_EQ(6u, mockMultiCommand.retValues.size());
+    for (size_t i = 0; i < 5; i++) {
+        EXPECT_EQ(i == 2 ? OCLOC_INVALID_FILE : OCLOC_SUCCESS, mockMultiCommand.retValues[i]);
+    }
+    EXPECT_EQ(OCLOC_INVALID_FILE, mockMultiCommand.retValues[5]);
+    EXPECT_EQ("build_no_1\nbuild_no_2\nbuild_no_3\nbuild_no_4\nbuild_no_5\n", mockMultiCommand.outputFile.str());
+}
+
 TEST(MultiCommandWhiteboxTest, GivenArgsWithQuietModeAndEmptyMulticommandFileWhenInitializingThenQuietFlagIsSetAndErrorIsReturned) {
     MockMultiCommand mockMultiCommand{};
     mockMultiCommand.quiet = false;
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (C) 2025 Intel Corporation
+#
+# SPDX-License-Identifier: MIT
+#
+
+# Converts a binary trace written with PerfTraceFile=<file> into Chrome trace / Perfetto JSON.
+# Usage: perf_trace_to_chrome.py <trace file> <output json>
+
+import json
+import struct
+import sys
+
+CHUNK_NAME = 1
+CHUNK_CALIBRATION = 2
+CHUNK_RECORDS = 3
+CHUNK_DROPPED_RECORDS = 4
+CHUNK_FOOTER = 5
+
+EVENT_CATEGORIES = ["api", "system", "wait", "flush"]
+RECORD_FORMAT = "<QIIIHH"
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+
+def read_trace(data):
+    if data[:8] != b"NEOTRACE":
+        raise ValueError("not a NEO perf trace file")
+    version, = struct.unpack_from("<I", data, 8)
+    if version not in (1, 2):
+        raise ValueError("unsupported trace version %d" % version)
+
+    offset = 16
+    names = {}
+    calibrations = []
+    records = []
+    dropped = {}
+    while offset < len(data):
+        chunk_type, = struct.unpack_from("<I", data, offset)
+        offset += 4
+        if chunk_type == CHUNK_NAME:
+            name_id, length = struct.unpack_from("<II", data, offset)
+            offset += 8
+            names[name_id] = data[offset:offset + length].decode("utf-8", "replace")
+            offset += length
+        elif chunk_type == CHUNK_CALIBRATION:
+            calibrations.append(struct.unpack_from("<QQ", data, offset))
+            offset += 16
+        elif chunk_type == CHUNK_RECORDS:
+            count, = struct.unpack_from("<I", data, offset)
+            offset += 4
+            for _ in range(count):
+                records.append(struct.unpack_from(RECORD_FORMAT, data, offset))
+                offset += RECORD_SIZE
+        elif chunk_type == CHUNK_DROPPED_RECORDS:
+            # cumulative count for the thread
+            thread_index, count = struct.unpack_from("<IQ", data, offset)
+            offset += 12
+            dropped[thread_index] = count
+        elif chunk_type == CHUNK_FOOTER:
+            offset += 8
+        else:
+            raise ValueError("unknown chunk type %d at offset %d" % (chunk_type, offset - 4))
+    return names, calibrations, records, dropped
+
+
+def to_chrome_trace(names, calibrations, records, dropped):
+    first_tsc, first_ns = calibrations[0]
+    last_tsc, last_ns = calibrations[-1]
+    ticks_per_us = 1000.0
+    if last_tsc > first_tsc and last_ns > first_ns:
+        ticks_per_us = (last_tsc - first_tsc) * 1000.0 / (last_ns - first_ns)
+
+    events = []
+    for timestamp, name_id, thread_index, payload, event_type, phase in records:
+        event = {
+            "name": names.get(name_id, "unknown"),
+            "cat": EVENT_CATEGORIES[event_type] if event_type < len(EVENT_CATEGORIES) else "unknown",
+            "ph": "B" if phase == 0 else "E",
+            "ts": (timestamp - first_tsc) / ticks_per_us,
+            "pid": 0,
+            "tid": thread_index,
+        }
+        if payload != 0:
+            event["args"] = {"payload": payload}
+        events.append(event)
+    events.sort(key=lambda event: event["ts"])
+    metadata = {
+        "dropped_records": sum(dropped.values()),
+        "dropped_records_per_thread": {str(thread_index): count for thread_index, count in sorted(dropped.items())},
+    }
+    return {"traceEvents": events, "displayTimeUnit": "ns", "metadata": metadata}
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("usage: %s <trace file> <output json>" % sys.argv[0])
+        return 1
+    with open(sys.argv[1], "rb") as trace_file:
+        names, calibrations, records, dropped = read_trace(trace_file.read())
+    if dropped:
+        print("warning: %d records dropped on full thread buffers, increase PerfTraceBufferSize" % sum(dropped.values()), file=sys.stderr)
+    with open(sys.argv[2], "w") as output_file:
+        json.dump(to_chrome_trace(names, calibrations, records, dropped), output_file)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
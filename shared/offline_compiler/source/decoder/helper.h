@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "igfxfmid.h"
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -40,6 +41,7 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
     explicit MessagePrinter(bool suppressMessages) : suppressMessages(suppressMessages) {}
 
     void printf(const char *message) {
+        std::lock_guard<std::mutex> lock(printMutex);
         if (!suppressMessages) {
             ::printf("%s", message);
         }
@@ -48,6 +50,7 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
 
     template <typename... Args>
     void printf(const char *format, Args... args) {
+        std::lock_guard<std::mutex> lock(printMutex);
         if (!suppressMessages) {
             ::printf(format, args...);
         }
@@ -77,5 +80,6 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
     }
 
     std::stringstream ss;
+    std::mutex printMutex;
     bool suppressMessages = false;
 };
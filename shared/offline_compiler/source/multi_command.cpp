@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,22 +18,24 @@
 #include <memory>
 
 namespace NEO {
-int MultiCommand::singleBuild(const std::vector<std::string> &args) {
+int MultiCommand::singleBuild(SingleBuild &build) {
     int retVal = OCLOC_SUCCESS;
+    auto buildOutFileName = build.outFileName;
 
-    if (requestedFatBinary(args, argHelper)) {
-        retVal = buildFatBinary(args, argHelper);
+    if (requestedFatBinary(build.args, argHelper)) {
+        retVal = buildFatBinary(build.args, argHelper);
     } else {
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
+        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(build.args.size(), build.args, true, retVal, argHelper)};
         if (retVal == OCLOC_SUCCESS) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+            // safety guard uses process-wide signal handlers, parallel builds call compiler directly
+            retVal = (jobsCount > 1u) ? pCompiler->build() : buildWithSafetyGuard(pCompiler.get());
 
             std::string &buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
                 argHelper->printf("%s\n", buildLog.c_str());
             }
         }
-        outFileName += ".bin";
+        buildOutFileName += ".bin";
     }
     if (retVal == OCLOC_SUCCESS) {
         if (!quiet)
@@ -43,11 +45,10 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
     }
 
     if (retVal == OCLOC_SUCCESS) {
-        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
+        build.outputFileEntry = getCurrentDirectoryOwn(build.outDir) + buildOutFileName;
     } else {
-        outputFile << "Unsuccessful build";
+        build.outputFileEntry = "Unsuccessful build";
     }
-    outputFile << '\n';
 
     return retVal;
 }
@@ -107,6 +108,8 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             pathToCommandFile = args[++argIndex];
         } else if (hasMoreArgs && ConstStringRef("-output_file_list") == currArg) {
             outputFileList = args[++argIndex];
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            jobsCount = getJobsCount(args[++argIndex]);
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
         } else {
@@ -138,12 +141,13 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
+    std::vector<SingleBuild> builds(lines.size());
     for (size_t i = 0; i < lines.size(); ++i) {
-        std::vector<std::string> args = {argZero};
+        auto &build = builds[i];
+        build.args = {argZero};
 
-        int retVal = splitLineInSeparateArgs(args, lines[i], i);
-        if (retVal != OCLOC_SUCCESS) {
-            retValues.push_back(retVal);
+        build.retVal = splitLineInSeparateArgs(build.args, lines[i], i);
+        if (build.retVal != OCLOC_SUCCESS) {
             continue;
         }
 
@@ -151,9 +155,32 @@ void MultiCommand::runBuilds(const std::string &argZero) {
             argHelper->printf("Command number %zu: \n", i + 1);
         }
 
-        addAdditionalOptionsToSingleCommandLine(args, i);
-        retVal = singleBuild(args);
-        retValues.push_back(retVal);
+        addAdditionalOptionsToSingleCommandLine(build.args, i);
+        build.outDir = outDirForBuilds;
+        build.outFileName = outFileName;
+        if (jobsCount > 1u) {
+            build.pending = true;
+            continue;
+        }
+        build.retVal = singleBuild(build);
+        outputFile << build.outputFileEntry << '\n';
+    }
+
+    if (jobsCount > 1u) {
+        runParallelJobs(builds.size(), jobsCount, [&](size_t buildId) {
+            if (builds[buildId].pending) {
+                builds[buildId].retVal = singleBuild(builds[buildId]);
+            }
+        });
+        for (const auto &build : builds) {
+            if (build.pending) {
+                outputFile << build.outputFileEntry << '\n';
+            }
+        }
+    }
+
+    for (const auto &build : builds) {
+        retValues.push_back(build.retVal);
     }
 }
 
@@ -172,6 +199,9 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs_count>               Number of builds run in parallel.
+                                0 uses all hardware threads.
+
 )===");
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -27,12 +28,21 @@ class MultiCommand {
     std::string outputFileList;
 
   protected:
+    struct SingleBuild {
+        std::vector<std::string> args;
+        std::string outDir;
+        std::string outFileName;
+        std::string outputFileEntry;
+        int retVal = 0;
+        bool pending = false;
+    };
+
     MultiCommand() = default;
 
     int initialize(const std::vector<std::string> &args);
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
-    MOCKABLE_VIRTUAL int singleBuild(const std::vector<std::string> &args);
+    MOCKABLE_VIRTUAL int singleBuild(SingleBuild &build);
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
@@ -43,6 +53,7 @@ class MultiCommand {
     std::string outFileName;
     std::string pathToCommandFile;
     std::stringstream outputFile;
+    uint32_t jobsCount = 1u;
     bool quiet = false;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,7 @@
 #include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -49,6 +50,7 @@ class OclocArgHelper {
   protected:
     std::vector<Source> inputs, headers;
     std::vector<std::unique_ptr<Output>> outputs;
+    std::mutex outputsMutex;
     uint32_t *numOutputs = nullptr;
     char ***nameOutputs = nullptr;
     uint8_t ***dataOutputs = nullptr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,10 +26,13 @@
 #include "platforms.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <set>
+#include <thread>
 
 namespace NEO {
 
@@ -281,29 +284,59 @@ int getDeviceArgValueIdx(const std::vector<std::string> &args) {
     return -1;
 }
 
-int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
-                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+uint32_t getJobsCount(const std::string &jobsArg) {
+    auto jobsCount = static_cast<uint32_t>(std::strtoul(jobsArg.c_str(), nullptr, 10));
+    if (jobsCount == 0u) {
+        jobsCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return jobsCount;
+}
 
-    if (retVal == 0) {
-        retVal = buildWithSafetyGuard(pCompiler);
-        std::string buildLog = pCompiler->getBuildLog();
-        if (buildLog.empty() == false) {
-            argHelper->printf("%s\n", buildLog.c_str());
-        }
-        if (retVal == 0) {
-            if (!pCompiler->isQuiet())
-                argHelper->printf("Build succeeded for : %s.\n", product.c_str());
-        } else {
-            argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
-            argHelper->printf("Command was:");
-            for (const auto &arg : argsCopy)
-                argHelper->printf(" %s", arg.c_str());
-            argHelper->printf("\n");
+void runParallelJobs(size_t jobsToRun, uint32_t jobsCount, const std::function<void(size_t)> &job) {
+    std::atomic<size_t> nextJob{0u};
+    auto runJobs = [&]() {
+        for (auto jobId = nextJob++; jobId < jobsToRun; jobId = nextJob++) {
+            job(jobId);
         }
+    };
+
+    // calling thread takes jobs as well
+    std::vector<std::thread> threads;
+    const auto threadsCount = std::min(static_cast<size_t>(jobsCount), jobsToRun);
+    for (size_t i = 1; i < threadsCount; i++) {
+        threads.emplace_back(runJobs);
     }
+    runJobs();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
     if (retVal) {
         return retVal;
     }
+    return appendFatBinaryTarget(buildWithSafetyGuard(pCompiler), argsCopy, pointerSize, fatbinary, pCompiler, argHelper, product);
+}
+
+int appendFatBinaryTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                          OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+    std::string buildLog = pCompiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
+    }
+    if (retVal == 0) {
+        if (!pCompiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", product.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
+        return retVal;
+    }
 
     std::string entryName("");
     if (product.find(".") != std::string::npos) {
@@ -332,6 +365,8 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string outputDirectory = "";
     bool spirvInput = false;
     bool excludeIr = false;
+    bool deduplicateBinaries = false;
+    uint32_t jobsCount = 1u;
     std::set<std::string> deviceAcronymsFromDeviceOptions;
 
     std::vector<std::string> argsCopy(args);
@@ -355,8 +390,13 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         } else if ((ConstStringRef("-out_dir") == currArg) && hasMoreArgs) {
             outputDirectory = args[argIndex + 1];
             ++argIndex;
+        } else if ((ConstStringRef("-j") == currArg) && hasMoreArgs) {
+            jobsCount = getJobsCount(args[argIndex + 1]);
+            ++argIndex;
         } else if (ConstStringRef("-exclude_ir") == currArg) {
             excludeIr = true;
+        } else if (ConstStringRef("-dedup_binaries") == currArg) {
+            deduplicateBinaries = true;
         } else if (ConstStringRef("-spirv_input") == currArg) {
             spirvInput = true;
         } else if (("-device_options" == currArg) && hasAtLeast2MoreArgs) {
@@ -378,7 +418,7 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         return OCLOC_INVALID_COMMAND_LINE;
     }
 
-    Ar::ArEncoder fatbinary(true);
+    Ar::ArEncoder fatbinary(true, deduplicateBinaries);
     std::vector<ConstStringRef> targetProducts;
     targetProducts = getTargetProductsForFatbinary(ConstStringRef(args[deviceArgIndex]), argHelper);
     if (targetProducts.empty()) {
@@ -392,6 +432,8 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         }
     }
     std::string optionsForIr;
+    std::vector<std::unique_ptr<OfflineCompiler>> compilers;
+    std::vector<std::vector<std::string>> compilersArgs;
     for (const auto &product : targetProducts) {
         int retVal = 0;
         argsCopy[deviceArgIndex] = product.str();
@@ -402,6 +444,12 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
             return retVal;
         }
 
+        if (jobsCount > 1u) {
+            compilers.push_back(std::move(pCompiler));
+            compilersArgs.push_back(argsCopy);
+            continue;
+        }
+
         retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
         if (retVal) {
             return retVal;
@@ -411,6 +459,24 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         }
     }
 
+    if (!compilers.empty()) {
+        // Safety guard uses process-wide signal handlers, so parallel builds call compilers directly.
+        // Targets are appended in product order to keep fat binary identical to serial build.
+        std::vector<int> buildRetVals(compilers.size(), OCLOC_SUCCESS);
+        runParallelJobs(compilers.size(), jobsCount, [&](size_t compilerId) {
+            buildRetVals[compilerId] = compilers[compilerId]->build();
+        });
+
+        for (size_t compilerId = 0; compilerId < compilers.size(); compilerId++) {
+            auto retVal = appendFatBinaryTarget(buildRetVals[compilerId], compilersArgs[compilerId], pointerSizeInBits, fatbinary,
+                                                compilers[compilerId].get(), argHelper, targetProducts[compilerId].str());
+            if (retVal) {
+                return retVal;
+            }
+        }
+        optionsForIr = compilers[0]->getOptions();
+    }
+
     if (shouldPreserveGenericIr) {
         const auto errorCode = appendGenericIr(fatbinary, inputFileName, argHelper, optionsForIr);
         if (errorCode != OCLOC_SUCCESS) {
@@ -1069,6 +1069,11 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
             argIndex++;
         } else if ("-exclude_ir" == currArg) {
             excludeIr = true;
+        } else if (("-j" == currArg) && hasMoreArgs) {
+            // jobs count is consumed by fat binary and multi command builds
+            argIndex++;
+        } else if ("-dedup_binaries" == currArg) {
+            // consumed by fat binary build
         } else if ("--format" == currArg) {
             formatToEnforce = argv[argIndex + 1];
             argIndex++;
@@ -1402,6 +1407,14 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
 
   -exclude_ir                               Excludes IR from the output binary file.
 
+  -j <jobs_count>                           Number of targets built in parallel when compiling
+                                            for multiple devices. 0 uses all hardware threads.
+
+  -dedup_binaries                           Stores identical device binaries of fat binary once.
+                                            Other devices refer to stored binary by alias entries.
+                                            Fat binary gets index of all entries and page aligned
+                                            binaries. Requires runtime supporting aliased entries.
+
   --format                                  Enforce given binary format. The possible values are:
                                             --format zebin - Enforce generating zebin binary
                                             --format patchtokens - Enforce generating patchtokens (legacy) binary.
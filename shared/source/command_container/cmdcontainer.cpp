@@ -25,6 +25,9 @@
 #include "shared/source/memory_manager/allocations_list.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+
+#include <algorithm>
+
 namespace NEO {
 
 CommandContainer::~CommandContainer() {
@@ -177,15 +180,43 @@ bool CommandContainer::swapStreams() {
     return false;
 }
 
+void CommandContainer::eraseFromResidencyContainer(GraphicsAllocation *alloc) {
+    auto allocErase = std::find(this->residencyContainer.begin(), this->residencyContainer.end(), alloc);
+    if (allocErase == this->residencyContainer.end()) {
+        return;
+    }
+    // erasing from the deduplicated prefix keeps it sorted and unique, it only becomes one entry shorter
+    if (static_cast<size_t>(allocErase - this->residencyContainer.begin()) < this->residencyContainerUniqueCount) {
+        this->residencyContainerUniqueCount--;
+    }
+    this->residencyContainer.erase(allocErase);
+}
+
 void CommandContainer::removeDuplicatesFromResidencyContainer() {
-    std::sort(this->residencyContainer.begin(), this->residencyContainer.end());
-    this->residencyContainer.erase(std::unique(this->residencyContainer.begin(), this->residencyContainer.end()), this->residencyContainer.end());
+    // entries below residencyContainerUniqueCount are already sorted and unique, only the ones added since are processed
+    if (this->residencyContainerUniqueCount > this->residencyContainer.size()) {
+        this->residencyContainerUniqueCount = 0u;
+    }
+    auto uniqueEnd = this->residencyContainer.begin() + this->residencyContainerUniqueCount;
+    if (uniqueEnd == this->residencyContainer.end()) {
+        return;
+    }
+
+    std::sort(uniqueEnd, this->residencyContainer.end());
+    auto newEnd = std::unique(uniqueEnd, this->residencyContainer.end());
+    newEnd = std::remove_if(uniqueEnd, newEnd, [&](GraphicsAllocation *allocation) {
+        return std::binary_search(this->residencyContainer.begin(), uniqueEnd, allocation);
+    });
+    this->residencyContainer.erase(newEnd, this->residencyContainer.end());
+
+    std::inplace_merge(this->residencyContainer.begin(), this->residencyContainer.begin() + this->residencyContainerUniqueCount, this->residencyContainer.end());
+    this->residencyContainerUniqueCount = this->residencyContainer.size();
 }
 
 void CommandContainer::reset() {
     setDirtyStateForAllHeaps(true);
     slmSize = std::numeric_limits<uint32_t>::max();
-    getResidencyContainer().clear();
+    clearResidencyContainer();
     if (getHeapHelper()) {
         for (auto deallocation : deallocationContainer) {
             if ((deallocation->getAllocationType() == AllocationType::internalHeap) || (deallocation->getAllocationType() == AllocationType::linearStream)) {
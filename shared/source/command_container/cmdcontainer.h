@@ -81,10 +81,15 @@ class CommandContainer : public NonCopyableOrMovableClass {
     CmdBufferContainer &getCmdBufferAllocations() { return cmdBufferAllocations; }
 
     ResidencyContainer &getResidencyContainer() { return residencyContainer; }
+    void clearResidencyContainer() {
+        residencyContainer.clear();
+        residencyContainerUniqueCount = 0u;
+    }
 
     std::vector<GraphicsAllocation *> &getDeallocationContainer() { return deallocationContainer; }
 
     void addToResidencyContainer(GraphicsAllocation *alloc);
+    void eraseFromResidencyContainer(GraphicsAllocation *alloc);
     void removeDuplicatesFromResidencyContainer();
 
     LinearStream *getCommandStream() { return commandStream.get(); }
@@ -223,6 +228,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
 
     CmdBufferContainer cmdBufferAllocations;
     ResidencyContainer residencyContainer;
+    size_t residencyContainerUniqueCount = 0u;
     std::vector<GraphicsAllocation *> deallocationContainer;
     HeapContainer sshAllocations;
 
@@ -102,6 +102,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             if (ssh == nullptr) {
                 ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::surfaceState, args.dispatchInterface->getSurfaceStateHeapDataSize(), NEO::EncodeDispatchKernel<Family>::getDefaultSshAlignment());
             }
+            args.outSurfaceStatesPtr = ssh->getSpace(0);
             bindingTablePointer = static_cast<uint32_t>(EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(
                 *ssh,
                 args.dispatchInterface->getSurfaceStateHeapData(),
@@ -193,6 +194,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             ptr = NEO::ImplicitArgsHelper::patchImplicitArgs(ptr, *pImplicitArgs, kernelDescriptor, {}, rootDeviceEnvironment, nullptr);
         }
 
+        args.outIndirectDataPtr = ptr;
         memcpy_s(ptr, sizeCrossThreadData,
                  args.dispatchInterface->getCrossThreadData(), sizeCrossThreadData);
 
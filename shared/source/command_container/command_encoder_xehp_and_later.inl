@@ -167,6 +167,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
                         container.prepareBindfulSsh();
                         ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::surfaceState, args.dispatchInterface->getSurfaceStateHeapDataSize(), NEO::EncodeDispatchKernel<Family>::getDefaultSshAlignment());
                     }
+                    args.outSurfaceStatesPtr = ssh->getSpace(0);
                     auto bindingTablePointer = static_cast<uint32_t>(EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(
                         *ssh,
                         args.dispatchInterface->getSurfaceStateHeapData(),
@@ -281,6 +282,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             ptr = args.cpuPayloadBuffer;
         }
 
+        args.outIndirectDataPtr = ptr;
         if (sizeCrossThreadData > 0) {
             memcpy_s(ptr, sizeCrossThreadData,
                      crossThreadData, sizeCrossThreadData);
@@ -43,6 +43,7 @@
 #include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/utilities/hw_timestamps.h"
 #include "shared/source/utilities/perf_counter.h"
+#include "shared/source/utilities/perf_trace.h"
 #include "shared/source/utilities/tag_allocator.h"
 #include "shared/source/utilities/wait_util.h"
 
@@ -131,6 +132,7 @@ CommandStreamReceiver::~CommandStreamReceiver() {
 }
 
 SubmissionStatus CommandStreamReceiver::submitBatchBuffer(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
+    PerfTraceScope perfTraceScope(PerfTraceEventType::flush, __FUNCTION__);
     this->latestSentTaskCount = taskCount + 1;
 
     SubmissionStatus retVal = this->flush(batchBuffer, allocationsForResidency);
@@ -155,6 +157,14 @@ void CommandStreamReceiver::makeResident(GraphicsAllocation &gfxAllocation) {
 
     gfxAllocation.updateTaskCount(submissionTaskCount, osContext->getContextId());
 
+    if (this->incrementalResidencyEnabled &&
+        gfxAllocation.isResident(osContext->getContextId()) &&
+        gfxAllocation.getResidencyGeneration(osContext->getContextId()) == this->residencyGeneration) {
+        // already made resident in this generation, nothing changed since the previous submission
+        gfxAllocation.updateResidencyTaskCount(submissionTaskCount, osContext->getContextId());
+        return;
+    }
+
     if (gfxAllocation.isResidencyTaskCountBelow(submissionTaskCount, osContext->getContextId())) {
         auto pushAllocations = true;
 
@@ -164,6 +174,9 @@ void CommandStreamReceiver::makeResident(GraphicsAllocation &gfxAllocation) {
 
         if (pushAllocations) {
             this->getResidencyAllocations().push_back(&gfxAllocation);
+            if (this->incrementalResidencyEnabled) {
+                gfxAllocation.setResidencyGeneration(this->residencyGeneration, osContext->getContextId());
+            }
         }
 
         if (this->dispatchMode == DispatchMode::batchedDispatch) {
@@ -462,6 +475,9 @@ WaitStatus CommandStreamReceiver::waitForCompletionWithTimeout(const WaitParams
         printTagAddressContent(taskCountToWait, params.waitTimeout, true);
     }
 
+    // waits may run under csr ownership, which appending threads take under their own locks, so owners give up after bounded time
+    flushDeferredSubmissions(false);
+
     TaskCountType latestSentTaskCount = this->latestFlushedTaskCount;
     if (latestSentTaskCount < taskCountToWait) {
         if (!this->flushBatchedSubmissions()) {
@@ -1191,6 +1207,49 @@ void CommandStreamReceiver::unregisterClient(void *client) {
     }
 }
 
+void CommandStreamReceiver::registerDeferredSubmissionsFlush(void *owner, std::function<void(bool)> flush) {
+    std::unique_lock<MutexType> lock(deferredSubmissionsFlushesMutex);
+    deferredSubmissionsFlushes.emplace_back(owner, std::move(flush));
+    if (numDeferredSubmissionsFlushes++ == 0u && executionEnvironment.memoryManager) {
+        executionEnvironment.memoryManager->registerDeferredSubmissionsCsr();
+    }
+}
+
+void CommandStreamReceiver::unregisterDeferredSubmissionsFlush(void *owner) {
+    std::unique_lock<MutexType> lock(deferredSubmissionsFlushesMutex);
+
+    auto element = std::find_if(deferredSubmissionsFlushes.begin(), deferredSubmissionsFlushes.end(), [owner](const auto &entry) { return entry.first == owner; });
+    if (element != deferredSubmissionsFlushes.end()) {
+        deferredSubmissionsFlushes.erase(element);
+        if (--numDeferredSubmissionsFlushes == 0u && executionEnvironment.memoryManager) {
+            executionEnvironment.memoryManager->unregisterDeferredSubmissionsCsr();
+        }
+    }
+    // flush in progress on other thread may still call owner, which can be destroyed only afterwards
+    deferredSubmissionsFlushesDone.wait(lock, [this]() { return deferredSubmissionsFlushesInProgress == 0u; });
+}
+
+void CommandStreamReceiver::flushDeferredSubmissions(bool blocking) {
+    if (numDeferredSubmissionsFlushes.load() == 0) {
+        return;
+    }
+    // blocking callers check task counts afterwards, so owners wait for appends in progress on other threads;
+    // owners take their own locks, which must not be taken under the registry lock to avoid lock order inversion
+    std::unique_lock<MutexType> lock(deferredSubmissionsFlushesMutex);
+    auto flushes = deferredSubmissionsFlushes;
+    deferredSubmissionsFlushesInProgress++;
+    lock.unlock();
+
+    for (auto &entry : flushes) {
+        entry.second(blocking);
+    }
+
+    lock.lock();
+    if (--deferredSubmissionsFlushesInProgress == 0u) {
+        deferredSubmissionsFlushesDone.notify_all();
+    }
+}
+
 void CommandStreamReceiver::ensurePrimaryCsrInitialized(Device &device) {
     auto csrToInitialize = primaryCsr ? primaryCsr : this;
     csrToInitialize->initializeDeviceWithFirstSubmission(device);
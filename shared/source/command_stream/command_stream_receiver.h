@@ -22,6 +22,7 @@
 #include "aubstream/allocation_params.h"
 
 #include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -138,6 +139,9 @@ class CommandStreamReceiver {
 
     ResidencyContainer &getResidencyAllocations();
     ResidencyContainer &getEvictionAllocations();
+    bool isIncrementalResidencyEnabled() const { return incrementalResidencyEnabled; }
+    uint32_t getResidencyGeneration() const { return residencyGeneration; }
+    void invalidateResidencyGeneration() { residencyGeneration++; }
     PrivateAllocsToReuseContainer &getOwnedPrivateAllocations();
 
     virtual GmmPageTableMngr *createPageTableManager() { return nullptr; }
@@ -497,6 +501,14 @@ class CommandStreamReceiver {
     void registerClient(void *client);
     void unregisterClient(void *client);
 
+    // Submissions deferred by clients (e.g. coalescing immediate command lists) have no task count yet,
+    // so waits and resource releases checking task counts flush them first.
+    // Blocking flush waits for deferrals in progress on other threads, non-blocking one may give up after bounded time.
+    // Flushes run without the registry lock held; unregistering waits until flushes in progress are done.
+    void registerDeferredSubmissionsFlush(void *owner, std::function<void(bool)> flush);
+    void unregisterDeferredSubmissionsFlush(void *owner);
+    void flushDeferredSubmissions(bool blocking);
+
     bool getDcFlushSupport() const {
         return dcFlushSupport;
     }
@@ -580,6 +592,7 @@ class CommandStreamReceiver {
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<MutexType> obtainHostPtrSurfaceCreationLock();
 
     std::vector<void *> registeredClients;
+    std::vector<std::pair<void *, std::function<void(bool)>>> deferredSubmissionsFlushes;
 
     std::unique_ptr<FlushStampTracker> flushStamp;
     std::unique_ptr<SubmissionAggregator> submissionAggregator;
@@ -603,6 +616,8 @@ class CommandStreamReceiver {
     MutexType ownershipMutex;
     MutexType hostPtrSurfaceCreationMutex;
     MutexType registeredClientsMutex;
+    MutexType deferredSubmissionsFlushesMutex;
+    std::condition_variable_any deferredSubmissionsFlushesDone;
     ExecutionEnvironment &executionEnvironment;
 
     LinearStream commandStream;
@@ -647,6 +662,8 @@ class CommandStreamReceiver {
     std::atomic<TaskCountType> taskCount{0};
 
     std::atomic<uint32_t> numClients = 0u;
+    std::atomic<uint32_t> numDeferredSubmissionsFlushes = 0u;
+    uint32_t deferredSubmissionsFlushesInProgress = 0u;
 
     DispatchMode dispatchMode = DispatchMode::immediateDispatch;
     SamplerCacheFlushState samplerCacheFlushRequired = SamplerCacheFlushState::samplerCacheFlushNotRequired;
@@ -666,6 +683,7 @@ class CommandStreamReceiver {
     uint32_t activePartitionsConfig = 1;
     uint32_t immWritePostSyncWriteOffset = 0;
     uint32_t timeStampPostSyncWriteOffset = 0;
+    uint32_t residencyGeneration = 1u;
     TaskCountType completionFenceValue = 0;
 
     const uint32_t rootDeviceIndex;
@@ -696,6 +714,7 @@ class CommandStreamReceiver {
     bool pageTableManagerInitialized = false;
 
     bool useNewResourceImplicitFlush = false;
+    bool incrementalResidencyEnabled = false;
     bool newResources = false;
     bool useGpuIdleImplicitFlush = false;
     bool useNotifyEnableForPostSync = false;
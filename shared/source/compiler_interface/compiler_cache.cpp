@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,8 @@
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/os_thread.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 #include "shared/source/utilities/io_functions.h"
 
@@ -138,4 +140,96 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
     : config(cacheConfig){};
 
+CompilerCache::~CompilerCache() {
+    stopWriter();
+}
+
+void CompilerCache::cacheBinaryAsync(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (debugManager.flags.EnableAsyncCompilerCacheWrites.get() != 1) {
+        cacheBinary(kernelFileHash, pBinary, binarySize);
+        return;
+    }
+
+    if (pBinary == nullptr || binarySize == 0 || binarySize > config.cacheSize) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(pendingWritesMtx);
+    if (pendingWrites.find(kernelFileHash) != pendingWrites.end()) {
+        return;
+    }
+
+    if (pendingWritesSize + binarySize > maxPendingWritesSize) {
+        lock.unlock();
+        cacheBinary(kernelFileHash, pBinary, binarySize);
+        return;
+    }
+
+    PendingCacheWrite pendingWrite = {std::make_unique<char[]>(binarySize), binarySize};
+    memcpy_s(pendingWrite.binary.get(), binarySize, pBinary, binarySize);
+
+    pendingWrites.emplace(kernelFileHash, std::move(pendingWrite));
+    pendingWritesOrder.push_back(kernelFileHash);
+    pendingWritesSize += binarySize;
+    if (writer == nullptr) {
+        stopWriting = false;
+        writer = Thread::createFunc(writePendingBinaries, reinterpret_cast<void *>(this));
+    }
+    lock.unlock();
+    pendingWritesCondition.notify_one();
+}
+
+void *CompilerCache::writePendingBinaries(void *arg) {
+    auto compilerCache = reinterpret_cast<CompilerCache *>(arg);
+    std::unique_lock<std::mutex> lock(compilerCache->pendingWritesMtx);
+    while (true) {
+        compilerCache->pendingWritesCondition.wait(lock, [&]() { return compilerCache->stopWriting || !compilerCache->pendingWritesOrder.empty(); });
+        if (compilerCache->pendingWritesOrder.empty()) {
+            break;
+        }
+
+        // Entry stays queued while being written so that lookups can still be served from memory
+        const auto &kernelFileHash = compilerCache->pendingWritesOrder.front();
+        const auto &pendingWrite = compilerCache->pendingWrites[kernelFileHash];
+        lock.unlock();
+        compilerCache->cacheBinary(kernelFileHash, pendingWrite.binary.get(), pendingWrite.binarySize);
+        lock.lock();
+        compilerCache->pendingWritesSize -= pendingWrite.binarySize;
+        compilerCache->pendingWrites.erase(kernelFileHash);
+        compilerCache->pendingWritesOrder.pop_front();
+        compilerCache->pendingWritesCondition.notify_all();
+    }
+    return nullptr;
+}
+
+std::unique_ptr<char[]> CompilerCache::loadPendingBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    std::lock_guard<std::mutex> lock(pendingWritesMtx);
+    auto it = pendingWrites.find(kernelFileHash);
+    if (it == pendingWrites.end()) {
+        return nullptr;
+    }
+    auto &pendingWrite = it->second;
+    auto binaryCopy = std::make_unique<char[]>(pendingWrite.binarySize);
+    memcpy_s(binaryCopy.get(), pendingWrite.binarySize, pendingWrite.binary.get(), pendingWrite.binarySize);
+    cachedBinarySize = pendingWrite.binarySize;
+    return binaryCopy;
+}
+
+void CompilerCache::flushPendingWrites() {
+    std::unique_lock<std::mutex> lock(pendingWritesMtx);
+    pendingWritesCondition.wait(lock, [&]() { return pendingWritesOrder.empty(); });
+}
+
+void CompilerCache::stopWriter() {
+    std::unique_lock<std::mutex> lock(pendingWritesMtx);
+    if (writer == nullptr) {
+        return;
+    }
+    stopWriting = true;
+    lock.unlock();
+    pendingWritesCondition.notify_all();
+    writer->join();
+    writer.reset();
+}
+
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,7 +10,9 @@
 #include "shared/source/os_interface/os_handle.h"
 #include "shared/source/utilities/arrayref.h"
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -18,6 +20,7 @@
 
 namespace NEO {
 struct HardwareInfo;
+class Thread;
 
 struct CompilerCacheConfig {
     bool enabled = false;
@@ -29,7 +32,7 @@ struct CompilerCacheConfig {
 class CompilerCache {
   public:
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
 
     CompilerCache(const CompilerCache &) = delete;
     CompilerCache(CompilerCache &&) = delete;
@@ -47,7 +50,24 @@ class CompilerCache {
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize);
 
+    void cacheBinaryAsync(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    void flushPendingWrites();
+
+    // Drains pending writes and joins the writer thread. Owners and classes overriding cacheBinary
+    // must call it before their state is destroyed, so that the writer never runs during destruction.
+    void stopWriter();
+
+    static constexpr size_t defaultMaxPendingWritesSize = 64u * 1024u * 1024u;
+
   protected:
+    struct PendingCacheWrite {
+        std::unique_ptr<char[]> binary;
+        size_t binarySize = 0u;
+    };
+
+    static void *writePendingBinaries(void *arg);
+    std::unique_ptr<char[]> loadPendingBinary(const std::string &kernelFileHash, size_t &cachedBinarySize);
+
     MOCKABLE_VIRTUAL bool evictCache(uint64_t &bytesEvicted);
     MOCKABLE_VIRTUAL bool renameTempFileBinaryToProperName(const std::string &oldName, const std::string &kernelFileHash);
     MOCKABLE_VIRTUAL bool createUniqueTempFileAndWriteData(char *tmpFilePathTemplate, const char *pBinary, size_t binarySize);
@@ -55,5 +75,14 @@ class CompilerCache {
 
     static std::mutex cacheAccessMtx;
     CompilerCacheConfig config;
+
+    std::unordered_map<std::string, PendingCacheWrite> pendingWrites;
+    std::deque<std::string> pendingWritesOrder;
+    size_t pendingWritesSize = 0u;
+    size_t maxPendingWritesSize = defaultMaxPendingWritesSize;
+    std::mutex pendingWritesMtx;
+    std::condition_variable pendingWritesCondition;
+    std::unique_ptr<Thread> writer;
+    bool stopWriting = false;
 };
 } // namespace NEO
@@ -13,6 +13,7 @@
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/igc_platform_helper.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
+#include "shared/source/compiler_interface/translation_output_cache.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
@@ -28,7 +29,9 @@
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 #include "ocl_igc_interface/platform_helper.h"
 
+#include <algorithm>
 #include <fstream>
+#include <vector>
 
 namespace NEO {
 SpinLock CompilerInterface::spinlock;
@@ -49,8 +52,19 @@ CompilerInterface::CompilerInterface()
     if (debugManager.flags.FinalizerInputType.get() != 0) {
         this->finalizerInputType = debugManager.flags.FinalizerInputType.get();
     }
+    if (debugManager.flags.EnableBuildOutputCache.get() == 1) {
+        auto maxEntriesCount = TranslationOutputCache::defaultMaxEntriesCount;
+        if (debugManager.flags.BuildOutputCacheMaxEntries.get() != -1) {
+            maxEntriesCount = static_cast<size_t>(debugManager.flags.BuildOutputCacheMaxEntries.get());
+        }
+        this->buildOutputCache = std::make_unique<TranslationOutputCache>(maxEntriesCount);
+    }
+}
+CompilerInterface::~CompilerInterface() {
+    if (cache) {
+        cache->stopWriter();
+    }
 }
-CompilerInterface::~CompilerInterface() = default;
 
 TranslationOutput::ErrorCode CompilerInterface::build(
     const NEO::Device &device,
@@ -60,6 +74,46 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         return TranslationOutput::ErrorCode::compilerNotAvailable;
     }
 
+    auto buildOutputCacheKey = getBuildOutputCacheKey(device, input);
+    if (buildOutputCacheKey.empty()) {
+        return buildWithoutOutputCache(device, input, output);
+    }
+
+    // identical builds requested concurrently wait for the first one instead of invoking compilers again
+    if (buildOutputCache->lookupOrStartBuild(buildOutputCacheKey, output)) {
+        return TranslationOutput::ErrorCode::success;
+    }
+    auto retVal = buildWithoutOutputCache(device, input, output);
+    buildOutputCache->finishBuild(buildOutputCacheKey, (retVal == TranslationOutput::ErrorCode::success) ? &output : nullptr);
+    return retVal;
+}
+
+std::string CompilerInterface::getBuildOutputCacheKey(const NEO::Device &device, const TranslationInput &input) {
+    if ((buildOutputCache == nullptr) || (cache == nullptr) || (false == input.allowCaching) || (input.gtPinInput != nullptr)) {
+        return {};
+    }
+
+    std::vector<std::pair<uint32_t, uint64_t>> specConstants(input.specializedValues.begin(), input.specializedValues.end());
+    std::sort(specConstants.begin(), specConstants.end());
+    std::vector<uint32_t> specIds;
+    std::vector<uint64_t> specValues;
+    for (const auto &specConstant : specConstants) {
+        specIds.push_back(specConstant.first);
+        specValues.push_back(specConstant.second);
+    }
+
+    const auto &igc = *getIgc(&device);
+    return cache->getCachedFileName(device.getHardwareInfo(), input.src, input.apiOptions, input.internalOptions,
+                                    ArrayRef<const char>::fromAny(specIds.data(), specIds.size()),
+                                    ArrayRef<const char>::fromAny(specValues.data(), specValues.size()),
+                                    igc.revision, igc.libSize, igc.libMTime) +
+           "_" + std::to_string(input.srcType) + "_" + std::to_string(input.preferredIntermediateType) + "_" + std::to_string(input.outType);
+}
+
+TranslationOutput::ErrorCode CompilerInterface::buildWithoutOutputCache(
+    const NEO::Device &device,
+    const TranslationInput &input,
+    TranslationOutput &output) {
     IGC::CodeType::CodeType_t srcCodeType = input.srcType;
     IGC::CodeType::CodeType_t intermediateCodeType = IGC::CodeType::undefined;
 
@@ -656,7 +710,7 @@ void CompilerCacheHelper::packAndCacheBinary(CompilerCache &compilerCache, const
     singleDeviceBinary.intermediateRepresentation = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(translationOutput.intermediateRepresentation.mem.get()), translationOutput.intermediateRepresentation.size);
 
     if (NEO::isAnyPackedDeviceBinaryFormat(singleDeviceBinary.deviceBinary)) {
-        compilerCache.cacheBinary(kernelFileHash, translationOutput.deviceBinary.mem.get(), translationOutput.deviceBinary.size);
+        compilerCache.cacheBinaryAsync(kernelFileHash, translationOutput.deviceBinary.mem.get(), translationOutput.deviceBinary.size);
         return;
     }
 
@@ -665,7 +719,7 @@ void CompilerCacheHelper::packAndCacheBinary(CompilerCache &compilerCache, const
     auto packedBinary = packDeviceBinary<DeviceBinaryFormat::oclElf>(singleDeviceBinary, packErrors, packWarnings);
 
     if (false == packedBinary.empty()) {
-        compilerCache.cacheBinary(kernelFileHash, reinterpret_cast<const char *>(packedBinary.data()), packedBinary.size());
+        compilerCache.cacheBinaryAsync(kernelFileHash, reinterpret_cast<const char *>(packedBinary.data()), packedBinary.size());
     }
 }
 
@@ -22,6 +22,7 @@ namespace NEO {
 enum class SipKernelType : std::uint32_t;
 class OsLibrary;
 class CompilerCache;
+class TranslationOutputCache;
 class Device;
 struct TargetDevice;
 
@@ -156,6 +157,10 @@ class CompilerInterface {
     bool addOptionDisableZebin(std::string &options, std::string &internalOptions);
     bool disableZebin(std::string &options, std::string &internalOptions);
 
+    CompilerCache *getCache() const {
+        return cache.get();
+    }
+
   protected:
     struct CompilerLibraryEntry {
         std::string revision;
@@ -166,6 +171,8 @@ class CompilerInterface {
     };
 
     MOCKABLE_VIRTUAL bool initialize(std::unique_ptr<CompilerCache> &&cache, bool requireFcl);
+    TranslationOutput::ErrorCode buildWithoutOutputCache(const NEO::Device &device, const TranslationInput &input, TranslationOutput &output);
+    std::string getBuildOutputCacheKey(const NEO::Device &device, const TranslationInput &input);
     MOCKABLE_VIRTUAL bool loadFcl();
     MOCKABLE_VIRTUAL bool loadIgcBasedCompiler(CompilerLibraryEntry &entryPoint, const char *libName);
 
@@ -177,6 +184,7 @@ class CompilerInterface {
         return std::unique_lock<SpinLock>{spinlock};
     }
     std::unique_ptr<CompilerCache> cache;
+    std::unique_ptr<TranslationOutputCache> buildOutputCache;
 
     using igcDevCtxUptr = CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL>;
     using finalizerDevCtxUptr = CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL>;
@@ -278,8 +278,12 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
-    std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
+    auto pendingBinary = loadPendingBinary(kernelFileHash, cachedBinarySize);
+    if (pendingBinary) {
+        return pendingBinary;
+    }
 
+    std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
     return loadDataFromFile(filePath.c_str(), cachedBinarySize);
 }
 } // namespace NEO
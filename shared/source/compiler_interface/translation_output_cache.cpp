@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/translation_output_cache.h"
+
+#include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/helpers/string.h"
+
+namespace NEO {
+
+TranslationOutputCache::TranslationOutputCache(size_t maxEntriesCount) : maxEntriesCount(maxEntriesCount) {}
+
+TranslationOutputCache::~TranslationOutputCache() = default;
+
+bool TranslationOutputCache::lookupOrStartBuild(const std::string &key, TranslationOutput &output) {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        auto entry = entries.find(key);
+        if (entry != entries.end()) {
+            lru.splice(lru.begin(), lru, entry->second);
+            copyOutput(output, *entry->second->second);
+            return true;
+        }
+        if (buildsInFlight.insert(key).second) {
+            return false;
+        }
+        buildFinished.wait(lock);
+    }
+}
+
+void TranslationOutputCache::finishBuild(const std::string &key, const TranslationOutput *output) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        buildsInFlight.erase(key);
+        if (output && (maxEntriesCount > 0u) && (entries.find(key) == entries.end())) {
+            auto cachedOutput = std::make_unique<TranslationOutput>();
+            copyOutput(*cachedOutput, *output);
+            lru.emplace_front(key, std::move(cachedOutput));
+            entries[key] = lru.begin();
+            if (lru.size() > maxEntriesCount) {
+                entries.erase(lru.back().first);
+                lru.pop_back();
+            }
+        }
+    }
+    buildFinished.notify_all();
+}
+
+size_t TranslationOutputCache::getEntriesCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return lru.size();
+}
+
+void TranslationOutputCache::copyOutput(TranslationOutput &dst, const TranslationOutput &src) {
+    auto copyMemAndSize = [](TranslationOutput::MemAndSize &dst, const TranslationOutput::MemAndSize &src) {
+        dst.mem = src.mem ? ::makeCopy(src.mem.get(), src.size) : nullptr;
+        dst.size = src.size;
+    };
+    dst.intermediateCodeType = src.intermediateCodeType;
+    copyMemAndSize(dst.intermediateRepresentation, src.intermediateRepresentation);
+    copyMemAndSize(dst.finalizerInputRepresentation, src.finalizerInputRepresentation);
+    copyMemAndSize(dst.deviceBinary, src.deviceBinary);
+    copyMemAndSize(dst.debugData, src.debugData);
+    dst.frontendCompilerLog = src.frontendCompilerLog;
+    dst.backendCompilerLog = src.backendCompilerLog;
+}
+
+} // namespace NEO
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace NEO {
+struct TranslationOutput;
+
+// In-process LRU of successful build outputs keyed by build hash.
+// Only one thread builds given key at a time, other threads asking for the same key wait for its result.
+class TranslationOutputCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultMaxEntriesCount = 64u;
+
+    TranslationOutputCache(size_t maxEntriesCount);
+    ~TranslationOutputCache();
+
+    // Returns true when output was copied from cache. Otherwise caller becomes builder of the key and has to call finishBuild.
+    bool lookupOrStartBuild(const std::string &key, TranslationOutput &output);
+    // Pass nullptr when build failed, waiting threads will try to build the key on their own.
+    void finishBuild(const std::string &key, const TranslationOutput *output);
+
+    size_t getEntriesCount();
+
+    static void copyOutput(TranslationOutput &dst, const TranslationOutput &src);
+
+  protected:
+    using LruList = std::list<std::pair<std::string, std::unique_ptr<TranslationOutput>>>;
+
+    std::mutex mutex;
+    std::condition_variable buildFinished;
+    LruList lru;
+    std::unordered_map<std::string, LruList::iterator> entries;
+    std::unordered_set<std::string> buildsInFlight;
+    size_t maxEntriesCount = defaultMaxEntriesCount;
+};
+
+} // namespace NEO
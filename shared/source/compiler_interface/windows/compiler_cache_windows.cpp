@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -315,6 +315,11 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    auto pendingBinary = loadPendingBinary(kernelFileHash, cachedBinarySize);
+    if (pendingBinary) {
+        return pendingBinary;
+    }
+
     std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
     return loadDataFromFile(filePath.c_str(), cachedBinarySize);
 }
@@ -271,6 +271,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, DebugSetMemoryDiagnosticsDelay, -1, "-1: default
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceStateVerification, -1, "-1: default, 0: disable, 1: enable check of device state before submit on Windows")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceStateVerificationAfterFailedSubmission, -1, "-1: default, 0: disable, 1: enable check of device state after failed submit on Windows")
 DECLARE_DEBUG_VARIABLE(int32_t, PrintTimestampPacketUsage, -1, "-1: default, 0: Disabled, 1: Print when TSP is allocated, initialized, returned to pool, etc.")
+DECLARE_DEBUG_VARIABLE(int32_t, PrintTagAllocatorCounters, -1, "-1: default, 0: Disabled, 1: Print slow path and thread cache counters when tag allocator is destroyed")
+DECLARE_DEBUG_VARIABLE(int32_t, TagAllocatorThreadCacheSize, -1, "Number of free tags kept in each per-thread cache of tag allocators. -1: default (0), 0: disabled, >0: cache size")
+DECLARE_DEBUG_VARIABLE(int32_t, PrintBindlessHeapsHelperCounters, -1, "-1: default, 0: Disabled, 1: Print slot allocation, release and lock contention counters when bindless heaps helper is destroyed")
 DECLARE_DEBUG_VARIABLE(int32_t, SynchronizeEventBeforeReset, -1, "-1: default, 0: Disabled, 1: Synchronize Event completion on host before calling reset. 2: Synchronize + print extra logs.")
 DECLARE_DEBUG_VARIABLE(int32_t, TrackNumCsrClientsOnSyncPoints, -1, "-1: default, 0: Disabled, 1: If set, synchronization points like zeEventHostSynchronize will unregister CmdQ from CSR clients")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDriverVersion, -1, "-1: default, >=0: Use value as reported driver version")
@@ -337,6 +340,11 @@ DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs d
 DECLARE_DEBUG_VARIABLE(bool, PrintLWSSizes, false, "prints driver chosen local workgroup sizes")
 DECLARE_DEBUG_VARIABLE(bool, PrintDispatchParameters, false, "prints dispatch parameters of kernels passed to clEnqueueNDRangeKernel")
 DECLARE_DEBUG_VARIABLE(bool, PrintProgramBinaryProcessingTime, false, "prints execution time of Program::processGenBinary() method during program building")
+DECLARE_DEBUG_VARIABLE(bool, PrintModuleBuildStageTimes, false, "prints execution time of each stage of L0 module build")
+DECLARE_DEBUG_VARIABLE(bool, PrintUsmMemAllocPoolStats, false, "prints usm pools statistics (hit rate, fragmentation) when pools are cleaned up")
+DECLARE_DEBUG_VARIABLE(bool, PrintImmediateCmdListSubmissionCoalescing, false, "prints number of coalesced appends submitted with each immediate command list flush")
+DECLARE_DEBUG_VARIABLE(std::string, PerfTraceFile, std::string("unk"), "Record api, ioctl, wait and flush events into per thread ring buffers and write them to this binary file in the background, unk: disabled")
+DECLARE_DEBUG_VARIABLE(int32_t, PerfTraceBufferSize, -1, "Number of records in per thread perf trace ring buffers, -1: default (65536)")
 DECLARE_DEBUG_VARIABLE(bool, PrintRelocations, false, "prints relocations debug information")
 DECLARE_DEBUG_VARIABLE(bool, PrintTimestampPacketContents, false, "prints all timestamps values during profiling data calculation")
 DECLARE_DEBUG_VARIABLE(bool, PrintCalculatedTimestamps, false, "prints final l0 timestamps values for profiling data calculation")
@@ -395,6 +403,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ResolveDependenciesViaPipeControls, -1, "-1: def
 DECLARE_DEBUG_VARIABLE(int32_t, MakeIndirectAllocationsResidentAsPack, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver handles all indirect allocations as one pack instead of making them resident individually.")
 DECLARE_DEBUG_VARIABLE(int32_t, DetectIndirectAccessInKernel, -1, "-1: default, 0:disabled, 1: enabled. If enabled and indirect accesses are not detected in kernel, indirect allocations will not be allowed even if set by API.")
 DECLARE_DEBUG_VARIABLE(int32_t, MakeEachAllocationResident, -1, "-1: default, 0: disabled, 1: bind every allocation at creation time, 2: bind all created allocations in flush")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIncrementalResidency, -1, "With vm bind, keep allocations resident between submissions and pass only allocations whose residency changed since the previous submission to the residency container, -1:default(disabled), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, AssignBCSAtEnqueue, -1, "-1: default, 0:disabled, 1: enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferCmdQGpgpuInitialization, -1, "-1: default, 0:disabled, 1: enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferCmdQBcsInitialization, -1, "-1: default, 0:disabled, 1: enabled.")
@@ -414,6 +423,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, DispatchCmdlistCmdBufferPrimary, -1, "-1: defaul
 DECLARE_DEBUG_VARIABLE(int32_t, UseImmediateFlushTask, -1, "-1: default, 0: use regular flush task, 1: use immediate flush task")
 DECLARE_DEBUG_VARIABLE(int32_t, SkipDcFlushOnBarrierWithoutEvents, -1, "-1: default (enabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceUsmAllocationPool, -1, "-1: default (enabled, 2MB), 0: disabled, >=1: enabled, size in MB")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmMemAllocPoolShardsCount, -1, "Number of shards of each preallocated device usm pool, threads start allocating from different shards. -1: default (1), >0: number of shards, capped so that every shard fits the largest size serviced by the pool")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostUsmAllocationPool, -1, "-1: default (enabled, 2MB), 0: disabled, >=1: enabled, size in MB")
 DECLARE_DEBUG_VARIABLE(int32_t, UseLocalPreferredForCacheableBuffers, -1, "Use localPreferred for cacheable buffers")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCopyWithStagingBuffers, -1, "Enable copy with non-usm memory through staging buffers. -1: default, 0: disabled, 1: enabled")
@@ -422,6 +432,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForcePostSyncL1Flush, -1, "-1: default (do nothi
 DECLARE_DEBUG_VARIABLE(int32_t, AllowNotZeroForCompressedOnWddm, -1, "-1: default (do nothing), 0: do not set AllowNotZeroed for compressed resources, 1: set AllowNotZeroed for compressed resources");
 DECLARE_DEBUG_VARIABLE(int32_t, ForceWddmHugeChunkSizeMB, -1, "-1: default (do nothing), >0: set given huge chunk size in MegaBytes for WDDM");
 DECLARE_DEBUG_VARIABLE(int64_t, ForceGmmSystemMemoryBufferForAllocations, 0, "0: default, >0: (bitmask) for given Allocation Types, force GMM_RESOURCE_USAGE_OCL_SYSTEM_MEMORY_BUFFER gmm resource type");
+DECLARE_DEBUG_VARIABLE(int32_t, EnableWorkGroupSizeAutotuning, -1, "-1: default (disabled), 0: disabled, 1: enabled, when local work size is not provided time candidate work group sizes on profiled launches and reuse the fastest one")
+DECLARE_DEBUG_VARIABLE(int32_t, WorkGroupSizeAutotuningSamples, -1, "-1: default (3), >0: number of timed launches per candidate work group size before autotuning converges")
+DECLARE_DEBUG_VARIABLE(int32_t, PersistWorkGroupSizeAutotuning, -1, "-1: default (disabled), 0: disabled, 1: enabled, store autotuned work group sizes in compiler cache directory and reuse them in later runs")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -466,9 +479,13 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionSwitchSemaphoreMode, -1, "-1: de
 DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address of submitted command buffers")
 DECLARE_DEBUG_VARIABLE(int32_t, WaitForPagingFenceInController, -1, "Instead of waiting for paging fence on user thread, program additional semaphore which will be signaled by direct submission controller when paging fence reaches required value -1: default, 0 - disable, 1 - enable.")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerIdleDetection, -1, "Terminate direct submission only if CSR is idle. -1: default, 0 - disable, 1 - enable.")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerTimeoutPolicy, -1, "Policy deciding when idle direct submission is stopped. -1: default (0), 0 - static timeout, 1 - predict next submission from idle gaps of each CSR and keep ring running when it is expected soon")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerMaxPredictedIdleGap, -1, "Longest predicted idle gap for which direct submission is kept running when DirectSubmissionControllerTimeoutPolicy=1. -1: default 100000 us, >=0: time in us")
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, false, "Evict USM allocation after implicit migration to GPU")
 DECLARE_DEBUG_VARIABLE(bool, RegisterPageFaultHandlerOnMigration, false, "Register handler on migration to GPU when current is not from pagefault manager")
+DECLARE_DEBUG_VARIABLE(int32_t, PageFaultManagerFaultAheadCount, -1, "-1: default (0), >0: number of following shared allocations from the same allocs manager migrated to CPU together with faulting one")
+DECLARE_DEBUG_VARIABLE(int32_t, PageFaultManagerCoalesceProtection, -1, "-1: default, 0: disabled, 1: enabled. Protect shared allocations adjacent in memory with single call when migrating them to GPU")
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
 DECLARE_DEBUG_VARIABLE(bool, EnablePackedYuv, true, "Enables cl_packed_yuv extension")
 DECLARE_DEBUG_VARIABLE(bool, EnableDeferredDeleter, true, "Enables async deleter")
@@ -487,6 +504,7 @@ DECLARE_DEBUG_VARIABLE(bool, EnableAIL, true, "Enables AIL")
 DECLARE_DEBUG_VARIABLE(bool, EnableReservingInSvmRange, true, "Enables reserving virtual memory in the SVM range")
 DECLARE_DEBUG_VARIABLE(bool, DisableProgrammableMetricsSupport, false, "Disable Programmable Metrics support")
 DECLARE_DEBUG_VARIABLE(int64_t, VmBindWaitUserFenceTimeout, -1, "-1: default, >0: time in ns for wait function timeout")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBatchedVmBind, -1, "Coalesce vm binds issued while making allocations resident into array binds with a single user fence wait per batch, -1:default(disabled), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceRunAloneContext, -1, "Control creation of run-alone HW context, -1:default, 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, AddClGlSharing, -1, "Add cl-gl extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelTunning, -1, "Perform a tunning of enqueue kernel, -1:default(disabled), 0:disable, 1:enable simple kernel tunning, 2:enable full kernel tunning")
@@ -553,6 +571,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, UseDrmCompletionFenceForAllAllocations, -1, "Use
 DECLARE_DEBUG_VARIABLE(int32_t, EnableChipsetUniqueUUID, -1, "Enables retrieving chipset unique UUID using telemetry, -1:default (enabled), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableFlushTaskSubmission, -1, "Driver uses csr flushTask for immediate commandlist submissions, -1:default (enabled), 0:disabled, 1:enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableImmediateCmdListHeapSharing, -1, "Immediate command lists using flush task use current csr heap instead private cmd list heap, -1:default (disabled), 0:disabled, 1:enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableImmediateCmdListSubmissionCoalescing, -1, "Immediate command lists using flush task defer submission of consecutive non-blocking kernel appends without events until a size or time limit or host synchronization is hit, -1:default (disabled), 0:disabled, 1:enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListSubmissionCoalescingMaxSize, -1, "Command buffer bytes accumulated by coalesced appends after which they are submitted, -1: default (16KB)")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListSubmissionCoalescingWindowUs, -1, "Time in microseconds since first coalesced append after which coalesced appends are submitted by next append or by periodic task scheduler thread, -1: default (50us)")
 DECLARE_DEBUG_VARIABLE(int32_t, UsePipeControlMultiKernelEventSync, -1, "Use single PIPE_CONTROL for event signal of multi-kernel append operations instead multi-packet POSTSYNC_DATA from each COMPUTE_WALKER, -1: default , 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, CompactL3FlushEventPacket, -1, "Compact COMPUTE_WALKER event packet and L3 Flush signal packet into single event packet, -1: default , 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, UseDynamicEventPacketsCount, -1, "Use dynamic estimation for event packet count based on a given device configuration, -1: default , 0: disabled, 1: enabled")
@@ -587,15 +608,28 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableDeviceAllocationCache, -1, "Ex
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableHostAllocationCache, -1, "Experimentally enable host usm allocation cache. Use X% of shared system memory.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalUSMAllocationReuseVersion, -1, "Version of mechanism to use for usm allocation reuse.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalUSMAllocationReuseCleaner, -1, "Enable usm allocation reuse cleaner. -1: default, 0: disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePeriodicTaskScheduler, -1, "Run runtime housekeeping (usm allocation reuse cleaner, direct submission controller, deferred deleter, gem close worker) on shared service threads instead of dedicated threads. -1: default (disabled), 0: disable, 1: enable")
+DECLARE_DEBUG_VARIABLE(int32_t, PeriodicTaskSchedulerCoalescingWindowUs, -1, "Periodic tasks due within given number of microseconds are executed in a single wakeup of the service thread. -1: default (10000)")
+DECLARE_DEBUG_VARIABLE(int32_t, PeriodicTaskSchedulerThreadsCount, -1, "Number of service threads executing tasks of periodic task scheduler. -1: default (1)")
+DECLARE_DEBUG_VARIABLE(int64_t, PeriodicTaskSchedulerCpuAffinityMask, -1, "Restrict service threads of periodic task scheduler to CPUs selected by bit mask. -1: default (no restriction)")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalH2DCpuCopyThreshold, -1, "Override default threshold (in bytes) for H2D CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override default threshold (in bytes) for D2H CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalForceCopyThroughLock, -1, "Force copy through lock pointer on zeAppendMemoryCopy for all cases -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer under 4KB.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLockWaitlistSizeThreshold, -1, "If less than given value, driver will wait for Waitlist on host, instead of sending appendBarrier. If 0, always use barrier.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCpuCopyEngine, -1, "Copy through locked ptr with multi-threaded CPU copy engine. -1: default (disabled), 0: disable, 1: enable")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyEngineWorkersCount, -1, "Number of worker threads helping the calling thread in CPU copies. -1: default (min(3, half of hardware threads)), 0: copy on calling thread only")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyEngineMinChunkSize, -1, "Minimal size (in bytes) of a part of CPU copy executed by a single thread. -1: default (1MB)")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyEngineNonTemporalStores, -1, "Use non-temporal stores in CPU copies. -1: default (write combined destinations only), 0: disable, 1: all destinations")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyEngineAdaptiveThresholds, -1, "Scale CPU copy size thresholds by measured speedup of parallel CPU copies. -1: default (disabled), 0: disable, 1: enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSysmanTelemetrySampler, -1, "Read sysman counters on background thread and serve queries from last sampled snapshot. -1: default (disabled), 0: disable, 1: enable")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanTelemetrySamplerPeriodMs, -1, "Period of sysman telemetry sampling in milliseconds. -1: default (50 ms)")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API. When enabled - Level Zero debugging is disabled.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableTileAttach, true, "Experimentally enable attaching to tiles (subdevices).")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalAlignLocalMemorySizeTo2MB, false, "Experimentally align all local memory allocations size to 2MB.")
+DECLARE_DEBUG_VARIABLE(int32_t, ModuleBuildThreadsCount, -1, "Number of threads used to decode zeInfo kernels and initialize kernels during L0 module build, taken from a worker pool reused across modules. -1: default (1), >1: decode and initialize kernels in parallel")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHeapAllocatorSegregatedFreeChunks, -1, "Keep freed chunks of heap allocators in size-class bins with address ordered coalescing instead of vectors. -1: default (disabled), 0: disable, 1: enable")
 
 /*DRIVER TOGGLES*/
 DECLARE_DEBUG_VARIABLE(bool, UseMaxSimdSizeToDeduceMaxWorkgroupSize, false, "With this flag on, max workgroup size is deduced using SIMD32 instead of SIMD8, this causes the max wkg size to be 4 times bigger")
@@ -677,6 +711,10 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableGlobalTimestampViaSubmission, -1, "-1: OS
 
 /* Binary Cache */
 DECLARE_DEBUG_VARIABLE(bool, BinaryCacheTrace, false, "enable cl_cache to produce .trace files with information about hash computation")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncCompilerCacheWrites, -1, "-1: default (disabled), 0: disabled, 1: enabled, store compiled binaries in cl_cache on a background thread; pending binaries are served from memory")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDecodedProgramCache, -1, "-1: default (disabled), 0: disabled, 1: enabled, store decoded zeInfo next to cached binaries and reuse it instead of parsing zeInfo again")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBuildOutputCache, -1, "-1: default (disabled), 0: disabled, 1: enabled, keep outputs of recent builds in memory and let only one thread build identical program at a time")
+DECLARE_DEBUG_VARIABLE(int32_t, BuildOutputCacheMaxEntries, -1, "Maximum number of build outputs kept in memory when EnableBuildOutputCache is set. -1: default (64)")
 
 /* WORKAROUND FLAGS */
 DECLARE_DEBUG_VARIABLE(int32_t, ForceDummyBlitWa, -1, "-1: default, 0: disabled, 1: enabled, Forces a workaround with dummy blits, driver adds an extra blit before command MI_ARB_CHECK on bcs")
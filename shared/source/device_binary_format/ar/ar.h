@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,8 @@ namespace Ar {
 
 inline constexpr ConstStringRef arMagic = "!<arch>\n";
 inline constexpr ConstStringRef arFileEntryTrailingMagic = "\x60\x0A";
+// data of alias file entry is arAliasMagic followed by name of file entry holding the same data
+inline constexpr ConstStringRef arAliasMagic = "!<alias>\n";
 
 struct ArFileEntryHeader {
     char identifier[16] = {'/', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '};
@@ -30,6 +32,8 @@ namespace SpecialFileNames {
 inline constexpr ConstStringRef longFileNamesFile = "//";
 inline constexpr char longFileNamePrefix = '/';
 inline constexpr char fileNameTerminator = '/';
+// optional first file entry, each line is '<file name> <data offset> <data size>' with offset relative to end of index data
+inline constexpr ConstStringRef indexFile = "index";
 } // namespace SpecialFileNames
 
 } // namespace Ar
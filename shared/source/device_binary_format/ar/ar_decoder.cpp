@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,10 +8,74 @@
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
 
 #include <cstdint>
+#include <string>
 
 namespace NEO {
 namespace Ar {
 
+bool readIndexNumber(const std::string &number, uint64_t &outValue) {
+    if (number.empty() || (number.size() > 19U) || (std::string::npos != number.find_first_not_of("0123456789"))) {
+        return false;
+    }
+    outValue = std::stoull(number);
+    return true;
+}
+
+bool decodeIndex(const ArrayRef<const uint8_t> binary, const ArFileEntryHeaderAndData &indexEntry, Ar &out) {
+    const uint8_t *filesBegin = indexEntry.fileData.end() + (indexEntry.fileData.size() & 1U);
+    const size_t filesSize = binary.end() - filesBegin;
+    ConstStringRef indexData(reinterpret_cast<const char *>(indexEntry.fileData.begin()), indexEntry.fileData.size());
+
+    size_t lineBegin = 0U;
+    while (lineBegin < indexData.size()) {
+        size_t lineEnd = lineBegin;
+        while ((lineEnd < indexData.size()) && (indexData[lineEnd] != '\n')) {
+            ++lineEnd;
+        }
+        ConstStringRef line(indexData.begin() + lineBegin, lineEnd - lineBegin);
+        lineBegin = lineEnd + 1;
+        if (line.empty()) {
+            continue;
+        }
+
+        std::string lineString = line.str();
+        auto sizePos = lineString.rfind(' ');
+        if ((std::string::npos == sizePos) || (0U == sizePos)) {
+            return false;
+        }
+        auto offsetPos = lineString.rfind(' ', sizePos - 1);
+        if ((std::string::npos == offsetPos) || (0U == offsetPos)) {
+            return false;
+        }
+        uint64_t dataOffset = 0U;
+        uint64_t dataSize = 0U;
+        if (!readIndexNumber(lineString.substr(offsetPos + 1, sizePos - offsetPos - 1), dataOffset) ||
+            !readIndexNumber(lineString.substr(sizePos + 1), dataSize) ||
+            (dataOffset < sizeof(ArFileEntryHeader)) || (dataOffset > filesSize) || (dataSize > filesSize - dataOffset)) {
+            return false;
+        }
+
+        ArFileEntryHeaderAndData fileEntry = {};
+        fileEntry.fileName = ConstStringRef(line.begin(), offsetPos);
+        fileEntry.fileData = ArrayRef<const uint8_t>(filesBegin + dataOffset, static_cast<size_t>(dataSize));
+        fileEntry.fullHeader = reinterpret_cast<const ArFileEntryHeader *>(filesBegin + dataOffset - sizeof(ArFileEntryHeader));
+        out.files.push_back(fileEntry);
+    }
+    return true;
+}
+
+bool resolveAlias(ArFileEntryHeaderAndData &fileEntry, const Ar &ar) {
+    ConstStringRef targetName(reinterpret_cast<const char *>(fileEntry.fileData.begin()) + arAliasMagic.size(), fileEntry.fileData.size() - arAliasMagic.size());
+    for (const auto &file : ar.files) {
+        if (file.fileName == targetName) {
+            fileEntry.fileData = file.fileData;
+            fileEntry.fullHeader = file.fullHeader;
+            return true;
+        }
+    }
+    return false;
+}
+
 Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std::string &outWarnings) {
     if (false == isAr(binary)) {
         outErrReason = "Not an AR archive - mismatched file signature";
@@ -57,7 +121,24 @@ Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std
                     return {};
                 }
             }
-            ret.files.push_back(fileEntry);
+
+            if (SpecialFileNames::indexFile == fileEntry.fileName) {
+                // index lists all files, so remaining file entries don't have to be read
+                ret.indexEntry = fileEntry;
+                if ((decodePos == binary.begin() + arMagic.size()) && decodeIndex(binary, fileEntry, ret)) {
+                    return ret;
+                }
+                ret.files.clear();
+                outWarnings.append("Invalid AR index, decoding all file entries");
+            } else if (NEO::hasSameMagic(arAliasMagic, fileEntry.fileData)) {
+                if (false == resolveAlias(fileEntry, ret)) {
+                    outErrReason = "Corrupt AR archive - alias file entry '" + fileEntry.fileName.str() + "' refers to unknown file entry";
+                    return {};
+                }
+                ret.files.push_back(fileEntry);
+            } else {
+                ret.files.push_back(fileEntry);
+            }
         }
 
         decodePos = fileEntryDataPos + fileSize;
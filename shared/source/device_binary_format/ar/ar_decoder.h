@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@ struct Ar {
     const char *magic = nullptr;
     StackVec<ArFileEntryHeaderAndData, 32> files;
     ArFileEntryHeaderAndData longFileNamesEntry;
+    ArFileEntryHeaderAndData indexEntry;
 };
 
 inline bool isAr(const ArrayRef<const uint8_t> binary) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,7 +7,11 @@
 
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 
 #include <vector>
@@ -15,7 +19,61 @@
 namespace NEO {
 namespace Ar {
 
+ArEncoder::ArEncoder(bool padTo8Bytes, bool deduplicate) : deduplicate(deduplicate) {
+    if (deduplicate) {
+        dataAlignment = MemoryConstants::pageSize;
+    } else if (padTo8Bytes) {
+        dataAlignment = 8U;
+    }
+}
+
 ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData) {
+    if (false == deduplicate) {
+        return appendFileEntry(fileName, fileData, dataAlignment != 0U);
+    }
+    if (fileName == SpecialFileNames::indexFile) {
+        return nullptr;
+    }
+
+    auto dataHash = Hash::hash(reinterpret_cast<const char *>(fileData.begin()), fileData.size());
+    auto storedData = findStoredFileData(dataHash, fileData);
+    if (storedData) {
+        std::string aliasData = arAliasMagic.str() + storedData->fileName;
+        auto header = appendFileEntry(fileName, ArrayRef<const uint8_t>::fromAny(aliasData.c_str(), aliasData.size()), false);
+        if (header) {
+            addToIndex(fileName, *storedData);
+        }
+        return header;
+    }
+
+    auto header = appendFileEntry(fileName, fileData, true);
+    if (header) {
+        StoredFileData newData;
+        newData.fileName = fileName.str();
+        newData.dataOffset = ptrDiff(header + 1, fileEntries.data());
+        newData.dataSize = fileData.size();
+        addToIndex(fileName, newData);
+        storedFileData.insert({dataHash, std::move(newData)});
+    }
+    return header;
+}
+
+const ArEncoder::StoredFileData *ArEncoder::findStoredFileData(uint64_t dataHash, const ArrayRef<const uint8_t> fileData) const {
+    auto range = storedFileData.equal_range(dataHash);
+    for (auto it = range.first; it != range.second; ++it) {
+        const auto &storedData = it->second;
+        if ((storedData.dataSize == fileData.size()) && (0 == memcmp(fileEntries.data() + storedData.dataOffset, fileData.begin(), fileData.size()))) {
+            return &storedData;
+        }
+    }
+    return nullptr;
+}
+
+void ArEncoder::addToIndex(const ConstStringRef fileName, const StoredFileData &data) {
+    index += fileName.str() + " " + std::to_string(data.dataOffset) + " " + std::to_string(data.dataSize) + "\n";
+}
+
+ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData, bool alignData) {
     if (fileName.size() > sizeof(ArFileEntryHeader::identifier) - 1) {
         return nullptr; // encoding long identifiers is not supported
     }
@@ -26,13 +84,14 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
     auto alignedFileSize = fileData.size() + (fileData.size() & 1U);
     ArFileEntryHeader header = {};
 
-    if (padTo8Bytes && (0 != ((fileEntries.size() + sizeof(ArFileEntryHeader)) % 8))) {
+    // file entries start at offset aligned to dataAlignment, see encode()
+    if (alignData && (0 != ((fileEntries.size() + sizeof(ArFileEntryHeader)) % dataAlignment))) {
         ArFileEntryHeader paddingHeader = {};
         auto paddingName = "pad_" + std::to_string(paddingEntry++);
         UNRECOVERABLE_IF(paddingName.length() > sizeof(paddingHeader.identifier));
         memcpy_s(paddingHeader.identifier, sizeof(paddingHeader.identifier), paddingName.c_str(), paddingName.size());
         paddingHeader.identifier[paddingName.size()] = SpecialFileNames::fileNameTerminator;
-        size_t paddingSize = 8U - ((fileEntries.size() + 2 * sizeof(ArFileEntryHeader)) % 8);
+        size_t paddingSize = dataAlignment - ((fileEntries.size() + 2 * sizeof(ArFileEntryHeader)) % dataAlignment);
         auto padSizeString = std::to_string(paddingSize);
         memcpy_s(paddingHeader.fileSizeInBytes, sizeof(paddingHeader.fileSizeInBytes), padSizeString.c_str(), padSizeString.size());
         this->fileEntries.reserve(this->fileEntries.size() + sizeof(paddingHeader) + paddingSize + sizeof(header) + alignedFileSize);
@@ -57,6 +116,19 @@ std::vector<uint8_t> ArEncoder::encode() const {
     std::vector<uint8_t> ret;
     ret.reserve(arMagic.size() + 1);
     ret.insert(ret.end(), reinterpret_cast<const uint8_t *>(arMagic.begin()), reinterpret_cast<const uint8_t *>(arMagic.end()));
+    if (deduplicate) {
+        // index data is padded with new lines, so that following file entries start at aligned offset
+        auto indexDataSize = alignUp(arMagic.size() + sizeof(ArFileEntryHeader) + index.size(), dataAlignment) - arMagic.size() - sizeof(ArFileEntryHeader);
+        ArFileEntryHeader indexHeader = {};
+        memcpy_s(indexHeader.identifier, sizeof(indexHeader.identifier), SpecialFileNames::indexFile.data(), SpecialFileNames::indexFile.size());
+        indexHeader.identifier[SpecialFileNames::indexFile.size()] = SpecialFileNames::fileNameTerminator;
+        auto sizeString = std::to_string(indexDataSize);
+        memcpy_s(indexHeader.fileSizeInBytes, sizeof(indexHeader.fileSizeInBytes), sizeString.c_str(), sizeString.size());
+        ret.reserve(ret.size() + sizeof(indexHeader) + indexDataSize + fileEntries.size());
+        ret.insert(ret.end(), reinterpret_cast<uint8_t *>(&indexHeader), reinterpret_cast<uint8_t *>(&indexHeader + 1));
+        ret.insert(ret.end(), index.begin(), index.end());
+        ret.resize(ret.size() + indexDataSize - index.size(), '\n');
+    }
     ret.insert(ret.end(), this->fileEntries.begin(), this->fileEntries.end());
     return ret;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,19 +12,36 @@
 #include "shared/source/utilities/const_stringref.h"
 
 #include <cstdint>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
 namespace Ar {
 
 struct ArEncoder {
-    ArEncoder(bool padTo8Bytes = false) : padTo8Bytes(padTo8Bytes) {}
+    // Deduplicating encoder stores identical file data once and appends alias entries for next copies.
+    // It also prepends index of all files and aligns file data to page size, so data can be used in place.
+    ArEncoder(bool padTo8Bytes = false, bool deduplicate = false);
     ArFileEntryHeader *appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData);
     std::vector<uint8_t> encode() const;
 
   protected:
+    struct StoredFileData {
+        std::string fileName;
+        size_t dataOffset = 0U;
+        size_t dataSize = 0U;
+    };
+
+    ArFileEntryHeader *appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData, bool alignData);
+    const StoredFileData *findStoredFileData(uint64_t dataHash, const ArrayRef<const uint8_t> fileData) const;
+    void addToIndex(const ConstStringRef fileName, const StoredFileData &data);
+
     std::vector<uint8_t> fileEntries;
-    bool padTo8Bytes = false;
+    std::unordered_multimap<uint64_t, StoredFileData> storedFileData;
+    std::string index;
+    size_t dataAlignment = 0U;
+    bool deduplicate = false;
     uint32_t paddingEntry = 0U;
 };
 
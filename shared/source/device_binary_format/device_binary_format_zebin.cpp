@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -117,6 +117,8 @@ DecodeError decodeSingleZebin(ProgramInfo &dst, const SingleDeviceBinary &src, s
     dst.grfSize = src.targetDevice.grfSize;
     dst.minScratchSpaceSize = src.targetDevice.minScratchSpaceSize;
     dst.indirectDetectionVersion = src.generatorFeatureVersions.indirectMemoryAccessDetection;
+    dst.decodedProgramCache = src.decodedProgramCache;
+    dst.runForEachKernel = src.runForEachKernel;
     auto decodeError = NEO::Zebin::decodeZebin<numBits>(dst, elf, outErrReason, outWarning);
     if (DecodeError::success != decodeError) {
         return decodeError;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,10 +12,12 @@
 #include "shared/source/utilities/const_stringref.h"
 
 #include <cstdint>
+#include <functional>
 #include <igfxfmid.h>
 #include <vector>
 
 namespace NEO {
+class CompilerCache;
 struct ProgramInfo;
 struct RootDeviceEnvironment;
 class GfxCoreHelper;
@@ -80,6 +82,8 @@ struct SingleDeviceBinary {
     ArrayRef<const uint8_t> packedTargetDeviceBinary;
     ConstStringRef buildOptions;
     TargetDevice targetDevice;
+    CompilerCache *decodedProgramCache = nullptr;
+    std::function<void(size_t itemsCount, const std::function<void(size_t)> &work)> runForEachKernel;
     GeneratorType generator = GeneratorType::igc;
     struct GeneratorFeatureVersions {
         using VersionT = uint32_t;
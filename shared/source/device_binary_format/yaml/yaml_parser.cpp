@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#include "shared/source/device_binary_format/yaml/yaml_scanner.h"
+
 namespace NEO {
 
 namespace Yaml {
@@ -158,8 +160,13 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
         switch (context.pos[0]) {
         case ' ':
-            context.lineIndent += context.isParsingIdent ? 1 : 0;
-            ++context.pos;
+            if (context.isParsingIdent) {
+                auto indentEnd = skipCharacter(context.pos, context.end, ' ');
+                context.lineIndent += static_cast<uint32_t>(indentEnd - context.pos);
+                context.pos = indentEnd;
+            } else {
+                ++context.pos;
+            }
             break;
         case '\t':
             if (context.isParsingIdent) {
@@ -175,13 +182,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         case '#': {
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::singleCharacter));
-            auto commentIt = context.pos + 1;
-            while (commentIt < context.end) {
-                if ('\n' == commentIt[0]) {
-                    break;
-                }
-                ++commentIt;
-            }
+            auto commentIt = findCharacter(context.pos + 1, context.end, '\n');
             if (context.pos + 1 != commentIt) {
                 outTokens.push_back(Token(ConstStringRef(context.pos + 1, commentIt - (context.pos + 1)), Token::comment));
             }
@@ -353,6 +354,11 @@ bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &o
     StackVec<NodeId, 64> nesting;
     size_t lineId = 0U;
     size_t lastUsedLine = 0u;
+    size_t estimatedNodesCount = outNodes.size() + lines.size() + 1;
+    for (const auto &line : lines) {
+        estimatedNodesCount += line.traits.hasInlineDataMarkers ? (line.last - line.first) : 0U;
+    }
+    outNodes.reserve(estimatedNodesCount);
     outNodes.push_back(Node());
     outNodes.rbegin()->id = 0U;
     outNodes.rbegin()->firstChildId = 1U;
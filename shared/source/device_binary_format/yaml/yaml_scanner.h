@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#if defined(__ARM_ARCH)
+#include <arm_neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
+namespace NEO {
+
+namespace Yaml {
+
+// 16-byte wide scanners used by the tokenizer for long runs of uninteresting characters (indentation, comments).
+// SSE2 is part of the x86-64 baseline and NEON of AArch64, so no per-file compile flags are needed.
+// ARM is detected with __ARM_ARCH, same as in the sse2neon based helpers.
+inline constexpr size_t scanChunkSize = 16U;
+
+#if defined(__ARM_ARCH)
+using ScanMaskT = uint64_t;
+inline constexpr uint32_t scanMaskBitsPerCharacter = 4U;
+
+inline ScanMaskT getCharacterMask(const char *pos, char c) {
+    auto matches = vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t *>(pos)), vdupq_n_u8(static_cast<uint8_t>(c)));
+    // NEON has no movemask, narrowing shift packs every comparison byte into a nibble
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+}
+#else
+using ScanMaskT = uint32_t;
+inline constexpr uint32_t scanMaskBitsPerCharacter = 1U;
+
+inline ScanMaskT getCharacterMask(const char *pos, char c) {
+    auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+    return static_cast<ScanMaskT>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(c))));
+}
+#endif
+
+inline constexpr ScanMaskT fullScanMask = static_cast<ScanMaskT>(~ScanMaskT{0} >> (8 * sizeof(ScanMaskT) - scanChunkSize * scanMaskBitsPerCharacter));
+
+inline const char *findCharacter(const char *pos, const char *end, char c) {
+    for (; pos + scanChunkSize <= end; pos += scanChunkSize) {
+        auto mask = getCharacterMask(pos, c);
+        if (0U != mask) {
+            return pos + std::countr_zero(mask) / scanMaskBitsPerCharacter;
+        }
+    }
+    for (; pos < end; ++pos) {
+        if (c == *pos) {
+            break;
+        }
+    }
+    return pos;
+}
+
+inline const char *skipCharacter(const char *pos, const char *end, char c) {
+    for (; pos + scanChunkSize <= end; pos += scanChunkSize) {
+        auto mask = getCharacterMask(pos, c) ^ fullScanMask;
+        if (0U != mask) {
+            return pos + std::countr_zero(mask) / scanMaskBitsPerCharacter;
+        }
+    }
+    for (; pos < end; ++pos) {
+        if (c != *pos) {
+            break;
+        }
+    }
+    return pos;
+}
+
+} // namespace Yaml
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/device_binary_format/elf/elf_decoder.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
+#include "shared/source/device_binary_format/zebin/zeinfo_cache.h"
 #include "shared/source/device_binary_format/zebin/zeinfo_decoder.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -415,7 +416,7 @@ DecodeError decodeZebin(ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, std::stri
         zeinfo = zeinfo.substr(static_cast<size_t>(0), dst.kernelMiscInfoPos);
     }
 
-    auto decodeZeInfoError = ZeInfo::decodeZeInfo(dst, zeinfo, outErrReason, outWarning);
+    auto decodeZeInfoError = ZeInfo::decodeZeInfoWithCache(dst, zeinfo, outErrReason, outWarning);
     if (DecodeError::success != decodeZeInfoError) {
         return decodeZeInfoError;
     }
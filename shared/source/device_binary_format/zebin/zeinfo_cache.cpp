@@ -0,0 +1,444 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/zebin/zeinfo_cache.h"
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device_binary_format/zebin/zeinfo_decoder.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/neo_driver_version.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/program/kernel_info.h"
+#include "shared/source/program/program_info.h"
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <type_traits>
+
+namespace NEO::Zebin::ZeInfo {
+
+namespace {
+#ifdef NEO_REVISION
+constexpr ConstStringRef driverRevision = NEO_REVISION;
+#else
+constexpr ConstStringRef driverRevision = "";
+#endif
+
+using ImplicitArgsT = decltype(KernelDescriptor::PayloadMappings::implicitArgs);
+using DispatchTraitsT = decltype(KernelDescriptor::PayloadMappings::dispatchTraits);
+
+class DecodedZeInfoWriter {
+  public:
+    template <typename T>
+    void write(const T &value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        writeBytes(&value, sizeof(T));
+    }
+
+    void writeBytes(const void *src, size_t size) {
+        auto begin = reinterpret_cast<const uint8_t *>(src);
+        output.insert(output.end(), begin, begin + size);
+    }
+
+    void writeString(const std::string &value) {
+        write(static_cast<uint32_t>(value.size()));
+        writeBytes(value.data(), value.size());
+    }
+
+    void writeByteVector(const std::vector<uint8_t> &value) {
+        write(static_cast<uint32_t>(value.size()));
+        writeBytes(value.data(), value.size());
+    }
+
+    std::vector<uint8_t> output;
+};
+
+class DecodedZeInfoReader {
+  public:
+    DecodedZeInfoReader(ArrayRef<const uint8_t> data) : data(data) {}
+
+    template <typename T>
+    bool read(T &value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return readBytes(&value, sizeof(T));
+    }
+
+    bool readBytes(void *dst, size_t size) {
+        if (false == valid || size > data.size() - offset) {
+            valid = false;
+            return false;
+        }
+        if (size > 0u) {
+            memcpy_s(dst, size, data.begin() + offset, size);
+        }
+        offset += size;
+        return true;
+    }
+
+    bool readCount(uint32_t &count, size_t elementSize) {
+        count = 0u;
+        if (false == read(count) || static_cast<uint64_t>(count) * elementSize > data.size() - offset) {
+            count = 0u;
+            valid = false;
+            return false;
+        }
+        return true;
+    }
+
+    bool readString(std::string &value) {
+        uint32_t size = 0u;
+        if (false == readCount(size, sizeof(char))) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char *>(data.begin() + offset), size);
+        offset += size;
+        return true;
+    }
+
+    bool readByteVector(std::vector<uint8_t> &value) {
+        uint32_t size = 0u;
+        if (false == readCount(size, sizeof(uint8_t))) {
+            return false;
+        }
+        value.assign(data.begin() + offset, data.begin() + offset + size);
+        offset += size;
+        return true;
+    }
+
+    bool isValid() const {
+        return valid;
+    }
+
+    bool isFullyConsumed() const {
+        return valid && offset == data.size();
+    }
+
+  protected:
+    ArrayRef<const uint8_t> data;
+    size_t offset = 0u;
+    bool valid = true;
+};
+
+void writeArgDescriptor(DecodedZeInfoWriter &writer, const ArgDescriptor &arg) {
+    writer.write(arg.type);
+    writer.write(arg.getTraits());
+    writer.write(arg.getExtendedTypeInfo());
+    switch (arg.type) {
+    default:
+        break;
+    case ArgDescriptor::argTPointer:
+        writer.write(arg.as<ArgDescPointer>());
+        break;
+    case ArgDescriptor::argTImage:
+        writer.write(arg.as<ArgDescImage>());
+        break;
+    case ArgDescriptor::argTSampler:
+        writer.write(arg.as<ArgDescSampler>());
+        break;
+    case ArgDescriptor::argTValue: {
+        const auto &elements = arg.as<ArgDescValue>().elements;
+        writer.write(static_cast<uint32_t>(elements.size()));
+        for (const auto &element : elements) {
+            writer.write(element);
+        }
+        break;
+    }
+    }
+}
+
+bool readArgDescriptor(DecodedZeInfoReader &reader, ArgDescriptor &arg) {
+    auto type = ArgDescriptor::argTUnknown;
+    if (false == reader.read(type) || type > ArgDescriptor::argTValue) {
+        return false;
+    }
+    arg = ArgDescriptor(type);
+    reader.read(arg.getTraits());
+    reader.read(arg.getExtendedTypeInfo());
+    switch (type) {
+    default:
+        break;
+    case ArgDescriptor::argTPointer:
+        reader.read(arg.as<ArgDescPointer>());
+        break;
+    case ArgDescriptor::argTImage:
+        reader.read(arg.as<ArgDescImage>());
+        break;
+    case ArgDescriptor::argTSampler:
+        reader.read(arg.as<ArgDescSampler>());
+        break;
+    case ArgDescriptor::argTValue: {
+        uint32_t elementsCount = 0u;
+        reader.readCount(elementsCount, sizeof(ArgDescValue::Element));
+        auto &elements = arg.as<ArgDescValue>().elements;
+        elements.resize(elementsCount);
+        for (auto &element : elements) {
+            reader.read(element);
+        }
+        break;
+    }
+    }
+    return reader.isValid();
+}
+
+void writeKernelDescriptor(DecodedZeInfoWriter &writer, const KernelDescriptor &desc) {
+    writer.write(desc.kernelAttributes);
+    writer.write(desc.entryPoints);
+
+    const auto &payloadMappings = desc.payloadMappings;
+    writer.write(payloadMappings.dispatchTraits);
+    writer.write(payloadMappings.bindingTable);
+    writer.write(payloadMappings.samplerTable);
+    writer.write(payloadMappings.implicitArgs);
+    writer.write(static_cast<uint32_t>(payloadMappings.explicitArgs.size()));
+    for (const auto &arg : payloadMappings.explicitArgs) {
+        writeArgDescriptor(writer, arg);
+    }
+
+    writer.write(static_cast<uint32_t>(desc.explicitArgsExtendedMetadata.size()));
+    for (const auto &argMetadata : desc.explicitArgsExtendedMetadata) {
+        writer.writeString(argMetadata.argName);
+        writer.writeString(argMetadata.type);
+        writer.writeString(argMetadata.accessQualifier);
+        writer.writeString(argMetadata.addressQualifier);
+        writer.writeString(argMetadata.typeQualifiers);
+    }
+
+    writer.write(static_cast<uint32_t>(desc.inlineSamplers.size()));
+    for (const auto &inlineSampler : desc.inlineSamplers) {
+        writer.write(inlineSampler);
+    }
+
+    const auto &kernelMetadata = desc.kernelMetadata;
+    writer.writeString(kernelMetadata.kernelName);
+    writer.writeString(kernelMetadata.kernelLanguageAttributes);
+    writer.write(static_cast<uint32_t>(kernelMetadata.printfStringsMap.size()));
+    for (const auto &printfString : kernelMetadata.printfStringsMap) {
+        writer.write(printfString.first);
+        writer.writeString(printfString.second);
+    }
+    writer.write(kernelMetadata.compiledSubGroupsNumber);
+    writer.write(kernelMetadata.requiredSubGroupSize);
+    writer.write(kernelMetadata.isGeneratedByIgc);
+
+    writer.writeByteVector(desc.generatedSsh);
+    writer.writeByteVector(desc.generatedDsh);
+}
+
+bool readKernelDescriptor(DecodedZeInfoReader &reader, KernelDescriptor &desc) {
+    reader.read(desc.kernelAttributes);
+    reader.read(desc.entryPoints);
+
+    auto &payloadMappings = desc.payloadMappings;
+    reader.read(payloadMappings.dispatchTraits);
+    reader.read(payloadMappings.bindingTable);
+    reader.read(payloadMappings.samplerTable);
+    reader.read(payloadMappings.implicitArgs);
+    uint32_t explicitArgsCount = 0u;
+    reader.readCount(explicitArgsCount, sizeof(ArgDescriptor::ArgType));
+    payloadMappings.explicitArgs.resize(explicitArgsCount);
+    for (auto &arg : payloadMappings.explicitArgs) {
+        if (false == readArgDescriptor(reader, arg)) {
+            return false;
+        }
+    }
+
+    uint32_t argsMetadataCount = 0u;
+    reader.readCount(argsMetadataCount, 5 * sizeof(uint32_t));
+    desc.explicitArgsExtendedMetadata.resize(argsMetadataCount);
+    for (auto &argMetadata : desc.explicitArgsExtendedMetadata) {
+        reader.readString(argMetadata.argName);
+        reader.readString(argMetadata.type);
+        reader.readString(argMetadata.accessQualifier);
+        reader.readString(argMetadata.addressQualifier);
+        reader.readString(argMetadata.typeQualifiers);
+    }
+
+    uint32_t inlineSamplersCount = 0u;
+    reader.readCount(inlineSamplersCount, sizeof(KernelDescriptor::InlineSampler));
+    desc.inlineSamplers.resize(inlineSamplersCount);
+    for (auto &inlineSampler : desc.inlineSamplers) {
+        reader.read(inlineSampler);
+    }
+
+    auto &kernelMetadata = desc.kernelMetadata;
+    reader.readString(kernelMetadata.kernelName);
+    reader.readString(kernelMetadata.kernelLanguageAttributes);
+    uint32_t printfStringsCount = 0u;
+    reader.readCount(printfStringsCount, sizeof(uint32_t) * 2);
+    for (uint32_t i = 0; i < printfStringsCount; i++) {
+        uint32_t index = 0u;
+        reader.read(index);
+        reader.readString(kernelMetadata.printfStringsMap[index]);
+    }
+    reader.read(kernelMetadata.compiledSubGroupsNumber);
+    reader.read(kernelMetadata.requiredSubGroupSize);
+    reader.read(kernelMetadata.isGeneratedByIgc);
+
+    reader.readByteVector(desc.generatedSsh);
+    reader.readByteVector(desc.generatedDsh);
+    return reader.isValid();
+}
+} // namespace
+
+std::string getDecodedZeInfoCacheKey(ConstStringRef zeInfo, const ProgramInfo &programInfo) {
+    return getDecodedZeInfoCacheKey(zeInfo, programInfo, ConstStringRef(driverVersion), driverRevision);
+}
+
+std::string getDecodedZeInfoCacheKey(ConstStringRef zeInfo, const ProgramInfo &programInfo, ConstStringRef neoVersion, ConstStringRef neoRevision) {
+    const uint32_t layoutSizes[] = {static_cast<uint32_t>(sizeof(KernelDescriptor::KernelAttributes)),
+                                    static_cast<uint32_t>(sizeof(ImplicitArgsT)),
+                                    static_cast<uint32_t>(sizeof(DispatchTraitsT)),
+                                    static_cast<uint32_t>(sizeof(ArgDescriptor)),
+                                    static_cast<uint32_t>(sizeof(KernelDescriptor::InlineSampler))};
+    const uint32_t decodeInputs[] = {programInfo.grfSize,
+                                     programInfo.minScratchSpaceSize,
+                                     static_cast<uint32_t>(debugManager.flags.IgnoreZebinUnknownAttributes.get()),
+                                     static_cast<uint32_t>(debugManager.flags.ZebinAppendElws.get())};
+
+    // decoder of other driver build may fill descriptors differently even with the same layout
+    Hash hash;
+    hash.update(reinterpret_cast<const char *>(&decodedZeInfoVersion), sizeof(decodedZeInfoVersion));
+    hash.update("----", 4);
+    hash.update(neoVersion.data(), neoVersion.size());
+    hash.update("----", 4);
+    hash.update(neoRevision.data(), neoRevision.size());
+    hash.update("----", 4);
+    hash.update(reinterpret_cast<const char *>(layoutSizes), sizeof(layoutSizes));
+    hash.update("----", 4);
+    hash.update(reinterpret_cast<const char *>(decodeInputs), sizeof(decodeInputs));
+    hash.update("----", 4);
+    hash.update(zeInfo.data(), zeInfo.size());
+
+    auto res = hash.finish();
+    std::stringstream stream;
+    stream << std::setfill('0')
+           << std::setw(sizeof(res) * 2)
+           << std::hex
+           << res
+           << decodedZeInfoKeySuffix.str();
+    return stream.str();
+}
+
+bool isDecodedZeInfoSerializable(const ProgramInfo &programInfo) {
+    for (const auto &kernelInfo : programInfo.kernelInfos) {
+        const auto &desc = kernelInfo->kernelDescriptor;
+        if (desc.kernelDescriptorExt != nullptr || false == desc.payloadMappings.explicitArgsExtendedDescriptors.empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<uint8_t> serializeDecodedZeInfo(const ProgramInfo &src, ConstStringRef zeInfo) {
+    DecodedZeInfoWriter writer;
+    DecodedZeInfoHeader header = {};
+    memcpy_s(header.magic, sizeof(header.magic), decodedZeInfoMagic, sizeof(decodedZeInfoMagic));
+    header.version = decodedZeInfoVersion;
+    header.kernelsCount = static_cast<uint32_t>(src.kernelInfos.size());
+    header.zeInfoSize = zeInfo.size();
+    writer.write(header);
+
+    writer.write(static_cast<uint32_t>(src.globalsDeviceToHostNameMap.size()));
+    for (const auto &globalHostAccess : src.globalsDeviceToHostNameMap) {
+        writer.writeString(globalHostAccess.first);
+        writer.writeString(globalHostAccess.second);
+    }
+
+    writer.write(static_cast<uint32_t>(src.externalFunctions.size()));
+    for (const auto &externalFunction : src.externalFunctions) {
+        writer.writeString(externalFunction.functionName);
+        writer.write(externalFunction.barrierCount);
+        writer.write(externalFunction.numGrfRequired);
+        writer.write(externalFunction.simdSize);
+        writer.write(externalFunction.hasRTCalls);
+    }
+
+    for (const auto &kernelInfo : src.kernelInfos) {
+        writeKernelDescriptor(writer, kernelInfo->kernelDescriptor);
+    }
+    return std::move(writer.output);
+}
+
+bool deserializeDecodedZeInfo(ArrayRef<const uint8_t> data, ConstStringRef zeInfo, ProgramInfo &dst) {
+    DecodedZeInfoReader reader(data);
+    DecodedZeInfoHeader header = {};
+    if (false == reader.read(header) ||
+        0 != memcmp(header.magic, decodedZeInfoMagic, sizeof(decodedZeInfoMagic)) ||
+        header.version != decodedZeInfoVersion ||
+        header.zeInfoSize != zeInfo.size()) {
+        return false;
+    }
+
+    ProgramInfo decoded;
+    uint32_t globalHostAccessCount = 0u;
+    reader.readCount(globalHostAccessCount, 2 * sizeof(uint32_t));
+    for (uint32_t i = 0; i < globalHostAccessCount; i++) {
+        std::string deviceName;
+        reader.readString(deviceName);
+        reader.readString(decoded.globalsDeviceToHostNameMap[deviceName]);
+    }
+
+    uint32_t externalFunctionsCount = 0u;
+    reader.readCount(externalFunctionsCount, sizeof(uint32_t));
+    decoded.externalFunctions.resize(externalFunctionsCount);
+    for (auto &externalFunction : decoded.externalFunctions) {
+        reader.readString(externalFunction.functionName);
+        reader.read(externalFunction.barrierCount);
+        reader.read(externalFunction.numGrfRequired);
+        reader.read(externalFunction.simdSize);
+        reader.read(externalFunction.hasRTCalls);
+    }
+
+    for (uint32_t i = 0; i < header.kernelsCount && reader.isValid(); i++) {
+        auto kernelInfo = new KernelInfo();
+        decoded.kernelInfos.push_back(kernelInfo);
+        readKernelDescriptor(reader, kernelInfo->kernelDescriptor);
+    }
+
+    if (false == reader.isFullyConsumed()) {
+        return false;
+    }
+
+    for (auto &globalHostAccess : decoded.globalsDeviceToHostNameMap) {
+        dst.globalsDeviceToHostNameMap[globalHostAccess.first] = std::move(globalHostAccess.second);
+    }
+    for (auto &externalFunction : decoded.externalFunctions) {
+        dst.externalFunctions.push_back(std::move(externalFunction));
+    }
+    dst.kernelInfos.insert(dst.kernelInfos.end(), decoded.kernelInfos.begin(), decoded.kernelInfos.end());
+    decoded.kernelInfos.clear();
+    return true;
+}
+
+DecodeError decodeZeInfoWithCache(ProgramInfo &dst, ConstStringRef zeInfo, std::string &outErrReason, std::string &outWarning) {
+    auto cache = dst.decodedProgramCache;
+    if (nullptr == cache || debugManager.flags.EnableDecodedProgramCache.get() != 1) {
+        return decodeZeInfo(dst, zeInfo, outErrReason, outWarning);
+    }
+
+    auto cacheKey = getDecodedZeInfoCacheKey(zeInfo, dst);
+    size_t cachedSize = 0u;
+    auto cached = cache->loadCachedBinary(cacheKey, cachedSize);
+    if (cached) {
+        ArrayRef<const uint8_t> cachedData(reinterpret_cast<const uint8_t *>(cached.get()), cachedSize);
+        if (deserializeDecodedZeInfo(cachedData, zeInfo, dst)) {
+            return DecodeError::success;
+        }
+    }
+
+    auto decodeError = decodeZeInfo(dst, zeInfo, outErrReason, outWarning);
+    if (DecodeError::success == decodeError && isDecodedZeInfoSerializable(dst)) {
+        auto serialized = serializeDecodedZeInfo(dst, zeInfo);
+        cache->cacheBinaryAsync(cacheKey, reinterpret_cast<const char *>(serialized.data()), serialized.size());
+    }
+    return decodeError;
+}
+
+} // namespace NEO::Zebin::ZeInfo
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/const_stringref.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace NEO {
+
+struct ProgramInfo;
+
+namespace Zebin::ZeInfo {
+
+// Decoded .ze_info state (kernel descriptors, external functions and host access table) is stored
+// in the compiler cache directory, so that loading the same binary again can skip YAML parsing.
+struct DecodedZeInfoHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t kernelsCount;
+    uint64_t zeInfoSize;
+};
+static_assert(sizeof(DecodedZeInfoHeader) == 24, "");
+
+inline constexpr char decodedZeInfoMagic[8] = {'N', 'E', 'O', 'Z', 'E', 'I', 'N', 'F'};
+inline constexpr uint32_t decodedZeInfoVersion = 1u;
+inline constexpr ConstStringRef decodedZeInfoKeySuffix = "_zeinfo";
+
+// Key covers decoded format version, driver version and revision, descriptor layout, decoding inputs and zeInfo itself
+std::string getDecodedZeInfoCacheKey(ConstStringRef zeInfo, const ProgramInfo &programInfo);
+std::string getDecodedZeInfoCacheKey(ConstStringRef zeInfo, const ProgramInfo &programInfo, ConstStringRef neoVersion, ConstStringRef neoRevision);
+bool isDecodedZeInfoSerializable(const ProgramInfo &programInfo);
+std::vector<uint8_t> serializeDecodedZeInfo(const ProgramInfo &src, ConstStringRef zeInfo);
+bool deserializeDecodedZeInfo(ArrayRef<const uint8_t> data, ConstStringRef zeInfo, ProgramInfo &dst);
+
+DecodeError decodeZeInfoWithCache(ProgramInfo &dst, ConstStringRef zeInfo, std::string &outErrReason, std::string &outWarning);
+
+} // namespace Zebin::ZeInfo
+} // namespace NEO
@@ -520,14 +520,45 @@ DecodeError decodeZeInfoFunctions(ProgramInfo &dst, Yaml::YamlParser &parser, co
 
 DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning, const Types::Version &srcZeInfoVersion) {
     UNRECOVERABLE_IF(zeInfoSections.kernels.size() != 1U);
-    for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
-        auto kernelInfo = std::make_unique<KernelInfo>();
-        auto zeInfoErr = decodeZeInfoKernelEntry(kernelInfo->kernelDescriptor, parser, kernelNd, dst.grfSize, dst.minScratchSpaceSize, outErrReason, outWarning, srcZeInfoVersion);
-        if (DecodeError::success != zeInfoErr) {
-            return zeInfoErr;
+    if (!dst.runForEachKernel) {
+        for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
+            auto kernelInfo = std::make_unique<KernelInfo>();
+            auto zeInfoErr = decodeZeInfoKernelEntry(kernelInfo->kernelDescriptor, parser, kernelNd, dst.grfSize, dst.minScratchSpaceSize, outErrReason, outWarning, srcZeInfoVersion);
+            if (DecodeError::success != zeInfoErr) {
+                return zeInfoErr;
+            }
+
+            dst.kernelInfos.push_back(kernelInfo.release());
         }
+        return DecodeError::success;
+    }
 
-        dst.kernelInfos.push_back(kernelInfo.release());
+    // parsed tree is only read, so kernel entries are decoded independently into their own descriptors and messages
+    struct KernelEntryDecoding {
+        const Yaml::Node *kernelNd = nullptr;
+        std::unique_ptr<KernelInfo> kernelInfo;
+        DecodeError error = DecodeError::success;
+        std::string errReason;
+        std::string warning;
+    };
+    std::vector<KernelEntryDecoding> decodings;
+    for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
+        decodings.emplace_back().kernelNd = &kernelNd;
+    }
+    dst.runForEachKernel(decodings.size(), [&](size_t kernelId) {
+        auto &decoding = decodings[kernelId];
+        decoding.kernelInfo = std::make_unique<KernelInfo>();
+        decoding.error = decodeZeInfoKernelEntry(decoding.kernelInfo->kernelDescriptor, parser, *decoding.kernelNd, dst.grfSize, dst.minScratchSpaceSize, decoding.errReason, decoding.warning, srcZeInfoVersion);
+    });
+
+    // kernel order and messages match serial decoding, which stops at first failing kernel
+    for (auto &decoding : decodings) {
+        outErrReason.append(decoding.errReason);
+        outWarning.append(decoding.warning);
+        if (DecodeError::success != decoding.error) {
+            return decoding.error;
+        }
+        dst.kernelInfos.push_back(decoding.kernelInfo.release());
     }
     return DecodeError::success;
 }
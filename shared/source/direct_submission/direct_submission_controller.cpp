@@ -39,6 +39,12 @@ DirectSubmissionController::DirectSubmissionController() {
     if (debugManager.flags.DirectSubmissionControllerIdleDetection.get() != -1) {
         isCsrIdleDetectionEnabled = debugManager.flags.DirectSubmissionControllerIdleDetection.get();
     }
+    if (debugManager.flags.DirectSubmissionControllerTimeoutPolicy.get() != -1) {
+        timeoutPolicy = static_cast<DirectSubmissionTimeoutPolicy>(debugManager.flags.DirectSubmissionControllerTimeoutPolicy.get());
+    }
+    if (debugManager.flags.DirectSubmissionControllerMaxPredictedIdleGap.get() != -1) {
+        maxPredictedIdleGap = std::chrono::microseconds{debugManager.flags.DirectSubmissionControllerMaxPredictedIdleGap.get()};
+    }
 };
 
 DirectSubmissionController::~DirectSubmissionController() {
@@ -95,6 +101,14 @@ void DirectSubmissionController::startThread() {
     directSubmissionControllingThread = Thread::createFunc(controlDirectSubmissionsState, reinterpret_cast<void *>(this));
 }
 
+void DirectSubmissionController::startInScheduler(PeriodicTaskScheduler &scheduler) {
+    this->scheduler = &scheduler;
+    auto controlTask = [this]() {
+        this->controlDirectSubmissionsStateInScheduler();
+    };
+    this->schedulerTaskId = scheduler.registerTask(controlTask, getSleepValue());
+}
+
 void DirectSubmissionController::stopThread() {
     runControlling.store(false);
     keepControlling.store(false);
@@ -102,6 +116,11 @@ void DirectSubmissionController::stopThread() {
         directSubmissionControllingThread->join();
         directSubmissionControllingThread.reset();
     }
+    if (scheduler) {
+        scheduler->unregisterTask(schedulerTaskId);
+        scheduler = nullptr;
+        schedulerTaskId = PeriodicTaskScheduler::invalidTaskId;
+    }
 }
 
 void DirectSubmissionController::startControlling() {
@@ -142,6 +161,29 @@ void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
     }
 }
 
+void DirectSubmissionController::controlDirectSubmissionsStateInScheduler() {
+    // one iteration of controlDirectSubmissionsState, sleeping is done by the scheduler
+    std::unique_lock<std::mutex> lock(this->condVarMutex);
+    if (!this->runControlling.load()) {
+        this->handlePagingFenceRequests(lock, false);
+        return;
+    }
+
+    if (!this->controllingStartedInScheduler) {
+        this->controllingStartedInScheduler = true;
+        this->timeSinceLastCheck = this->getCpuTimestamp();
+        this->lastHangCheckTime = std::chrono::high_resolution_clock::now();
+    }
+    this->handlePagingFenceRequests(lock, true);
+    lock.unlock();
+    this->checkNewSubmissions();
+
+    auto taskId = this->schedulerTaskId.load();
+    if (taskId != PeriodicTaskScheduler::invalidTaskId) {
+        this->scheduler->setTaskPeriod(taskId, getSleepValue());
+    }
+}
+
 void DirectSubmissionController::checkNewSubmissions() {
     auto timeoutMode = timeoutElapsed();
     if (timeoutMode == TimeoutElapsedMode::notElapsed) {
@@ -163,15 +205,35 @@ void DirectSubmissionController::checkNewSubmissions() {
             if (state.isStopped) {
                 continue;
             }
+            if (this->timeoutPolicy == DirectSubmissionTimeoutPolicy::predictedIdleGap) {
+                const auto now = getCpuTimestamp();
+                if (!state.idleObserved) {
+                    state.idleObserved = true;
+                    state.idleSince = now;
+                }
+                if (!this->shouldStopIdleDirectSubmission(state, now)) {
+                    ++this->timeoutPolicyCounters.deferredStops;
+                    continue;
+                }
+            }
             auto lock = csr->obtainUniqueOwnership();
             if (!isCsrIdleDetectionEnabled || isDirectSubmissionIdle(csr, lock)) {
                 csr->stopDirectSubmission(false);
                 state.isStopped = true;
+                state.stoppedOnIdle = true;
+                ++this->timeoutPolicyCounters.stops;
                 shouldRecalculateTimeout = true;
                 this->lowestThrottleSubmitted = QueueThrottle::HIGH;
             }
             state.taskCount = csr->peekTaskCount();
         } else {
+            if (state.stoppedOnIdle) {
+                state.stoppedOnIdle = false;
+                ++this->timeoutPolicyCounters.restartsAfterStop;
+            }
+            if (this->timeoutPolicy == DirectSubmissionTimeoutPolicy::predictedIdleGap && state.idleObserved) {
+                this->recordIdleGap(state, getCpuTimestamp());
+            }
             state.isStopped = false;
             state.taskCount = taskCount;
             if (this->adjustTimeoutOnThrottleAndAcLineStatus) {
@@ -244,10 +306,47 @@ void DirectSubmissionController::recalculateTimeout() {
     this->lastTerminateCpuTimestamp = now;
 }
 
+void DirectSubmissionController::recordIdleGap(DirectSubmissionState &state, SteadyClock::time_point now) {
+    // smoothed mean and mean deviation of idle gaps, same estimator as used for TCP retransmission timeouts
+    const auto idleGap = std::chrono::duration_cast<std::chrono::microseconds>(now - state.idleSince);
+    if (state.idleGapSamples == 0u) {
+        state.idleGapMean = idleGap;
+        state.idleGapDeviation = idleGap / 2;
+    } else {
+        const auto error = idleGap - state.idleGapMean;
+        state.idleGapMean += error / 8;
+        state.idleGapDeviation += (std::chrono::abs(error) - state.idleGapDeviation) / 4;
+    }
+    ++state.idleGapSamples;
+    state.idleObserved = false;
+}
+
+bool DirectSubmissionController::shouldStopIdleDirectSubmission(DirectSubmissionState &state, SteadyClock::time_point now) {
+    if (state.idleGapSamples < minIdleGapSamplesForPrediction) {
+        return true;
+    }
+
+    // keep ring running only when next submission is expected soon enough to be worth the power
+    const auto predictedIdleGap = state.idleGapMean + 4 * state.idleGapDeviation;
+    if (predictedIdleGap > this->maxPredictedIdleGap) {
+        return true;
+    }
+    const auto idleTime = std::chrono::duration_cast<std::chrono::microseconds>(now - state.idleSince);
+    return idleTime >= predictedIdleGap;
+}
+
+DirectSubmissionTimeoutPolicyCounters DirectSubmissionController::getTimeoutPolicyCounters() {
+    std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+    return this->timeoutPolicyCounters;
+}
+
 void DirectSubmissionController::enqueueWaitForPagingFence(CommandStreamReceiver *csr, uint64_t pagingFenceValue) {
     std::lock_guard lock(this->condVarMutex);
     pagingFenceRequests.push({csr, pagingFenceValue});
     condVar.notify_one();
+    if (scheduler) {
+        scheduler->notifyTask(schedulerTaskId);
+    }
 }
 
 void DirectSubmissionController::drainPagingFenceQueue() {
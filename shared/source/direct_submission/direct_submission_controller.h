@@ -10,6 +10,7 @@
 #include "shared/source/command_stream/queue_throttle.h"
 #include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/helpers/device_bitfield.h"
+#include "shared/source/utilities/periodic_task_scheduler.h"
 
 #include <array>
 #include <atomic>
@@ -47,10 +48,23 @@ enum class TimeoutElapsedMode {
     fullyElapsed
 };
 
+enum class DirectSubmissionTimeoutPolicy : int32_t {
+    staticTimeout = 0,
+    predictedIdleGap = 1
+};
+
+struct DirectSubmissionTimeoutPolicyCounters {
+    uint64_t stops = 0u;
+    uint64_t restartsAfterStop = 0u;
+    uint64_t deferredStops = 0u;
+};
+
 class DirectSubmissionController {
   public:
     static constexpr size_t defaultTimeout = 5'000;
     static constexpr size_t timeToPollTagUpdateNS = 20'000;
+    static constexpr size_t defaultMaxPredictedIdleGap = 100'000;
+    static constexpr uint32_t minIdleGapSamplesForPrediction = 4u;
     DirectSubmissionController();
     virtual ~DirectSubmissionController();
 
@@ -59,6 +73,7 @@ class DirectSubmissionController {
     void unregisterDirectSubmission(CommandStreamReceiver *csr);
 
     void startThread();
+    void startInScheduler(PeriodicTaskScheduler &scheduler);
     void startControlling();
     void stopThread();
 
@@ -67,11 +82,14 @@ class DirectSubmissionController {
     void enqueueWaitForPagingFence(CommandStreamReceiver *csr, uint64_t pagingFenceValue);
     void drainPagingFenceQueue();
 
+    DirectSubmissionTimeoutPolicyCounters getTimeoutPolicyCounters();
+
   protected:
     struct DirectSubmissionState {
         DirectSubmissionState(DirectSubmissionState &&other) {
             isStopped = other.isStopped.load();
             taskCount = other.taskCount.load();
+            copyIdleGapStatistics(other);
         }
         DirectSubmissionState &operator=(const DirectSubmissionState &other) {
             if (this == &other) {
@@ -79,6 +97,7 @@ class DirectSubmissionController {
             }
             this->isStopped = other.isStopped.load();
             this->taskCount = other.taskCount.load();
+            copyIdleGapStatistics(other);
             return *this;
         }
 
@@ -88,8 +107,24 @@ class DirectSubmissionController {
         DirectSubmissionState(const DirectSubmissionState &other) = delete;
         DirectSubmissionState &operator=(DirectSubmissionState &&other) = delete;
 
+        void copyIdleGapStatistics(const DirectSubmissionState &other) {
+            this->stoppedOnIdle = other.stoppedOnIdle;
+            this->idleObserved = other.idleObserved;
+            this->idleSince = other.idleSince;
+            this->idleGapMean = other.idleGapMean;
+            this->idleGapDeviation = other.idleGapDeviation;
+            this->idleGapSamples = other.idleGapSamples;
+        }
+
         std::atomic_bool isStopped{true};
         std::atomic<TaskCountType> taskCount{0};
+
+        bool stoppedOnIdle = false;
+        bool idleObserved = false;
+        SteadyClock::time_point idleSince{};
+        std::chrono::microseconds idleGapMean{0};
+        std::chrono::microseconds idleGapDeviation{0};
+        uint32_t idleGapSamples = 0u;
     };
 
     static void *controlDirectSubmissionsState(void *self);
@@ -104,6 +139,9 @@ class DirectSubmissionController {
     void updateLastSubmittedThrottle(QueueThrottle throttle);
     size_t getTimeoutParamsMapKey(QueueThrottle throttle, bool acLineStatus);
 
+    void recordIdleGap(DirectSubmissionState &state, SteadyClock::time_point now);
+    MOCKABLE_VIRTUAL bool shouldStopIdleDirectSubmission(DirectSubmissionState &state, SteadyClock::time_point now);
+
     void handlePagingFenceRequests(std::unique_lock<std::mutex> &lock, bool checkForNewSubmissions);
     MOCKABLE_VIRTUAL TimeoutElapsedMode timeoutElapsed();
     std::chrono::microseconds getSleepValue() const { return std::chrono::microseconds(this->timeout / this->bcsTimeoutDivisor); }
@@ -128,6 +166,9 @@ class DirectSubmissionController {
     QueueThrottle lowestThrottleSubmitted = QueueThrottle::HIGH;
     bool adjustTimeoutOnThrottleAndAcLineStatus = false;
     bool isCsrIdleDetectionEnabled = false;
+    DirectSubmissionTimeoutPolicy timeoutPolicy = DirectSubmissionTimeoutPolicy::staticTimeout;
+    std::chrono::microseconds maxPredictedIdleGap{defaultMaxPredictedIdleGap};
+    DirectSubmissionTimeoutPolicyCounters timeoutPolicyCounters;
 
     std::condition_variable condVar;
     std::mutex condVarMutex;
@@ -26,12 +26,17 @@
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
+#include "shared/source/utilities/perf_trace.h"
+#include "shared/source/utilities/periodic_task_scheduler.h"
 #include "shared/source/utilities/wait_util.h"
+#include "shared/source/utilities/worker_thread_pool.h"
 
 namespace NEO {
 ExecutionEnvironment::ExecutionEnvironment() {
     WaitUtils::init();
     this->configureNeoEnvironment();
+    PerfTracer::acquire();
 }
 
 void ExecutionEnvironment::releaseRootDeviceEnvironmentResources(RootDeviceEnvironment *rootDeviceEnvironment) {
@@ -54,6 +59,16 @@ ExecutionEnvironment::~ExecutionEnvironment() {
     if (unifiedMemoryReuseCleaner) {
         unifiedMemoryReuseCleaner->stopThread();
     }
+    if (periodicTaskScheduler) {
+        periodicTaskScheduler->stopThread();
+    }
+    if (cpuCopyEngine) {
+        cpuCopyEngine->stopThreads();
+    }
+    if (moduleBuildWorkers) {
+        moduleBuildWorkers->stopThreads();
+    }
+    PerfTracer::release();
     if (memoryManager) {
         memoryManager->commonCleanup();
         for (const auto &rootDeviceEnvironment : this->rootDeviceEnvironments) {
@@ -141,7 +156,11 @@ DirectSubmissionController *ExecutionEnvironment::initializeDirectSubmissionCont
 
     if (initializeDirectSubmissionController && this->directSubmissionController == nullptr) {
         this->directSubmissionController = std::make_unique<DirectSubmissionController>();
-        this->directSubmissionController->startThread();
+        if (debugManager.flags.EnablePeriodicTaskScheduler.get() == 1) {
+            this->directSubmissionController->startInScheduler(*initializePeriodicTaskScheduler());
+        } else {
+            this->directSubmissionController->startThread();
+        }
     }
 
     return directSubmissionController.get();
@@ -157,8 +176,47 @@ void ExecutionEnvironment::initializeUnifiedMemoryReuseCleaner() {
 
     if (initializeUnifiedMemoryReuseCleaner && nullptr == this->unifiedMemoryReuseCleaner) {
         this->unifiedMemoryReuseCleaner = std::make_unique<UnifiedMemoryReuseCleaner>();
-        this->unifiedMemoryReuseCleaner->startThread();
+        if (debugManager.flags.EnablePeriodicTaskScheduler.get() == 1) {
+            this->unifiedMemoryReuseCleaner->startInScheduler(*initializePeriodicTaskScheduler());
+        } else {
+            this->unifiedMemoryReuseCleaner->startThread();
+        }
+    }
+}
+
+PeriodicTaskScheduler *ExecutionEnvironment::initializePeriodicTaskScheduler() {
+    std::lock_guard<std::mutex> lock(initializePeriodicTaskSchedulerMutex);
+    if (nullptr == this->periodicTaskScheduler) {
+        this->periodicTaskScheduler = std::make_unique<PeriodicTaskScheduler>();
+        this->periodicTaskScheduler->startThread();
+    }
+    return periodicTaskScheduler.get();
+}
+
+CpuCopyEngine *ExecutionEnvironment::initializeCpuCopyEngine() {
+    std::lock_guard<std::mutex> lock(initializeCpuCopyEngineMutex);
+    auto initializeCpuCopyEngine = CpuCopyEngine::isSupported();
+
+    if (debugManager.flags.EnableCpuCopyEngine.get() != -1) {
+        initializeCpuCopyEngine = debugManager.flags.EnableCpuCopyEngine.get() == 1;
+    }
+
+    if (initializeCpuCopyEngine && nullptr == this->cpuCopyEngine) {
+        this->cpuCopyEngine = std::make_unique<CpuCopyEngine>();
+        this->cpuCopyEngine->startThreads();
+    }
+    return cpuCopyEngine.get();
+}
+
+WorkerThreadPool *ExecutionEnvironment::initializeModuleBuildWorkers() {
+    std::lock_guard<std::mutex> lock(initializeModuleBuildWorkersMutex);
+    // calling thread takes part in module build, so pool has one thread less than requested
+    auto threadsCount = debugManager.flags.ModuleBuildThreadsCount.get();
+    if (threadsCount > 1 && nullptr == this->moduleBuildWorkers) {
+        this->moduleBuildWorkers = std::make_unique<WorkerThreadPool>(static_cast<uint32_t>(threadsCount - 1));
+        this->moduleBuildWorkers->startThreads();
     }
+    return moduleBuildWorkers.get();
 }
 
 void ExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices) {
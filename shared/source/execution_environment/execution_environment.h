@@ -18,8 +18,11 @@
 #include <vector>
 
 namespace NEO {
+class CpuCopyEngine;
 class DirectSubmissionController;
 class UnifiedMemoryReuseCleaner;
+class PeriodicTaskScheduler;
+class WorkerThreadPool;
 class GfxCoreHelper;
 class MemoryManager;
 struct OsEnvironment;
@@ -67,10 +70,17 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
 
     DirectSubmissionController *initializeDirectSubmissionController();
     void initializeUnifiedMemoryReuseCleaner();
+    PeriodicTaskScheduler *initializePeriodicTaskScheduler();
+    CpuCopyEngine *initializeCpuCopyEngine();
+    WorkerThreadPool *initializeModuleBuildWorkers();
 
+    // must outlive components which unregister their tasks when destroyed
+    std::unique_ptr<PeriodicTaskScheduler> periodicTaskScheduler;
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<UnifiedMemoryReuseCleaner> unifiedMemoryReuseCleaner;
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
+    std::unique_ptr<CpuCopyEngine> cpuCopyEngine;
+    std::unique_ptr<WorkerThreadPool> moduleBuildWorkers;
     std::unique_ptr<OsEnvironment> osEnvironment;
     std::vector<std::unique_ptr<RootDeviceEnvironment>> rootDeviceEnvironments;
     void releaseRootDeviceEnvironmentResources(RootDeviceEnvironment *rootDeviceEnvironment);
@@ -95,6 +105,9 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     std::unordered_map<uint32_t, uint32_t> rootDeviceNumCcsMap;
     std::mutex initializeDirectSubmissionControllerMutex;
     std::mutex initializeUnifiedMemoryReuseCleanerMutex;
+    std::mutex initializePeriodicTaskSchedulerMutex;
+    std::mutex initializeCpuCopyEngineMutex;
+    std::mutex initializeModuleBuildWorkersMutex;
     std::vector<std::tuple<std::string, uint32_t>> deviceCcsModeVec;
 };
 } // namespace NEO
@@ -12,6 +12,7 @@
 #include "shared/source/aub/aub_center.h"
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/built_ins/sip.h"
+#include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/debugger/debugger.h"
@@ -25,7 +26,9 @@
 #include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/work_group_size_autotuner.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -155,6 +158,38 @@ CompilerInterface *RootDeviceEnvironment::getCompilerInterface() {
     return this->compilerInterface.get();
 }
 
+CompilerCache *RootDeviceEnvironment::getDecodedProgramCache() const {
+    if (debugManager.flags.EnableDecodedProgramCache.get() != 1 || this->compilerInterface == nullptr) {
+        return nullptr;
+    }
+    auto cache = this->compilerInterface->getCache();
+    if (cache == nullptr || false == cache->getConfig().enabled) {
+        return nullptr;
+    }
+    return cache;
+}
+
+WorkGroupSizeAutotuner *RootDeviceEnvironment::getWorkGroupSizeAutotuner() {
+    if (debugManager.flags.EnableWorkGroupSizeAutotuning.get() != 1) {
+        return nullptr;
+    }
+    if (this->workGroupSizeAutotuner.get() == nullptr) {
+        CompilerCache *persistentCache = nullptr;
+        if (debugManager.flags.PersistWorkGroupSizeAutotuning.get() == 1) {
+            auto compilerInterface = getCompilerInterface();
+            auto cache = compilerInterface ? compilerInterface->getCache() : nullptr;
+            persistentCache = (cache && cache->getConfig().enabled) ? cache : nullptr;
+        }
+        std::lock_guard<std::mutex> autolock(this->mtx);
+        if (this->workGroupSizeAutotuner.get() == nullptr) {
+            const uint64_t deviceData[] = {hwInfo->platform.usDeviceID, hwInfo->platform.usRevId, hwInfo->gtSystemInfo.EUCount, hwInfo->gtSystemInfo.ThreadCount};
+            auto deviceHash = Hash::hash(reinterpret_cast<const char *>(deviceData), sizeof(deviceData));
+            this->workGroupSizeAutotuner = std::make_unique<WorkGroupSizeAutotuner>(deviceHash, persistentCache);
+        }
+    }
+    return this->workGroupSizeAutotuner.get();
+}
+
 void RootDeviceEnvironment::initHelpers() {
     initProductHelper();
     initGfxCoreHelper();
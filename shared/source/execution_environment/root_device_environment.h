@@ -20,6 +20,7 @@ class AssertHandler;
 class AubCenter;
 class BindlessHeapsHelper;
 class BuiltIns;
+class CompilerCache;
 class CompilerInterface;
 class Debugger;
 class Device;
@@ -34,6 +35,7 @@ class OSInterface;
 class OSTime;
 class SipKernel;
 class SWTagsManager;
+class WorkGroupSizeAutotuner;
 class ProductHelper;
 class GfxCoreHelper;
 class ApiGfxCoreHelper;
@@ -73,6 +75,8 @@ struct RootDeviceEnvironment : NonCopyableClass {
     GmmHelper *getGmmHelper() const;
     GmmClientContext *getGmmClientContext() const;
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface();
+    CompilerCache *getDecodedProgramCache() const;
+    WorkGroupSizeAutotuner *getWorkGroupSizeAutotuner();
     BuiltIns *getBuiltIns();
     BindlessHeapsHelper *getBindlessHeapsHelper() const;
     AssertHandler *getAssertHandler(Device *neoDevice);
@@ -117,6 +121,7 @@ struct RootDeviceEnvironment : NonCopyableClass {
     std::unique_ptr<BindlessHeapsHelper> bindlessHeapsHelper;
 
     std::unique_ptr<AssertHandler> assertHandler;
+    std::unique_ptr<WorkGroupSizeAutotuner> workGroupSizeAutotuner;
 
     ExecutionEnvironment &executionEnvironment;
 
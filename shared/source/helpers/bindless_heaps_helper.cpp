@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/bindless_heaps_helper.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
@@ -21,11 +22,26 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/utilities/heap_allocator.h"
 
+#include <cinttypes>
+#include <limits>
+
 namespace NEO {
 
 constexpr size_t globalSshAllocationSize = 4 * MemoryConstants::pageSize64k;
+
+namespace {
+std::unique_lock<std::mutex> lockAndCountContention(std::mutex &mutex, std::atomic<uint64_t> &contentions) {
+    std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        contentions++;
+        lock.lock();
+    }
+    return lock;
+}
+} // namespace
 constexpr size_t borderColorAlphaOffset = alignUp(4 * sizeof(float), MemoryConstants::cacheLineSize);
 
 constexpr HeapIndex heapIndexForPoolReservedRange = HeapIndex::heapStandard;
@@ -128,6 +144,12 @@ bool BindlessHeapsHelper::initializeReservedMemory() {
 }
 
 BindlessHeapsHelper::~BindlessHeapsHelper() {
+    if (debugManager.flags.PrintBindlessHeapsHelperCounters.get() == 1) {
+        printf("\nPID: %u, BindlessHeapsHelper counters: allocations: %" PRIu64 ", allocation mutex contentions: %" PRIu64 ", releases: %" PRIu64 ", release mutex contentions: %" PRIu64 ", heap growths: %" PRIu64,
+               SysCalls::getProcessId(), counters.allocations.load(), counters.allocationMutexContentions.load(), counters.releases.load(),
+               counters.releaseMutexContentions.load(), counters.heapGrowths.load());
+    }
+
     for (auto *allocation : ssHeapsAllocations) {
         memManager->freeGraphicsMemory(allocation);
     }
@@ -170,38 +192,35 @@ bool BindlessHeapsHelper::isReservedMemoryModeAvailable() {
 }
 
 void BindlessHeapsHelper::clearStateDirtyForContext(uint32_t osContextId) {
-    std::lock_guard<std::mutex> autolock(this->mtx);
-
     uint32_t contextIdShifted = osContextId - memManager->getFirstContextIdForRootDevice(rootDeviceIndex);
-    DEBUG_BREAK_IF(contextIdShifted >= stateCacheDirtyForContext.size());
+    DEBUG_BREAK_IF(contextIdShifted >= 64u);
 
-    stateCacheDirtyForContext.reset(contextIdShifted);
+    stateCacheDirtyForContext.fetch_and(~(1ull << contextIdShifted));
 }
 
 bool BindlessHeapsHelper::getStateDirtyForContext(uint32_t osContextId) {
-    std::lock_guard<std::mutex> autolock(this->mtx);
-
     uint32_t contextIdShifted = osContextId - memManager->getFirstContextIdForRootDevice(rootDeviceIndex);
-    DEBUG_BREAK_IF(contextIdShifted >= stateCacheDirtyForContext.size());
+    DEBUG_BREAK_IF(contextIdShifted >= 64u);
 
-    return stateCacheDirtyForContext.test(contextIdShifted);
+    return (stateCacheDirtyForContext.load() & (1ull << contextIdShifted)) != 0;
 }
 
 SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, GraphicsAllocation *surfaceAllocation, BindlesHeapType heapType) {
     auto heap = surfaceStateHeaps[heapType].get();
 
-    std::lock_guard<std::mutex> autolock(this->mtx);
+    auto autolock = lockAndCountContention(this->mtx, counters.allocationMutexContentions);
+    counters.allocations++;
     if (heapType == BindlesHeapType::globalSsh) {
 
-        if (!allocateFromReusePool) {
-            if ((surfaceStateInHeapVectorReuse[releasePoolIndex][0].size() + surfaceStateInHeapVectorReuse[releasePoolIndex][1].size()) > reuseSlotCountThreshold) {
+        if (!allocateFromReusePool && (releasedSlotsCount.load() > reuseSlotCountThreshold)) {
+            auto releaseLock = lockAndCountContention(this->releaseMtx, counters.releaseMutexContentions);
 
-                // invalidate all contexts
-                stateCacheDirtyForContext.set();
-                allocateFromReusePool = true;
-                allocatePoolIndex = releasePoolIndex;
-                releasePoolIndex = allocatePoolIndex == 0 ? 1 : 0;
-            }
+            // invalidate all contexts
+            stateCacheDirtyForContext.store(std::numeric_limits<uint64_t>::max());
+            allocateFromReusePool = true;
+            allocatePoolIndex = releasePoolIndex;
+            releasePoolIndex = allocatePoolIndex == 0 ? 1 : 0;
+            releasedSlotsCount.store(0);
         }
 
         if (allocateFromReusePool) {
@@ -216,6 +235,8 @@ SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, Grap
 
                     // copy remaining slots from allocate pool to release pool
                     int otherSizeIndex = index == 0 ? 1 : 0;
+                    auto releaseLock = lockAndCountContention(this->releaseMtx, counters.releaseMutexContentions);
+                    releasedSlotsCount += surfaceStateInHeapVectorReuse[allocatePoolIndex][otherSizeIndex].size();
                     surfaceStateInHeapVectorReuse[releasePoolIndex][otherSizeIndex].insert(surfaceStateInHeapVectorReuse[releasePoolIndex][otherSizeIndex].end(),
                                                                                            surfaceStateInHeapVectorReuse[allocatePoolIndex][otherSizeIndex].begin(),
                                                                                            surfaceStateInHeapVectorReuse[allocatePoolIndex][otherSizeIndex].end());
@@ -275,6 +296,7 @@ bool BindlessHeapsHelper::growHeap(BindlesHeapType heapType) {
         return false;
     }
     ssHeapsAllocations.push_back(newAlloc);
+    counters.heapGrowths++;
     heap->replaceGraphicsAllocation(newAlloc);
     heap->replaceBuffer(newAlloc->getUnderlyingBuffer(),
                         newAlloc->getUnderlyingBufferSize());
@@ -283,9 +305,11 @@ bool BindlessHeapsHelper::growHeap(BindlesHeapType heapType) {
 
 void BindlessHeapsHelper::releaseSSToReusePool(const SurfaceStateInHeapInfo &surfStateInfo) {
     if (surfStateInfo.heapAllocation != nullptr) {
-        std::lock_guard<std::mutex> autolock(this->mtx);
         int index = getReusedSshVectorIndex(surfStateInfo.ssSize);
+        auto releaseLock = lockAndCountContention(this->releaseMtx, counters.releaseMutexContentions);
         surfaceStateInHeapVectorReuse[releasePoolIndex][index].push_back(std::move(surfStateInfo));
+        releasedSlotsCount++;
+        counters.releases++;
     }
 
     return;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -31,6 +32,15 @@ constexpr uint32_t redescribedImage = 3;
 constexpr uint32_t max = 4;
 }; // namespace BindlessImageSlot
 
+// Counters of waits on slot allocation and release locks, used to measure contention between threads
+struct BindlessHeapsHelperCounters {
+    std::atomic<uint64_t> allocations{0u};
+    std::atomic<uint64_t> allocationMutexContentions{0u};
+    std::atomic<uint64_t> releases{0u};
+    std::atomic<uint64_t> releaseMutexContentions{0u};
+    std::atomic<uint64_t> heapGrowths{0u};
+};
+
 class BindlessHeapsHelper {
   public:
     enum BindlesHeapType {
@@ -70,6 +80,7 @@ class BindlessHeapsHelper {
     }
     bool getStateDirtyForContext(uint32_t osContextId);
     void clearStateDirtyForContext(uint32_t osContextId);
+    const BindlessHeapsHelperCounters &getCounters() const { return counters; }
 
   protected:
     bool tryReservingMemoryForSpecialSsh(const size_t size, size_t alignment);
@@ -93,9 +104,12 @@ class BindlessHeapsHelper {
     uint32_t releasePoolIndex = 0;
     bool allocateFromReusePool = false;
     std::array<std::vector<SurfaceStateInHeapInfo>, 2> surfaceStateInHeapVectorReuse[2];
-    std::bitset<64> stateCacheDirtyForContext;
+    std::atomic<size_t> releasedSlotsCount = 0;
+    std::atomic<uint64_t> stateCacheDirtyForContext = 0;
 
     std::mutex mtx;
+    std::mutex releaseMtx; // guards release pool, allows releasing slots without waiting for allocations
+    BindlessHeapsHelperCounters counters;
     DeviceBitfield deviceBitfield;
     bool globalBindlessDsh = false;
 
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <cstdint>
+#include <immintrin.h>
+
+namespace NEO {
+
+#if __AVX512BW__
+struct uint16x32_t { // NOLINT(readability-identifier-naming)
+    enum { numChannels = 32 };
+
+    __m512i value;
+
+    uint16x32_t() {
+        value = _mm512_setzero_si512();
+    }
+
+    uint16x32_t(__m512i value) : value(value) {
+    }
+
+    uint16x32_t(uint16_t a) {
+        value = _mm512_set1_epi16(a); // AVX512BW
+    }
+
+    explicit uint16x32_t(const void *alignedPtr) {
+        load(alignedPtr);
+    }
+
+    inline uint16_t get(unsigned int element) {
+        DEBUG_BREAK_IF(element >= numChannels);
+        return reinterpret_cast<uint16_t *>(&value)[element];
+    }
+
+    static inline uint16x32_t zero() {
+        return uint16x32_t(static_cast<uint16_t>(0u));
+    }
+
+    static inline uint16x32_t one() {
+        return uint16x32_t(static_cast<uint16_t>(1u));
+    }
+
+    static inline uint16x32_t mask() {
+        return uint16x32_t(static_cast<uint16_t>(0xffffu));
+    }
+
+    // Per thread data rows are only guaranteed to be 32 byte aligned,
+    // unaligned accesses cost nothing extra when they do not split a cache line
+    inline void load(const void *alignedPtr) {
+        DEBUG_BREAK_IF(!isAligned<32>(alignedPtr));
+        value = _mm512_loadu_si512(alignedPtr); // AVX512F
+    }
+
+    inline void loadUnaligned(const void *ptr) {
+        value = _mm512_loadu_si512(ptr); // AVX512F
+    }
+
+    inline void store(void *alignedPtr) {
+        DEBUG_BREAK_IF(!isAligned<32>(alignedPtr));
+        _mm512_storeu_si512(alignedPtr, value); // AVX512F
+    }
+
+    inline void storeUnaligned(void *ptr) {
+        _mm512_storeu_si512(ptr, value); // AVX512F
+    }
+
+    inline operator bool() const {
+        return _mm512_test_epi16_mask(value, value) ? true : false; // AVX512BW
+    }
+
+    inline uint16x32_t &operator-=(const uint16x32_t &a) {
+        value = _mm512_sub_epi16(value, a.value); // AVX512BW
+        return *this;
+    }
+
+    inline uint16x32_t &operator+=(const uint16x32_t &a) {
+        value = _mm512_add_epi16(value, a.value); // AVX512BW
+        return *this;
+    }
+
+    inline friend uint16x32_t operator>=(const uint16x32_t &a, const uint16x32_t &b) {
+        uint16x32_t result;
+        result.value = _mm512_movm_epi16(_mm512_cmpge_epu16_mask(a.value, b.value)); // AVX512BW
+        return result;
+    }
+
+    inline friend uint16x32_t operator&&(const uint16x32_t &a, const uint16x32_t &b) {
+        uint16x32_t result;
+        result.value = _mm512_and_si512(a.value, b.value); // AVX512F
+        return result;
+    }
+
+    // NOTE: uint16x32_t::blend behaves like mask ? a : b
+    inline friend uint16x32_t blend(const uint16x32_t &a, const uint16x32_t &b, const uint16x32_t &mask) {
+        uint16x32_t result;
+        // Lanes of mask are all ones or all zeros, so bitwise select (0xca : mask ? a : b) is enough
+        result.value = _mm512_ternarylogic_epi32(mask.value, a.value, b.value, 0xca); // AVX512F
+        return result;
+    }
+};
+#endif // __AVX512BW__
+} // namespace NEO
@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/work_group_size_autotuner.h"
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/hash.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace NEO {
+
+namespace {
+struct PersistentDecision {
+    uint32_t version;
+    uint32_t lws[3];
+};
+static_assert(sizeof(PersistentDecision) == 16, "");
+
+constexpr uint32_t maxBucketTrailingZeros = 10u;
+
+uint32_t getTrailingZeros(size_t value, uint32_t maxValue) {
+    uint32_t trailingZeros = 0u;
+    while ((trailingZeros < maxValue) && (0u == ((value >> trailingZeros) & 1u))) {
+        ++trailingZeros;
+    }
+    return trailingZeros;
+}
+} // namespace
+
+WorkGroupSizeAutotuner::WorkGroupSizeAutotuner(uint64_t deviceHash, CompilerCache *persistentCache)
+    : deviceHash(deviceHash), persistentCache(persistentCache) {
+    if (debugManager.flags.WorkGroupSizeAutotuningSamples.get() > 0) {
+        samplesPerCandidate = static_cast<uint32_t>(debugManager.flags.WorkGroupSizeAutotuningSamples.get());
+    }
+}
+
+uint64_t WorkGroupSizeAutotuner::getKernelHash(ConstStringRef kernelName, const void *isa, size_t isaSize) {
+    Hash hash;
+    hash.update(kernelName.data(), kernelName.size());
+    hash.update("----", 4);
+    hash.update(reinterpret_cast<const char *>(isa), isaSize);
+    return hash.finish();
+}
+
+WorkGroupSizeAutotunerKey WorkGroupSizeAutotuner::createKey(uint64_t kernelHash, const Vec3<size_t> &gws, uint32_t workDim, uint32_t slmTotalSize) {
+    // Global sizes with the same magnitude and the same power of two divisor (up to max group size)
+    // share tuning results, so every power of two candidate stays valid within a bucket.
+    uint64_t bucket = 0u;
+    for (auto i = 0u; i < 3; i++) {
+        auto magnitude = static_cast<uint64_t>(Math::log2(static_cast<uint64_t>(std::max(gws[i], static_cast<size_t>(1)))));
+        auto divisor = static_cast<uint64_t>(getTrailingZeros(gws[i], maxBucketTrailingZeros));
+        bucket |= ((magnitude << 4) | divisor) << (i * 10);
+    }
+    bucket |= static_cast<uint64_t>(workDim & 0x3) << 30;
+    bucket |= static_cast<uint64_t>(slmTotalSize) << 32;
+    return {kernelHash, bucket};
+}
+
+bool WorkGroupSizeAutotuner::isValidWorkGroupSize(const Vec3<size_t> &lws, const Vec3<size_t> &gws, uint32_t maxWorkGroupSize) {
+    for (auto i = 0u; i < 3; i++) {
+        if (lws[i] == 0 || (gws[i] % lws[i]) != 0) {
+            return false;
+        }
+    }
+    return lws[0] * lws[1] * lws[2] <= maxWorkGroupSize;
+}
+
+std::vector<Vec3<size_t>> WorkGroupSizeAutotuner::generateCandidates(const Vec3<size_t> &heuristicLws, const Vec3<size_t> &gws, uint32_t workDim, uint32_t maxWorkGroupSize, uint32_t simdSize) {
+    std::vector<Vec3<size_t>> candidates;
+    candidates.push_back(heuristicLws);
+
+    size_t maxSize[3] = {1, 1, 1};
+    for (auto i = 0u; i < std::min(workDim, 3u); i++) {
+        maxSize[i] = static_cast<size_t>(1u) << getTrailingZeros(gws[i], maxBucketTrailingZeros);
+    }
+    auto totalWorkItems = gws[0] * gws[1] * gws[2];
+    auto minGroupSize = std::min(static_cast<size_t>(simdSize), totalWorkItems);
+
+    std::vector<Vec3<size_t>> powerOfTwoCandidates;
+    for (size_t x = 1; x <= maxSize[0]; x <<= 1) {
+        for (size_t y = 1; y <= maxSize[1]; y <<= 1) {
+            for (size_t z = 1; z <= maxSize[2]; z <<= 1) {
+                auto groupSize = x * y * z;
+                if (groupSize > maxWorkGroupSize || groupSize < minGroupSize || (groupSize % minGroupSize) != 0) {
+                    continue;
+                }
+                powerOfTwoCandidates.push_back({x, y, z});
+            }
+        }
+    }
+
+    // Prefer bigger groups and, for the same size, wider x dimension
+    std::sort(powerOfTwoCandidates.begin(), powerOfTwoCandidates.end(), [](const auto &lhs, const auto &rhs) {
+        auto lhsSize = lhs.x * lhs.y * lhs.z;
+        auto rhsSize = rhs.x * rhs.y * rhs.z;
+        return (lhsSize != rhsSize) ? (lhsSize > rhsSize) : (lhs.x > rhs.x);
+    });
+    for (const auto &candidate : powerOfTwoCandidates) {
+        if (candidates.size() == maxCandidates) {
+            break;
+        }
+        if (std::find(candidates.begin(), candidates.end(), candidate) == candidates.end()) {
+            candidates.push_back(candidate);
+        }
+    }
+    return candidates;
+}
+
+Vec3<size_t> WorkGroupSizeAutotuner::selectWorkGroupSize(const WorkGroupSizeAutotunerKey &key, const Vec3<size_t> &heuristicLws, const Vec3<size_t> &gws, uint32_t workDim,
+                                                         uint32_t maxWorkGroupSize, uint32_t simdSize, bool canSample, bool &sampleRequested) {
+    sampleRequested = false;
+    std::unique_lock<std::mutex> lock(mtx);
+    auto &entry = getEntry(key, lock);
+
+    if (entry.converged) {
+        return isValidWorkGroupSize(entry.decision, gws, maxWorkGroupSize) ? entry.decision : heuristicLws;
+    }
+    if (false == canSample) {
+        return heuristicLws;
+    }
+
+    if (entry.candidates.empty()) {
+        for (const auto &lws : generateCandidates(heuristicLws, gws, workDim, maxWorkGroupSize, simdSize)) {
+            entry.candidates.push_back({lws});
+        }
+        if (entry.candidates.size() == 1u) {
+            entry.decision = heuristicLws;
+            entry.converged = true;
+            entry.candidates.clear();
+            return heuristicLws;
+        }
+    }
+
+    auto candidate = std::min_element(entry.candidates.begin(), entry.candidates.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.issuedSamples < rhs.issuedSamples;
+    });
+    if (false == isValidWorkGroupSize(candidate->lws, gws, maxWorkGroupSize)) {
+        return heuristicLws;
+    }
+    candidate->issuedSamples++;
+    sampleRequested = true;
+    return candidate->lws;
+}
+
+bool WorkGroupSizeAutotuner::getTunedWorkGroupSize(const WorkGroupSizeAutotunerKey &key, const Vec3<size_t> &gws, uint32_t maxWorkGroupSize, Vec3<size_t> &outLws) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto &entry = getEntry(key, lock);
+    if (false == entry.converged || false == isValidWorkGroupSize(entry.decision, gws, maxWorkGroupSize)) {
+        return false;
+    }
+    outLws = entry.decision;
+    return true;
+}
+
+void WorkGroupSizeAutotuner::reportDuration(const WorkGroupSizeAutotunerKey &key, const Vec3<size_t> &lws, uint64_t durationNs) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto entryIt = entries.find(key);
+    if (entryIt == entries.end() || entryIt->second.converged) {
+        return;
+    }
+    auto &entry = entryIt->second;
+    auto candidate = std::find_if(entry.candidates.begin(), entry.candidates.end(), [&lws](const auto &candidate) { return candidate.lws == lws; });
+    if (candidate == entry.candidates.end()) {
+        return;
+    }
+    candidate->bestDurationNs = (candidate->reportedSamples == 0u) ? durationNs : std::min(candidate->bestDurationNs, durationNs);
+    candidate->reportedSamples++;
+
+    // Samples may be lost when events are released before completion, give up exploring after issuing twice as many as needed
+    auto sampled = std::all_of(entry.candidates.begin(), entry.candidates.end(), [this](const auto &candidate) { return candidate.reportedSamples >= samplesPerCandidate; });
+    auto exhausted = std::all_of(entry.candidates.begin(), entry.candidates.end(), [this](const auto &candidate) { return candidate.issuedSamples >= 2 * samplesPerCandidate; });
+    if (sampled || exhausted) {
+        converge(key, entry, lock);
+    }
+}
+
+WorkGroupSizeAutotuner::Entry &WorkGroupSizeAutotuner::getEntry(const WorkGroupSizeAutotunerKey &key, std::unique_lock<std::mutex> &lock) {
+    auto entryIt = entries.find(key);
+    if (entryIt != entries.end()) {
+        return entryIt->second;
+    }
+
+    Entry entry;
+    if (persistentCache != nullptr) {
+        lock.unlock();
+        entry.converged = loadPersistentDecision(key, entry.decision);
+        lock.lock();
+    }
+    return entries.emplace(key, std::move(entry)).first->second;
+}
+
+void WorkGroupSizeAutotuner::converge(const WorkGroupSizeAutotunerKey &key, Entry &entry, std::unique_lock<std::mutex> &lock) {
+    auto best = entry.candidates.begin();
+    for (auto candidate = entry.candidates.begin(); candidate != entry.candidates.end(); ++candidate) {
+        if (candidate->reportedSamples == 0u) {
+            continue;
+        }
+        if (best->reportedSamples == 0u || candidate->bestDurationNs < best->bestDurationNs) {
+            best = candidate;
+        }
+    }
+    entry.decision = best->lws;
+    entry.converged = true;
+    entry.candidates.clear();
+
+    PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stdout, "Work group size autotuning converged to LWS:(%zu, %zu, %zu)\n",
+                       entry.decision.x, entry.decision.y, entry.decision.z);
+
+    if (persistentCache != nullptr) {
+        auto decision = entry.decision;
+        lock.unlock();
+        storePersistentDecision(key, decision);
+    }
+}
+
+std::string WorkGroupSizeAutotuner::getPersistentKey(const WorkGroupSizeAutotunerKey &key) const {
+    const uint64_t keyData[] = {deviceHash, key.kernelHash, key.dispatchBucket};
+    auto res = Hash::hash(reinterpret_cast<const char *>(keyData), sizeof(keyData));
+    std::stringstream stream;
+    stream << std::setfill('0')
+           << std::setw(sizeof(res) * 2)
+           << std::hex
+           << res
+           << persistentKeySuffix.str();
+    return stream.str();
+}
+
+bool WorkGroupSizeAutotuner::loadPersistentDecision(const WorkGroupSizeAutotunerKey &key, Vec3<size_t> &outLws) {
+    size_t size = 0u;
+    auto data = persistentCache->loadCachedBinary(getPersistentKey(key), size);
+    if (data == nullptr || size != sizeof(PersistentDecision)) {
+        return false;
+    }
+    PersistentDecision decision = {};
+    memcpy(&decision, data.get(), sizeof(decision));
+    if (decision.version != persistentDataVersion) {
+        return false;
+    }
+    outLws = {decision.lws[0], decision.lws[1], decision.lws[2]};
+    return true;
+}
+
+void WorkGroupSizeAutotuner::storePersistentDecision(const WorkGroupSizeAutotunerKey &key, const Vec3<size_t> &lws) {
+    PersistentDecision decision = {persistentDataVersion, {static_cast<uint32_t>(lws.x), static_cast<uint32_t>(lws.y), static_cast<uint32_t>(lws.z)}};
+    persistentCache->cacheBinary(getPersistentKey(key), reinterpret_cast<const char *>(&decision), sizeof(decision));
+}
+
+} // namespace NEO
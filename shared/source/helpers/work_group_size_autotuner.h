@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/helpers/vec.h"
+#include "shared/source/utilities/const_stringref.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class CompilerCache;
+
+struct WorkGroupSizeAutotunerKey {
+    uint64_t kernelHash = 0u;
+    uint64_t dispatchBucket = 0u;
+
+    bool operator==(const WorkGroupSizeAutotunerKey &rhs) const {
+        return (kernelHash == rhs.kernelHash) && (dispatchBucket == rhs.dispatchBucket);
+    }
+};
+
+// Picks local work size for launches where application leaves it to the runtime.
+// While exploring, each candidate is timed on a few launches with profiling data available,
+// after that the fastest one is memoized per (kernel, global size bucket) and optionally
+// stored in the compiler cache, so that later runs start converged.
+class WorkGroupSizeAutotuner : NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t maxCandidates = 8u;
+    static constexpr uint32_t defaultSamplesPerCandidate = 3u;
+    static constexpr uint32_t persistentDataVersion = 1u;
+    static constexpr ConstStringRef persistentKeySuffix = "_lws";
+
+    WorkGroupSizeAutotuner(uint64_t deviceHash, CompilerCache *persistentCache);
+
+    static uint64_t getKernelHash(ConstStringRef kernelName, const void *isa, size_t isaSize);
+    static WorkGroupSizeAutotunerKey createKey(uint64_t kernelHash, const Vec3<size_t> &gws, uint32_t workDim, uint32_t slmTotalSize);
+    static std::vector<Vec3<size_t>> generateCandidates(const Vec3<size_t> &heuristicLws, const Vec3<size_t> &gws, uint32_t workDim, uint32_t maxWorkGroupSize, uint32_t simdSize);
+    static bool isValidWorkGroupSize(const Vec3<size_t> &lws, const Vec3<size_t> &gws, uint32_t maxWorkGroupSize);
+
+    Vec3<size_t> selectWorkGroupSize(const WorkGroupSizeAutotunerKey &key, const Vec3<size_t> &heuristicLws, const Vec3<size_t> &gws, uint32_t workDim,
+                                     uint32_t maxWorkGroupSize, uint32_t simdSize, bool canSample, bool &sampleRequested);
+    bool getTunedWorkGroupSize(const WorkGroupSizeAutotunerKey &key, const Vec3<size_t> &gws, uint32_t maxWorkGroupSize, Vec3<size_t> &outLws);
+    void reportDuration(const WorkGroupSizeAutotunerKey &key, const Vec3<size_t> &lws, uint64_t durationNs);
+
+  protected:
+    struct Candidate {
+        Vec3<size_t> lws{0, 0, 0};
+        uint64_t bestDurationNs = 0u;
+        uint32_t issuedSamples = 0u;
+        uint32_t reportedSamples = 0u;
+    };
+
+    struct Entry {
+        std::vector<Candidate> candidates;
+        Vec3<size_t> decision{0, 0, 0};
+        bool converged = false;
+    };
+
+    struct KeyHash {
+        size_t operator()(const WorkGroupSizeAutotunerKey &key) const {
+            return static_cast<size_t>(key.kernelHash ^ (key.dispatchBucket * 0x9e3779b97f4a7c15ull));
+        }
+    };
+
+    Entry &getEntry(const WorkGroupSizeAutotunerKey &key, std::unique_lock<std::mutex> &lock);
+    void converge(const WorkGroupSizeAutotunerKey &key, Entry &entry, std::unique_lock<std::mutex> &lock);
+    std::string getPersistentKey(const WorkGroupSizeAutotunerKey &key) const;
+    bool loadPersistentDecision(const WorkGroupSizeAutotunerKey &key, Vec3<size_t> &outLws);
+    void storePersistentDecision(const WorkGroupSizeAutotunerKey &key, const Vec3<size_t> &lws);
+
+    std::unordered_map<WorkGroupSizeAutotunerKey, Entry, KeyHash> entries;
+    std::mutex mtx;
+    uint64_t deviceHash = 0u;
+    CompilerCache *persistentCache = nullptr;
+    uint32_t samplesPerCandidate = defaultSamplesPerCandidate;
+};
+
+} // namespace NEO
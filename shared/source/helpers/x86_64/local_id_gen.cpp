@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@ namespace NEO {
 
 struct uint16x8_t;
 struct uint16x16_t;
+struct uint16x32_t;
 
 // This is the initial value of SIMD for local ID
 // computation.  It correlates to the SIMD lane.
@@ -41,6 +42,13 @@ LocalIDHelper::LocalIDHelper() {
         LocalIDHelper::generateSimd16 = generateLocalIDsSimd<uint16x16_t, 16>;
         LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x16_t, 32>;
     }
+#if defined(NEO_LOCAL_ID_GEN_AVX512)
+    // SIMD32 thread row fits single 512 bit register, so whole thread is generated in one pass
+    bool supportsAVX512 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512);
+    if (supportsAVX512) {
+        LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x32_t, 32>;
+    }
+#endif
 }
 
 LocalIDHelper LocalIDHelper::initializer;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,21 +14,22 @@
 #include "shared/source/helpers/local_id_gen.h"
 #include "shared/source/helpers/simd_helper.h"
 #include "shared/source/kernel/grf_config.h"
+#include "shared/source/utilities/cpuintrinsics.h"
 
 #include <cstring>
 
 namespace NEO {
 
 LocalIdsCache::LocalIdsCache(size_t cacheSize, std::array<uint8_t, 3> wgDimOrder, uint32_t grfCount, uint8_t simdSize, uint8_t grfSize, bool usesOnlyImages)
-    : wgDimOrder(wgDimOrder), localIdsSizePerThread(getPerThreadSizeLocalIDs(static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize))),
+    : cacheSize(cacheSize), wgDimOrder(wgDimOrder), localIdsSizePerThread(getPerThreadSizeLocalIDs(static_cast<uint32_t>(simdSize), static_cast<uint32_t>(grfSize))),
       grfCount(grfCount), grfSize(grfSize), simdSize(simdSize), usesOnlyImages(usesOnlyImages) {
     UNRECOVERABLE_IF(cacheSize == 0)
-    cache.resize(cacheSize);
+    cache = std::make_unique<LocalIdsCacheEntry[]>(cacheSize);
 }
 
 LocalIdsCache::~LocalIdsCache() {
-    for (auto &cacheEntry : cache) {
-        alignedFree(cacheEntry.localIdsData);
+    for (size_t i = 0; i < cacheSize; i++) {
+        alignedFree(cache[i].localIdsData);
     }
 }
 
@@ -51,19 +52,41 @@ size_t LocalIdsCache::getLocalIdsSizePerThread() const {
 }
 
 void LocalIdsCache::setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination) {
-    entry.accessCounter++;
+    entry.accessCounter.fetch_add(1U, std::memory_order_relaxed);
     std::memcpy(destination, entry.localIdsData, entry.localIdsSize);
 }
 
+bool LocalIdsCache::trySetLocalIdsFromEntry(LocalIdsCacheEntry &entry, uint64_t groupSizeKey, void *destination) {
+    if (entry.groupSizeKey.load(std::memory_order_acquire) != groupSizeKey) {
+        return false;
+    }
+    // Pin first and check key again, writer unpublishes the key before draining readers
+    entry.activeReaders.fetch_add(1U);
+    bool hit = (entry.groupSizeKey.load() == groupSizeKey);
+    if (hit) {
+        setLocalIdsForEntry(entry, destination);
+    }
+    entry.activeReaders.fetch_sub(1U, std::memory_order_release);
+    return hit;
+}
+
 void LocalIdsCache::setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    const auto groupSizeKey = getGroupSizeKey(group);
+    for (size_t i = 0; i < cacheSize; i++) {
+        if (trySetLocalIdsFromEntry(cache[i], groupSizeKey, destination)) {
+            return;
+        }
+    }
+
     auto setLocalIdsLock = lock();
     LocalIdsCacheEntry *leastAccessedEntry = &cache[0];
-    for (auto &cacheEntry : cache) {
-        if (cacheEntry.groupSize == group) {
+    for (size_t i = 0; i < cacheSize; i++) {
+        auto &cacheEntry = cache[i];
+        if (cacheEntry.groupSizeKey.load(std::memory_order_relaxed) == groupSizeKey) {
             return setLocalIdsForEntry(cacheEntry, destination);
         }
 
-        if (cacheEntry.accessCounter < leastAccessedEntry->accessCounter) {
+        if (cacheEntry.accessCounter.load(std::memory_order_relaxed) < leastAccessedEntry->accessCounter.load(std::memory_order_relaxed)) {
             leastAccessedEntry = &cacheEntry;
         }
     }
@@ -73,9 +96,13 @@ void LocalIdsCache::setLocalIdsForGroup(const Vec3<uint16_t> &group, void *desti
 }
 
 void LocalIdsCache::commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    entry.groupSizeKey.store(invalidGroupSizeKey);
+    while (entry.activeReaders.load() != 0U) {
+        CpuIntrinsics::pause();
+    }
+
     entry.localIdsSize = getLocalIdsSizeForGroup(group, rootDeviceEnvironment);
-    entry.groupSize = group;
-    entry.accessCounter = 0U;
+    entry.accessCounter.store(0U, std::memory_order_relaxed);
     if (entry.localIdsSize > entry.localIdsSizeAllocated) {
         alignedFree(entry.localIdsData);
         entry.localIdsData = static_cast<uint8_t *>(alignedMalloc(entry.localIdsSize, 32));
@@ -83,6 +110,7 @@ void LocalIdsCache::commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_
     }
     NEO::generateLocalIDs(entry.localIdsData, static_cast<uint16_t>(simdSize),
                           {group[0], group[1], group[2]}, wgDimOrder, usesOnlyImages, grfSize, grfCount, rootDeviceEnvironment);
+    entry.groupSizeKey.store(getGroupSizeKey(group), std::memory_order_release);
 }
 
 } // namespace NEO
\ No newline at end of file
@@ -1,26 +1,33 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/helpers/vec.h"
-#include "shared/source/utilities/stackvec.h"
 
 #include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 namespace NEO {
 struct RootDeviceEnvironment;
+// Cache hits are served without taking the lock : entry is looked up by its published group size key
+// and pinned with readers counter, which writer drains after unpublishing the entry and before reusing its buffer.
+// Only misses serialize on the mutex.
 class LocalIdsCache {
   public:
+    static constexpr uint64_t invalidGroupSizeKey = 0U;
+
     struct LocalIdsCacheEntry {
-        Vec3<uint16_t> groupSize = {0, 0, 0};
+        std::atomic<uint64_t> groupSizeKey{invalidGroupSizeKey};
+        std::atomic<uint32_t> activeReaders{0U};
+        std::atomic<size_t> accessCounter{0U};
         uint8_t *localIdsData = nullptr;
         size_t localIdsSize = 0U;
         size_t localIdsSizeAllocated = 0U;
-        size_t accessCounter = 0;
     };
 
     LocalIdsCache() = delete;
@@ -34,12 +41,18 @@ class LocalIdsCache {
     size_t getLocalIdsSizeForGroup(const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment) const;
     size_t getLocalIdsSizePerThread() const;
 
+    static uint64_t getGroupSizeKey(const Vec3<uint16_t> &group) {
+        return static_cast<uint64_t>(group[0]) | (static_cast<uint64_t>(group[1]) << 16) | (static_cast<uint64_t>(group[2]) << 32) | (1ULL << 48);
+    }
+
   protected:
+    bool trySetLocalIdsFromEntry(LocalIdsCacheEntry &entry, uint64_t groupSizeKey, void *destination);
     void setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination);
     void commitNewEntry(LocalIdsCacheEntry &entry, const Vec3<uint16_t> &group, const RootDeviceEnvironment &rootDeviceEnvironment);
     std::unique_lock<std::mutex> lock();
 
-    StackVec<LocalIdsCacheEntry, 4> cache;
+    std::unique_ptr<LocalIdsCacheEntry[]> cache;
+    const size_t cacheSize;
     std::mutex setLocalIdsMutex;
     const std::array<uint8_t, 3> wgDimOrder;
     const uint32_t localIdsSizePerThread;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,11 @@ void DeferredDeleter::stop() {
         // Delete working thread
         worker.reset();
     }
+    if (schedulerTaskId != PeriodicTaskScheduler::invalidTaskId) {
+        scheduler->unregisterTask(schedulerTaskId);
+        schedulerTaskId = PeriodicTaskScheduler::invalidTaskId;
+        doWorkInBackground = false;
+    }
     drain(false, false);
 }
 
@@ -56,6 +61,11 @@ void DeferredDeleter::deferDeletion(DeferrableDeletion *deletion) {
 
     lock.unlock();
     condition.notify_one();
+
+    auto taskId = schedulerTaskId.load();
+    if (taskId != PeriodicTaskScheduler::invalidTaskId) {
+        scheduler->notifyTask(taskId);
+    }
 }
 
 void DeferredDeleter::addClient() {
@@ -73,7 +83,15 @@ void DeferredDeleter::removeClient() {
 }
 
 void DeferredDeleter::ensureThread() {
-    if (worker != nullptr) {
+    if (worker != nullptr || schedulerTaskId != PeriodicTaskScheduler::invalidTaskId) {
+        return;
+    }
+    if (scheduler) {
+        doWorkInBackground = true;
+        auto clearQueueTask = [this]() {
+            this->clearQueue(false);
+        };
+        schedulerTaskId = scheduler->registerTask(clearQueueTask, PeriodicTaskScheduler::onDemandPeriod);
         return;
     }
     worker = Thread::createFunc(run, reinterpret_cast<void *>(this));
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/utilities/idlist.h"
+#include "shared/source/utilities/periodic_task_scheduler.h"
 
 #include <atomic>
 #include <condition_variable>
@@ -31,6 +32,9 @@ class DeferredDeleter {
 
     MOCKABLE_VIRTUAL void drain(bool blocking, bool hostptrsOnly);
 
+    // Deletions are processed by a task of the scheduler instead of a dedicated thread, must be set before first client is added
+    void setScheduler(PeriodicTaskScheduler *scheduler) { this->scheduler = scheduler; }
+
   protected:
     void stop();
     void safeStop();
@@ -45,6 +49,8 @@ class DeferredDeleter {
     std::atomic<int> elementsToRelease = 0;
     std::atomic<int> hostptrsToRelease = 0;
     std::unique_ptr<Thread> worker;
+    PeriodicTaskScheduler *scheduler = nullptr;
+    std::atomic<PeriodicTaskScheduler::TaskId> schedulerTaskId = PeriodicTaskScheduler::invalidTaskId;
     int32_t numClients = 0;
     IDList<DeferrableDeletion, true> queue;
     std::mutex queueMutex;
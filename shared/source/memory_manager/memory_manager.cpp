@@ -316,6 +316,11 @@ void MemoryManager::freeGraphicsMemory(GraphicsAllocation *gfxAllocation, bool i
 // if not in use destroy in place
 // if in use pass to temporary allocation list that is cleaned on blocking calls
 void MemoryManager::checkGpuUsageAndDestroyGraphicsAllocations(GraphicsAllocation *gfxAllocation) {
+    if (deferredSubmissionsCsrsCount.load() > 0u) {
+        for (auto &engine : getRegisteredEngines(gfxAllocation->getRootDeviceIndex())) {
+            engine.commandStreamReceiver->flushDeferredSubmissions(true);
+        }
+    }
     if (gfxAllocation->isUsed()) {
         if (gfxAllocation->isUsedByManyOsContexts()) {
             multiContextResourceDestructor->deferDeletion(new DeferrableAllocationDeletion{*this, *gfxAllocation});
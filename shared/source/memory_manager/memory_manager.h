@@ -173,6 +173,9 @@ class MemoryManager {
     virtual void handleFenceCompletion(GraphicsAllocation *allocation){};
 
     void checkGpuUsageAndDestroyGraphicsAllocations(GraphicsAllocation *gfxAllocation);
+    // releases flush deferred submissions of registered engines only while some command stream receiver has them
+    void registerDeferredSubmissionsCsr() { deferredSubmissionsCsrsCount++; }
+    void unregisterDeferredSubmissionsCsr() { deferredSubmissionsCsrsCount--; }
 
     virtual uint64_t getSystemSharedMemory(uint32_t rootDeviceIndex) = 0;
     virtual uint64_t getLocalMemorySize(uint32_t rootDeviceIndex, uint32_t deviceBitfield) = 0;
@@ -428,6 +431,7 @@ class MemoryManager {
     std::mutex physicalMemoryAllocationMapMutex;
     std::unique_ptr<std::atomic<size_t>[]> localMemAllocsSize;
     std::atomic<size_t> sysMemAllocsSize;
+    std::atomic<uint32_t> deferredSubmissionsCsrsCount{0u};
     size_t hostAllocationsSavedForReuseSize = 0u;
     mutable std::mutex hostAllocationsReuseMtx;
     std::map<std::pair<AllocationType, bool>, CustomHeapAllocatorConfig> customHeapAllocators;
@@ -546,6 +546,7 @@ void SVMAllocsManager::removeSVMAlloc(const SvmAllocationData &svmAllocData) {
     std::unique_lock<std::shared_mutex> lock(mtx);
     internalAllocationsMap.erase(svmAllocData.getAllocId());
     svmAllocs.remove(reinterpret_cast<void *>(svmAllocData.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+    invalidateSvmAllocLookups();
 }
 
 bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
@@ -797,6 +798,7 @@ void SVMAllocsManager::freeSVMData(SvmAllocationData *svmData) {
     std::unique_lock<std::shared_mutex> lock(mtx);
     internalAllocationsMap.erase(svmData->getAllocId());
     svmAllocs.remove(reinterpret_cast<void *>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+    invalidateSvmAllocLookups();
 }
 
 void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
@@ -1029,6 +1031,7 @@ std::unique_lock<std::mutex> SVMAllocsManager::obtainOwnership() {
 void SVMAllocsManager::insertSVMAlloc(void *svmPtr, const SvmAllocationData &allocData) {
     std::unique_lock<std::shared_mutex> lock(mtx);
     this->svmAllocs.insert(svmPtr, allocData);
+    invalidateSvmAllocLookups();
     UNRECOVERABLE_IF(internalAllocationsMap.count(allocData.getAllocId()) > 0);
     for (auto alloc : allocData.gpuAllocations.getGraphicsAllocations()) {
         if (alloc != nullptr) {
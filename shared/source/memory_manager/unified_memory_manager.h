@@ -106,6 +106,18 @@ class SVMAllocsManager {
         NEO::SpinLock mutex;
     };
 
+    struct SvmAllocationLookupCache {
+        bool contains(const void *ptr) const {
+            auto address = reinterpret_cast<uintptr_t>(ptr);
+            return svmData != nullptr && (address == base || (address > base && address < base + size));
+        }
+
+        uint64_t generation = 0;
+        uintptr_t base = 0;
+        size_t size = 0;
+        SvmAllocationData *svmData = nullptr;
+    };
+
     struct MapOperationsTracker {
         using SvmMapOperationsContainer = std::map<const void *, SvmMapOperation>;
         void insert(SvmMapOperation);
@@ -211,8 +223,18 @@ class SVMAllocsManager {
     template <typename T,
               std::enable_if_t<std::is_same_v<T, void> || std::is_same_v<T, const void>, int> = 0>
     SvmAllocationData *getSVMAlloc(T *ptr) {
+        auto &lastLookup = lastSvmAllocLookup;
+        if (lastLookup.generation == svmAllocsGeneration.load(std::memory_order_acquire) && lastLookup.contains(ptr)) {
+            return lastLookup.svmData;
+        }
+
         std::shared_lock<std::shared_mutex> lock(mtx);
-        return svmAllocs.get(ptr);
+        auto it = svmAllocs.getImpl(ptr, true);
+        if (it == svmAllocs.allocations.end()) {
+            return nullptr;
+        }
+        lastLookup = {svmAllocsGeneration.load(std::memory_order_relaxed), reinterpret_cast<uintptr_t>(it->first), it->second->size, it->second.get()};
+        return it->second.get();
     }
 
     MOCKABLE_VIRTUAL bool freeSVMAlloc(void *ptr, bool blocking);
@@ -268,8 +290,13 @@ class SVMAllocsManager {
     void freeSVMData(SvmAllocationData *svmData);
     void insertSVMAlloc(void *ptr, const SvmAllocationData &allocData);
     void makeResidentForAllocationsWithId(uint32_t allocationId, CommandStreamReceiver &csr);
+    void invalidateSvmAllocLookups() { svmAllocsGeneration.store(++svmAllocsGenerationCounter, std::memory_order_release); }
+
+    static inline std::atomic<uint64_t> svmAllocsGenerationCounter = 0;
+    static thread_local SvmAllocationLookupCache lastSvmAllocLookup;
 
     SortedVectorBasedAllocationTracker svmAllocs;
+    std::atomic<uint64_t> svmAllocsGeneration = ++svmAllocsGenerationCounter;
     MapOperationsTracker svmMapOperations;
     MapBasedAllocationTracker svmDeferFreeAllocs;
     MemoryManager *memoryManager;
@@ -282,4 +309,6 @@ class SVMAllocsManager {
     bool usmHostAllocationsCacheEnabled = false;
     std::multimap<uint32_t, GraphicsAllocation *> internalAllocationsMap;
 };
+
+inline thread_local SVMAllocsManager::SvmAllocationLookupCache SVMAllocsManager::lastSvmAllocLookup;
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -17,6 +18,32 @@
 
 namespace NEO {
 
+double UsmMemAllocPoolStats::getHitRate() const {
+    const auto totalAllocations = allocationsCount + failedAllocationsCount;
+    if (0u == totalAllocations) {
+        return 0.0;
+    }
+    return static_cast<double>(allocationsCount) / static_cast<double>(totalAllocations);
+}
+
+double UsmMemAllocPoolStats::getFragmentation() const {
+    if (0u == usedSize) {
+        return 0.0;
+    }
+    return static_cast<double>(usedSize - requestedSize) / static_cast<double>(usedSize);
+}
+
+UsmMemAllocPoolStats &UsmMemAllocPoolStats::operator+=(const UsmMemAllocPoolStats &rhs) {
+    allocationsCount += rhs.allocationsCount;
+    failedAllocationsCount += rhs.failedAllocationsCount;
+    freesCount += rhs.freesCount;
+    poolsCount += rhs.poolsCount;
+    poolSize += rhs.poolSize;
+    usedSize += rhs.usedSize;
+    requestedSize += rhs.requestedSize;
+    return *this;
+}
+
 bool UsmMemAllocPool::initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize, size_t minServicedSize, size_t maxServicedSize) {
     auto poolAllocation = svmMemoryManager->createUnifiedMemoryAllocation(poolSize, memoryProperties);
     if (nullptr == poolAllocation) {
@@ -101,11 +128,14 @@ void *UsmMemAllocPool::createUnifiedMemoryAllocation(size_t requestedSize, const
         auto actualSize = requestedSize;
         auto pooledAddress = this->chunkAllocator->allocateWithCustomAlignment(actualSize, memoryProperties.alignment);
         if (!pooledAddress) {
+            ++this->failedAllocationsCount;
             return nullptr;
         }
 
         pooledPtr = addrToPtr(pooledAddress);
         this->allocations.insert(pooledPtr, AllocationInfo{pooledAddress, actualSize, requestedSize});
+        ++this->allocationsCount;
+        this->requestedSize += requestedSize;
 
         ++this->svmMemoryManager->allocationsCounter;
     }
@@ -127,6 +157,8 @@ bool UsmMemAllocPool::freeSVMAlloc(const void *ptr, bool blocking) {
         if (allocationInfo) {
             DEBUG_BREAK_IF(allocationInfo->size == 0 || allocationInfo->address == 0);
             this->chunkAllocator->free(allocationInfo->address, allocationInfo->size);
+            ++this->freesCount;
+            this->requestedSize -= allocationInfo->requestedSize;
             return true;
         }
     }
@@ -162,6 +194,31 @@ size_t UsmMemAllocPool::getOffsetInPool(const void *ptr) const {
     return 0u;
 }
 
+UsmMemAllocPoolStats UsmMemAllocPool::getStats() {
+    UsmMemAllocPoolStats stats{};
+    if (isInitialized()) {
+        std::unique_lock<std::mutex> lock(mtx);
+        stats.allocationsCount = this->allocationsCount;
+        stats.failedAllocationsCount = this->failedAllocationsCount;
+        stats.freesCount = this->freesCount;
+        stats.poolsCount = 1u;
+        stats.poolSize = this->poolSize;
+        stats.usedSize = static_cast<size_t>(this->chunkAllocator->getUsedSize());
+        stats.requestedSize = this->requestedSize;
+    }
+    return stats;
+}
+
+UsmMemAllocPoolsManager::UsmMemAllocPoolsManager(MemoryManager *memoryManager,
+                                                 const RootDeviceIndicesContainer &rootDeviceIndices,
+                                                 const std::map<uint32_t, NEO::DeviceBitfield> &deviceBitFields,
+                                                 Device *device,
+                                                 InternalMemoryType poolMemoryType) : memoryManager(memoryManager), rootDeviceIndices(rootDeviceIndices), deviceBitFields(deviceBitFields), device(device), poolMemoryType(poolMemoryType) {
+    if (debugManager.flags.UsmMemAllocPoolShardsCount.get() > 0) {
+        this->shardsCount = static_cast<uint32_t>(debugManager.flags.UsmMemAllocPoolShardsCount.get());
+    }
+}
+
 bool UsmMemAllocPoolsManager::PoolInfo::isPreallocated() const {
     return 0u != preallocateSize;
 }
@@ -172,7 +229,7 @@ bool UsmMemAllocPoolsManager::ensureInitialized(SVMAllocsManager *svmMemoryManag
     if (isInitialized()) {
         return true;
     }
-    std::unique_lock<std::mutex> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     if (isInitialized()) {
         return true;
     }
@@ -183,10 +240,14 @@ bool UsmMemAllocPoolsManager::ensureInitialized(SVMAllocsManager *svmMemoryManag
     for (const auto &poolInfo : this->poolInfos) {
         this->pools[poolInfo] = std::vector<std::unique_ptr<UsmMemAllocPool>>();
         if (poolInfo.isPreallocated()) {
-            auto pool = std::make_unique<UsmMemAllocPool>();
-            allPoolAllocationsSucceeded &= pool->initialize(svmMemoryManager, poolsMemoryProperties, poolInfo.preallocateSize, poolInfo.minServicedSize, poolInfo.maxServicedSize);
-            this->pools[poolInfo].push_back(std::move(pool));
-            this->totalSize += poolInfo.preallocateSize;
+            const auto poolShardsCount = getShardsCount(poolInfo);
+            const size_t shardSize = std::max(alignDown(poolInfo.preallocateSize / poolShardsCount, MemoryConstants::pageSize64k), poolInfo.maxServicedSize);
+            for (auto shard = 0u; shard < poolShardsCount; ++shard) {
+                auto pool = std::make_unique<UsmMemAllocPool>();
+                allPoolAllocationsSucceeded &= pool->initialize(svmMemoryManager, poolsMemoryProperties, shardSize, poolInfo.minServicedSize, poolInfo.maxServicedSize);
+                this->pools[poolInfo].push_back(std::move(pool));
+                this->totalSize += shardSize;
+            }
         }
     }
     if (false == allPoolAllocationsSucceeded) {
@@ -202,7 +263,7 @@ bool UsmMemAllocPoolsManager::isInitialized() const {
 }
 
 void UsmMemAllocPoolsManager::trim() {
-    std::unique_lock<std::mutex> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     for (const auto &poolInfo : this->poolInfos) {
         if (false == poolInfo.isPreallocated()) {
             trim(this->pools[poolInfo]);
@@ -224,6 +285,9 @@ void UsmMemAllocPoolsManager::trim(std::vector<std::unique_ptr<UsmMemAllocPool>>
 }
 
 void UsmMemAllocPoolsManager::cleanup() {
+    if (debugManager.flags.PrintUsmMemAllocPoolStats.get() && isInitialized()) {
+        printStats();
+    }
     for (const auto &poolInfo : this->poolInfos) {
         for (const auto &pool : this->pools[poolInfo]) {
             pool->cleanup();
@@ -237,17 +301,22 @@ void *UsmMemAllocPoolsManager::createUnifiedMemoryAllocation(size_t size, const
     if (!canBePooled(size, memoryProperties)) {
         return nullptr;
     }
-    std::unique_lock<std::mutex> lock(mtx);
+    std::shared_lock<std::shared_mutex> lock(mtx);
     for (const auto &poolInfo : this->poolInfos) {
         if (size <= poolInfo.maxServicedSize) {
-            for (auto &pool : this->pools[poolInfo]) {
-                if (void *ptr = pool->createUnifiedMemoryAllocation(size, memoryProperties)) {
+            auto &poolVector = this->pools.at(poolInfo);
+            const auto poolsCount = poolVector.size();
+            // start from a per-thread pool so that threads allocating concurrently use different shards
+            const auto firstPoolIndex = poolsCount > 1u ? getThreadShardIndex() % poolsCount : 0u;
+            for (auto i = 0u; i < poolsCount; ++i) {
+                if (void *ptr = poolVector[(firstPoolIndex + i) % poolsCount]->createUnifiedMemoryAllocation(size, memoryProperties)) {
                     return ptr;
                 }
             }
             break;
         }
     }
+    ++this->failedAllocationsCount;
     return nullptr;
 }
 
@@ -300,7 +369,7 @@ bool UsmMemAllocPoolsManager::recycleSVMAlloc(void *ptr, bool blocking) {
     if (this->totalSize + svmData->size > getFreeMemory() * UsmMemAllocPool::getPercentOfFreeMemoryForRecycling(svmData->memoryType)) {
         return false;
     }
-    std::unique_lock<std::mutex> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx);
     for (auto poolInfoIndex = firstNonPreallocatedIndex; poolInfoIndex < this->poolInfos.size(); ++poolInfoIndex) {
         const auto &poolInfo = this->poolInfos[poolInfoIndex];
         if (svmData->size <= poolInfo.maxServicedSize) {
@@ -316,9 +385,9 @@ bool UsmMemAllocPoolsManager::recycleSVMAlloc(void *ptr, bool blocking) {
 }
 
 UsmMemAllocPool *UsmMemAllocPoolsManager::getPoolContainingAlloc(const void *ptr) {
-    std::unique_lock<std::mutex> lock(mtx);
-    for (const auto &poolInfo : this->poolInfos) {
-        for (auto &pool : this->pools[poolInfo]) {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    for (const auto &[poolInfo, poolVector] : this->pools) {
+        for (auto &pool : poolVector) {
             if (pool->isInPool(ptr)) {
                 return pool.get();
             }
@@ -327,4 +396,37 @@ UsmMemAllocPool *UsmMemAllocPoolsManager::getPoolContainingAlloc(const void *ptr
     return nullptr;
 }
 
+uint32_t UsmMemAllocPoolsManager::getShardsCount(const PoolInfo &poolInfo) const {
+    // every shard must fit the largest serviced size without exceeding the preallocated size of the whole class
+    const auto maxShardsCount = std::max(poolInfo.preallocateSize / poolInfo.maxServicedSize, static_cast<size_t>(1u));
+    return static_cast<uint32_t>(std::min(static_cast<size_t>(this->shardsCount), maxShardsCount));
+}
+
+uint32_t UsmMemAllocPoolsManager::getThreadShardIndex() {
+    static std::atomic<uint32_t> nextShardIndex{0u};
+    thread_local uint32_t shardIndex = nextShardIndex++;
+    return shardIndex;
+}
+
+UsmMemAllocPoolStats UsmMemAllocPoolsManager::getStats() {
+    UsmMemAllocPoolStats stats{};
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    for (const auto &[poolInfo, poolVector] : this->pools) {
+        for (const auto &pool : poolVector) {
+            stats += pool->getStats();
+        }
+    }
+    // a request tries several pools before it fails, so only requests not served by any pool are counted as misses
+    stats.failedAllocationsCount = this->failedAllocationsCount.load();
+    return stats;
+}
+
+void UsmMemAllocPoolsManager::printStats() {
+    auto stats = getStats();
+    PRINT_DEBUG_STRING(debugManager.flags.PrintUsmMemAllocPoolStats.get(), stdout, "USM pools stats: pools: %zu, pool size: %zu, used size: %zu, requested size: %zu, allocations: %llu, failed allocations: %llu, frees: %llu, hit rate: %.2f%%, fragmentation: %.2f%%\n",
+                       stats.poolsCount, stats.poolSize, stats.usedSize, stats.requestedSize,
+                       static_cast<unsigned long long>(stats.allocationsCount), static_cast<unsigned long long>(stats.failedAllocationsCount), static_cast<unsigned long long>(stats.freesCount),
+                       stats.getHitRate() * 100.0, stats.getFragmentation() * 100.0);
+}
+
 } // namespace NEO
\ No newline at end of file
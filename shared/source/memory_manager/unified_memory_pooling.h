@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,9 +12,25 @@
 #include "shared/source/utilities/sorted_vector.h"
 
 #include <array>
+#include <atomic>
 #include <map>
+#include <shared_mutex>
 
 namespace NEO {
+struct UsmMemAllocPoolStats {
+    uint64_t allocationsCount = 0u;
+    uint64_t failedAllocationsCount = 0u;
+    uint64_t freesCount = 0u;
+    size_t poolsCount = 0u;
+    size_t poolSize = 0u;
+    size_t usedSize = 0u;
+    size_t requestedSize = 0u;
+
+    double getHitRate() const;
+    double getFragmentation() const;
+    UsmMemAllocPoolStats &operator+=(const UsmMemAllocPoolStats &rhs);
+};
+
 class UsmMemAllocPool {
   public:
     using UnifiedMemoryProperties = SVMAllocsManager::UnifiedMemoryProperties;
@@ -43,6 +59,7 @@ class UsmMemAllocPool {
     size_t getPooledAllocationSize(const void *ptr);
     void *getPooledAllocationBasePtr(const void *ptr);
     size_t getOffsetInPool(const void *ptr) const;
+    UsmMemAllocPoolStats getStats();
 
     static constexpr auto chunkAlignment = 512u;
 
@@ -57,6 +74,10 @@ class UsmMemAllocPool {
     InternalMemoryType poolMemoryType;
     size_t minServicedSize;
     size_t maxServicedSize;
+    uint64_t allocationsCount = 0u;
+    uint64_t failedAllocationsCount = 0u;
+    uint64_t freesCount = 0u;
+    size_t requestedSize = 0u;
 };
 
 class UsmMemAllocPoolsManager {
@@ -89,7 +110,7 @@ class UsmMemAllocPoolsManager {
                             const RootDeviceIndicesContainer &rootDeviceIndices,
                             const std::map<uint32_t, NEO::DeviceBitfield> &deviceBitFields,
                             Device *device,
-                            InternalMemoryType poolMemoryType) : memoryManager(memoryManager), rootDeviceIndices(rootDeviceIndices), deviceBitFields(deviceBitFields), device(device), poolMemoryType(poolMemoryType){};
+                            InternalMemoryType poolMemoryType);
     MOCKABLE_VIRTUAL ~UsmMemAllocPoolsManager() = default;
     bool ensureInitialized(SVMAllocsManager *svmMemoryManager);
     bool isInitialized() const;
@@ -103,6 +124,8 @@ class UsmMemAllocPoolsManager {
     size_t getPooledAllocationSize(const void *ptr);
     void *getPooledAllocationBasePtr(const void *ptr);
     size_t getOffsetInPool(const void *ptr);
+    UsmMemAllocPoolStats getStats();
+    uint32_t getShardsCount() const { return shardsCount; }
 
   protected:
     static bool canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties) {
@@ -115,6 +138,9 @@ class UsmMemAllocPoolsManager {
     }
 
     UsmMemAllocPool *getPoolContainingAlloc(const void *ptr);
+    uint32_t getShardsCount(const PoolInfo &poolInfo) const;
+    static uint32_t getThreadShardIndex();
+    void printStats();
 
     SVMAllocsManager *svmMemoryManager{};
     MemoryManager *memoryManager;
@@ -123,7 +149,9 @@ class UsmMemAllocPoolsManager {
     Device *device;
     InternalMemoryType poolMemoryType;
     size_t totalSize{};
-    std::mutex mtx;
+    std::atomic<uint64_t> failedAllocationsCount{0u};
+    uint32_t shardsCount = 1u;
+    std::shared_mutex mtx;
     std::map<PoolInfo, std::vector<std::unique_ptr<UsmMemAllocPool>>> pools;
 };
 
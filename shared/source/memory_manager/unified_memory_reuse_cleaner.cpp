@@ -27,6 +27,10 @@ void UnifiedMemoryReuseCleaner::stopThread() {
         unifiedMemoryReuseCleanerThread->join();
         unifiedMemoryReuseCleanerThread.reset();
     }
+    if (scheduler) {
+        scheduler->unregisterTask(schedulerTaskId);
+        scheduler = nullptr;
+    }
 };
 
 void *UnifiedMemoryReuseCleaner::cleanUnifiedMemoryReuse(void *self) {
@@ -70,4 +74,14 @@ void UnifiedMemoryReuseCleaner::startThread() {
     this->unifiedMemoryReuseCleanerThread = Thread::createFunc(cleanUnifiedMemoryReuse, reinterpret_cast<void *>(this));
 }
 
+void UnifiedMemoryReuseCleaner::startInScheduler(PeriodicTaskScheduler &scheduler) {
+    this->scheduler = &scheduler;
+    auto trimTask = [this]() {
+        if (this->runCleaning.load()) {
+            this->trimOldInCaches();
+        }
+    };
+    this->schedulerTaskId = scheduler.registerTask(trimTask, sleepTime);
+}
+
 } // namespace NEO
\ No newline at end of file
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/periodic_task_scheduler.h"
 
 #include <chrono>
 #include <memory>
@@ -25,6 +26,7 @@ class UnifiedMemoryReuseCleaner {
     virtual ~UnifiedMemoryReuseCleaner();
 
     MOCKABLE_VIRTUAL void startThread();
+    void startInScheduler(PeriodicTaskScheduler &scheduler);
     void stopThread();
 
     static bool isSupported();
@@ -37,6 +39,8 @@ class UnifiedMemoryReuseCleaner {
     static void *cleanUnifiedMemoryReuse(void *self);
     MOCKABLE_VIRTUAL void trimOldInCaches();
     std::unique_ptr<Thread> unifiedMemoryReuseCleanerThread;
+    PeriodicTaskScheduler *scheduler = nullptr;
+    PeriodicTaskScheduler::TaskId schedulerTaskId = PeriodicTaskScheduler::invalidTaskId;
 
     std::vector<SvmAllocationCache *> svmAllocationCaches;
     std::mutex svmAllocationCachesMutex;
@@ -243,6 +243,7 @@ class BufferObject {
     uint32_t getOsContextId(OsContext *osContext);
 
     const auto &getBindInfo() const { return bindInfo; }
+    void setBindInfo(uint32_t osContextId, uint32_t vmHandleId, bool bound) { bindInfo[osContextId][vmHandleId] = bound; }
 
     void setChunked(bool chunked) { this->chunked = chunked; }
     bool isChunked() const { return this->chunked; }
@@ -73,6 +73,10 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
         useNotifyEnableForPostSync = !!(overrideUseNotifyEnableForPostSync);
     }
     kmdWaitTimeout = debugManager.flags.SetKmdWaitTimeout.get();
+
+    if (this->drm->isVmBindAvailable() && debugManager.flags.MakeEachAllocationResident.get() == -1) {
+        this->incrementalResidencyEnabled = debugManager.flags.EnableIncrementalResidency.get() == 1;
+    }
 }
 
 template <typename GfxFamily>
@@ -133,6 +137,7 @@ SubmissionStatus DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBu
 
     MemoryOperationsStatus retVal = memoryOperationsInterface->mergeWithResidencyContainer(this->osContext, allocationsForResidency);
     if (retVal != MemoryOperationsStatus::success) {
+        this->invalidateResidencyGeneration();
         if (retVal == MemoryOperationsStatus::outOfMemory) {
             return SubmissionStatus::outOfMemory;
         }
@@ -271,6 +276,10 @@ SubmissionStatus DrmCommandStreamReceiver<GfxFamily>::processResidency(Residency
 
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::makeNonResident(GraphicsAllocation &gfxAllocation) {
+    if (this->incrementalResidencyEnabled) {
+        // vm binds persist until the allocation is evicted, so residency is kept for following submissions
+        return;
+    }
     // Vector is moved to command buffer inside flush.
     // If flush wasn't called we need to make all objects non-resident.
     // If makeNonResident is called before flush, vector will be cleared.
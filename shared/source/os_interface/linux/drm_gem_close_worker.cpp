@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,13 @@ DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryMa
     thread = Thread::createFunc(worker, reinterpret_cast<void *>(this));
 }
 
+DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager, PeriodicTaskScheduler &scheduler) : memoryManager(memoryManager), scheduler(&scheduler) {
+    auto processQueueTask = [this]() {
+        this->processQueueInScheduler();
+    };
+    schedulerTaskId = scheduler.registerTask(processQueueTask, PeriodicTaskScheduler::onDemandPeriod);
+}
+
 void DrmGemCloseWorker::closeThread() {
     if (thread) {
         while (!workerDone.load()) {
@@ -32,6 +39,12 @@ void DrmGemCloseWorker::closeThread() {
         thread->join();
         thread.reset();
     }
+    if (scheduler) {
+        scheduler->unregisterTask(schedulerTaskId);
+        scheduler = nullptr;
+        processQueueInScheduler();
+        workerDone.store(true);
+    }
 }
 
 DrmGemCloseWorker::~DrmGemCloseWorker() {
@@ -43,6 +56,9 @@ void DrmGemCloseWorker::push(BufferObject *bo) {
     std::unique_lock<std::mutex> lock(closeWorkerMutex);
     workCount++;
     queue.push(bo);
+    if (scheduler) {
+        scheduler->notifyTask(schedulerTaskId);
+    }
     lock.unlock();
     condition.notify_one();
 }
@@ -55,6 +71,14 @@ void DrmGemCloseWorker::close(bool blocking) {
     }
 }
 
+void DrmGemCloseWorker::processQueueInScheduler() {
+    std::queue<BufferObject *> localQueue;
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    localQueue.swap(queue);
+    lock.unlock();
+    processQueue(localQueue);
+}
+
 bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
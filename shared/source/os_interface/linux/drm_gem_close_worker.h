@@ -1,11 +1,13 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/utilities/periodic_task_scheduler.h"
+
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
@@ -27,6 +29,8 @@ enum class GemCloseWorkerMode {
 class DrmGemCloseWorker {
   public:
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
+    // Queue is processed by a task of the scheduler instead of a dedicated thread
+    DrmGemCloseWorker(DrmMemoryManager &memoryManager, PeriodicTaskScheduler &scheduler);
     MOCKABLE_VIRTUAL ~DrmGemCloseWorker();
 
     DrmGemCloseWorker(const DrmGemCloseWorker &) = delete;
@@ -40,11 +44,14 @@ class DrmGemCloseWorker {
   protected:
     void close(BufferObject *workItem);
     void closeThread();
+    void processQueueInScheduler();
     void processQueue(std::queue<BufferObject *> &inputQueue);
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
+    PeriodicTaskScheduler *scheduler = nullptr;
+    PeriodicTaskScheduler::TaskId schedulerTaskId = PeriodicTaskScheduler::invalidTaskId;
 
     std::queue<BufferObject *> queue;
     std::atomic<uint32_t> workCount{0};
@@ -125,7 +125,11 @@ void DrmMemoryManager::initialize(GemCloseWorkerMode mode) {
     }
 
     if (mode != GemCloseWorkerMode::gemCloseWorkerInactive) {
-        gemCloseWorker.reset(new DrmGemCloseWorker(*this));
+        if (debugManager.flags.EnablePeriodicTaskScheduler.get() == 1) {
+            gemCloseWorker.reset(new DrmGemCloseWorker(*this, *executionEnvironment.initializePeriodicTaskScheduler()));
+        } else {
+            gemCloseWorker.reset(new DrmGemCloseWorker(*this));
+        }
     }
 
     for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < gfxPartitions.size(); ++rootDeviceIndex) {
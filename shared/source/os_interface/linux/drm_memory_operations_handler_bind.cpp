@@ -17,7 +17,10 @@
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
+#include "shared/source/os_interface/linux/ioctl_helper.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/os_interface/os_interface.h"
 
 namespace NEO {
 
@@ -47,9 +50,22 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::lock(Device *device, Arra
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContext(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto ioctlHelper = getIoctlHelperForVmBindBatching();
+    const bool batchStarted = ioctlHelper && ioctlHelper->beginVmBindBatch();
+
+    auto status = makeResidentWithinOsContextImpl(osContext, gfxAllocations, evictable);
+
+    if (batchStarted && ioctlHelper->endVmBindBatch() != 0 && status == MemoryOperationsStatus::success) {
+        status = MemoryOperationsStatus::outOfMemory;
+    }
+    return status;
+}
+
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContextImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable) {
     auto deviceBitfield = osContext->getDeviceBitfield();
 
-    std::lock_guard<std::mutex> lock(mutex);
     auto devicesDone = 0u;
     for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
         if (!deviceBitfield.test(drmIterator)) {
@@ -155,6 +171,13 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::mergeWithResidencyContain
     return MemoryOperationsStatus::success;
 }
 
+IoctlHelper *DrmMemoryOperationsHandlerBind::getIoctlHelperForVmBindBatching() const {
+    if (debugManager.flags.EnableBatchedVmBind.get() != 1) {
+        return nullptr;
+    }
+    return rootDeviceEnvironment.osInterface->getDriverModel()->as<Drm>()->getIoctlHelper();
+}
+
 std::unique_lock<std::mutex> DrmMemoryOperationsHandlerBind::lockHandlerIfUsed() {
     return std::unique_lock<std::mutex>();
 }
@@ -169,6 +192,7 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocations(bo
 
     auto allocLock = memoryManager->acquireAllocLock();
 
+    auto retVal = MemoryOperationsStatus::success;
     for (const auto status : {
              this->evictUnusedAllocationsImpl(memoryManager->getSysMemAllocs(), waitForCompletion),
              this->evictUnusedAllocationsImpl(memoryManager->getLocalMemAllocs(this->rootDeviceIndex), waitForCompletion)}) {
@@ -176,9 +200,12 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocations(bo
         if (status == MemoryOperationsStatus::gpuHangDetectedDuringOperation) {
             return MemoryOperationsStatus::gpuHangDetectedDuringOperation;
         }
+        if (status != MemoryOperationsStatus::success) {
+            retVal = status;
+        }
     }
 
-    return MemoryOperationsStatus::success;
+    return retVal;
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion) {
@@ -222,6 +249,8 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImp
             }
         }
 
+        auto ioctlHelper = getIoctlHelperForVmBindBatching();
+        const bool batchStarted = ioctlHelper && !evictCandidates.empty() && ioctlHelper->beginVmBindBatch();
         for (auto &allocationToEvict : evictCandidates) {
             for (const auto &engine : engines) {
                 if (engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
@@ -232,6 +261,9 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImp
             }
         }
         evictCandidates.clear();
+        if (batchStarted && ioctlHelper->endVmBindBatch() != 0) {
+            return MemoryOperationsStatus::failed;
+        }
     }
 
     return MemoryOperationsStatus::success;
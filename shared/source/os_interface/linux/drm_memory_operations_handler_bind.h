@@ -10,6 +10,7 @@
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 
 namespace NEO {
+class IoctlHelper;
 struct RootDeviceEnvironment;
 class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
   public:
@@ -29,6 +30,8 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
     MemoryOperationsStatus evictUnusedAllocations(bool waitForCompletion, bool isLockNeeded) override;
 
   protected:
+    MemoryOperationsStatus makeResidentWithinOsContextImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable);
+    IoctlHelper *getIoctlHelperForVmBindBatching() const;
     MOCKABLE_VIRTUAL int evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield);
     MemoryOperationsStatus evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion);
     const RootDeviceEnvironment &rootDeviceEnvironment;
@@ -1458,6 +1458,9 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
         vmBind.offset = 0;
         vmBind.start = bo->peekAddress();
         vmBind.userptr = bo->getUserptr();
+        vmBind.bo = bo;
+        vmBind.boOsContextId = bo->getOsContextId(osContext);
+        vmBind.vmHandleId = vmHandleId;
         vmBind.sharedSystemUsmEnabled = drm->isSharedSystemAllocEnabled();
         vmBind.sharedSystemUsmBind = false;
 
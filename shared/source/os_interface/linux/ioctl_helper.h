@@ -25,6 +25,7 @@
 #include <vector>
 
 namespace NEO {
+class BufferObject;
 class Drm;
 class DrmAllocation;
 class DrmMemoryManager;
@@ -75,6 +76,9 @@ struct VmBindParams {
     uint64_t userFence;
     uint64_t patIndex;
     uint64_t userptr;
+    BufferObject *bo;
+    uint32_t boOsContextId;
+    uint32_t vmHandleId;
     bool sharedSystemUsmEnabled;
     bool sharedSystemUsmBind;
 };
@@ -192,6 +196,8 @@ class IoctlHelper {
     virtual void *pciBarrierMmap() { return nullptr; };
     virtual void setupIpVersion();
     virtual bool isImmediateVmBindRequired() const { return false; }
+    virtual bool beginVmBindBatch() { return false; }
+    virtual int endVmBindBatch() { return 0; }
 
     uint32_t getFlagsForPrimeHandleToFd() const;
     virtual std::unique_ptr<MemoryInfo> createMemoryInfo() = 0;
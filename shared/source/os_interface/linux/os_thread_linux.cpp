@@ -7,6 +7,7 @@
 
 #include "shared/source/os_interface/linux/os_thread_linux.h"
 
+#include <pthread.h>
 #include <sched.h>
 
 namespace NEO {
@@ -20,6 +21,17 @@ std::unique_ptr<Thread> Thread::create(void *(*func)(void *), void *arg) {
     return std::unique_ptr<Thread>(new ThreadLinux(threadId));
 }
 
+bool Thread::setCurrentThreadAffinity(uint64_t cpuMask) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (uint32_t cpu = 0u; cpu < 64u; cpu++) {
+        if (cpuMask & (1ull << cpu)) {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+}
+
 void ThreadLinux::join() {
     pthread_join(threadId, nullptr);
 }
@@ -1338,6 +1338,7 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
     const char *operation = isBind ? "bind" : "unbind";
 
     uint64_t userptr = 0u;
+    uint64_t previousUserptrAddr = 0u;
     {
         std::unique_lock<std::mutex> lock(xeLock);
         if (isBind) {
@@ -1345,6 +1346,7 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
                 for (auto i = 0u; i < bindInfo.size(); i++) {
                     if (vmBindParams.userptr == bindInfo[i].userptr) {
                         userptr = bindInfo[i].userptr;
+                        previousUserptrAddr = bindInfo[i].addr;
                         bindInfo[i].addr = gmmHelper->decanonize(vmBindParams.start);
                         break;
                     }
@@ -1411,6 +1413,41 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
         bind.bind.obj = 0;
     }
 
+    const bool userptrBind = isBind && userptr != 0u;
+    bool batched = false;
+    std::unique_lock<std::mutex> batchLock;
+    if (isVmBindBatchingEnabled()) {
+        batchLock = std::unique_lock<std::mutex>(xeLock);
+        batched = isVmBindBatchOwnedByCurrentThread();
+        if (!batched) {
+            batchLock.unlock();
+        }
+    }
+    if (batched) {
+        // bind extensions live on the caller's stack, so only plain binds can be deferred
+        const bool deferrable = bind.bind.extensions == 0;
+        const bool sameGroup = vmBindBatch.pendingOps.empty() || (vmBindBatch.vmId == bind.vm_id && vmBindBatch.fenceAddress == sync[0].addr);
+        if (!deferrable || !sameGroup) {
+            ret = flushPendingVmBindOps();
+            if (ret != 0) {
+                if (userptrBind) {
+                    restoreBindInfoAddr(userptr, previousUserptrAddr);
+                }
+                xeLog("error: %s\n", operation);
+                return ret;
+            }
+        }
+        if (deferrable) {
+            vmBindBatch.pendingOps.push_back({bind.bind.addr, bind.bind.range, bind.bind.obj_offset, bind.bind.obj, bind.bind.op, bind.bind.flags, bind.bind.pat_index,
+                                              userptrBind ? userptr : 0u, previousUserptrAddr, vmBindParams.bo, vmBindParams.boOsContextId, vmBindParams.vmHandleId, isBind});
+            vmBindBatch.vmId = bind.vm_id;
+            vmBindBatch.fenceAddress = sync[0].addr;
+            vmBindBatch.fenceValue = sync[0].timeline_value;
+            xeLog(" vm=%d obj=0x%x addr=0x%llx operation=%d(%s) deferred\n", bind.vm_id, bind.bind.obj, bind.bind.addr, bind.bind.op, xeGetBindOperationName(bind.bind.op));
+            return 0;
+        }
+    }
+
     ret = IoctlHelper::ioctl(DrmIoctl::gemVmBind, &bind);
 
     xeLog(" vm=%d obj=0x%x off=0x%llx range=0x%llx addr=0x%llx operation=%d(%s) flags=%d(%s) nsy=%d pat=%hu ret=%d\n",
@@ -1428,21 +1465,156 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool isBind) {
           ret);
 
     if (ret != 0) {
+        if (batched && userptrBind) {
+            restoreBindInfoAddr(userptr, previousUserptrAddr);
+        }
         xeLog("error: %s\n", operation);
         return ret;
     }
 
+    if (batched) {
+        addVmBindUserFenceToWait(sync[0].addr, sync[0].timeline_value);
+        return 0;
+    }
+
+    return xeWaitUserFence(bind.exec_queue_id, DRM_XE_UFENCE_WAIT_OP_EQ,
+                           sync[0].addr,
+                           sync[0].timeline_value, getVmBindWaitUserFenceTimeout(),
+                           false, NEO::InterruptId::notUsed, nullptr);
+}
+
+int64_t IoctlHelperXe::getVmBindWaitUserFenceTimeout() const {
     constexpr auto oneSecTimeout = 1000000000ll;
     constexpr auto infiniteTimeout = -1;
     bool debuggingEnabled = drm.getRootDeviceEnvironment().executionEnvironment.isDebuggingEnabled();
-    uint64_t timeout = debuggingEnabled ? infiniteTimeout : oneSecTimeout;
+    int64_t timeout = debuggingEnabled ? infiniteTimeout : oneSecTimeout;
     if (debugManager.flags.VmBindWaitUserFenceTimeout.get() != -1) {
         timeout = debugManager.flags.VmBindWaitUserFenceTimeout.get();
     }
-    return xeWaitUserFence(bind.exec_queue_id, DRM_XE_UFENCE_WAIT_OP_EQ,
-                           sync[0].addr,
-                           sync[0].timeline_value, timeout,
-                           false, NEO::InterruptId::notUsed, nullptr);
+    return timeout;
+}
+
+bool IoctlHelperXe::isVmBindBatchingEnabled() const {
+    return debugManager.flags.EnableBatchedVmBind.get() == 1;
+}
+
+bool IoctlHelperXe::isVmBindBatchOwnedByCurrentThread() const {
+    return vmBindBatch.depth > 0 && vmBindBatch.owner == std::this_thread::get_id();
+}
+
+bool IoctlHelperXe::beginVmBindBatch() {
+    if (!isVmBindBatchingEnabled()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(xeLock);
+    auto currentThread = std::this_thread::get_id();
+    if (vmBindBatch.depth > 0 && vmBindBatch.owner != currentThread) {
+        return false;
+    }
+    vmBindBatch.owner = currentThread;
+    vmBindBatch.depth++;
+    return true;
+}
+
+int IoctlHelperXe::endVmBindBatch() {
+    std::vector<std::pair<uint64_t, uint64_t>> userFencesToWait;
+    int ret = 0;
+    {
+        std::lock_guard<std::mutex> lock(xeLock);
+        UNRECOVERABLE_IF(!isVmBindBatchOwnedByCurrentThread());
+        if (--vmBindBatch.depth > 0) {
+            return 0;
+        }
+        ret = flushPendingVmBindOps();
+        userFencesToWait.swap(vmBindBatch.userFencesToWait);
+        vmBindBatch.owner = std::thread::id();
+    }
+
+    auto timeout = getVmBindWaitUserFenceTimeout();
+    for (const auto &[addr, value] : userFencesToWait) {
+        auto waitRet = xeWaitUserFence(0u, DRM_XE_UFENCE_WAIT_OP_EQ, addr, value, timeout, false, NEO::InterruptId::notUsed, nullptr);
+        if (ret == 0) {
+            ret = waitRet;
+        }
+    }
+    return ret;
+}
+
+int IoctlHelperXe::flushPendingVmBindOps() {
+    auto &pendingOps = vmBindBatch.pendingOps;
+    if (pendingOps.empty()) {
+        return 0;
+    }
+
+    std::vector<drm_xe_vm_bind_op> bindOps(pendingOps.size());
+    for (auto i = 0u; i < pendingOps.size(); i++) {
+        bindOps[i].addr = pendingOps[i].addr;
+        bindOps[i].range = pendingOps[i].range;
+        bindOps[i].obj_offset = pendingOps[i].objOffset;
+        bindOps[i].obj = pendingOps[i].obj;
+        bindOps[i].op = pendingOps[i].op;
+        bindOps[i].flags = pendingOps[i].flags;
+        bindOps[i].pat_index = pendingOps[i].patIndex;
+    }
+
+    drm_xe_vm_bind bind = {};
+    bind.vm_id = vmBindBatch.vmId;
+    bind.num_binds = static_cast<uint32_t>(bindOps.size());
+    if (bind.num_binds == 1) {
+        bind.bind = bindOps[0];
+    } else {
+        bind.vector_of_binds = castToUint64(bindOps.data());
+    }
+
+    drm_xe_sync sync[1] = {};
+    sync[0].type = DRM_XE_SYNC_TYPE_USER_FENCE;
+    sync[0].flags = DRM_XE_SYNC_FLAG_SIGNAL;
+    sync[0].addr = vmBindBatch.fenceAddress;
+    sync[0].timeline_value = vmBindBatch.fenceValue;
+    bind.num_syncs = 1;
+    bind.syncs = reinterpret_cast<uintptr_t>(&sync);
+
+    auto ret = IoctlHelper::ioctl(DrmIoctl::gemVmBind, &bind);
+    xeLog(" vm=%d num_binds=%d nsy=%d ret=%d\n", bind.vm_id, bind.num_binds, bind.num_syncs, ret);
+    if (ret != 0) {
+        // none of the deferred binds took place, while their buffer objects already recorded them as done,
+        // so binding state and userptr addresses recorded for them are reverted in reverse order
+        for (auto it = pendingOps.rbegin(); it != pendingOps.rend(); ++it) {
+            if (it->bo) {
+                it->bo->setBindInfo(it->boOsContextId, it->vmHandleId, !it->bindOp);
+            }
+            if (it->userptr != 0u) {
+                restoreBindInfoAddr(it->userptr, it->previousUserptrAddr);
+            }
+        }
+        pendingOps.clear();
+        xeLog("error: batched bind\n");
+        return ret;
+    }
+    pendingOps.clear();
+
+    addVmBindUserFenceToWait(sync[0].addr, sync[0].timeline_value);
+    return 0;
+}
+
+void IoctlHelperXe::restoreBindInfoAddr(uint64_t userptr, uint64_t addr) {
+    for (auto &info : bindInfo) {
+        if (info.userptr == userptr) {
+            info.addr = addr;
+            return;
+        }
+    }
+}
+
+void IoctlHelperXe::addVmBindUserFenceToWait(uint64_t addr, uint64_t value) {
+    // binds on a vm complete in order, so waiting for the latest value of each fence covers all earlier ones
+    for (auto &userFence : vmBindBatch.userFencesToWait) {
+        if (userFence.first == addr) {
+            userFence.second = value;
+            return;
+        }
+    }
+    vmBindBatch.userFencesToWait.emplace_back(addr, value);
 }
 
 std::string IoctlHelperXe::getDrmParamString(DrmParam drmParam) const {
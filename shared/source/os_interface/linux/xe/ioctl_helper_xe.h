@@ -16,6 +16,7 @@
 #include <bitset>
 #include <mutex>
 #include <optional>
+#include <thread>
 
 namespace NEO {
 
@@ -116,6 +117,8 @@ class IoctlHelperXe : public IoctlHelper {
     bool setGpuCpuTimes(TimeStampData *pGpuCpuTime, OSTime *osTime) override;
     bool getFdFromVmExport(uint32_t vmId, uint32_t flags, int32_t *fd) override;
     bool isImmediateVmBindRequired() const override;
+    bool beginVmBindBatch() override;
+    int endVmBindBatch() override;
     void fillExecObject(ExecObject &execObject, uint32_t handle, uint64_t gpuAddress, uint32_t drmContextId, bool bindInfo, bool isMarkedForCapture) override;
     void logExecObject(const ExecObject &execObject, std::stringstream &logger, size_t size) override;
     void fillExecBuffer(ExecBuffer &execBuffer, uintptr_t buffersPtr, uint32_t bufferCount, uint32_t startOffset, uint32_t size, uint64_t flags, uint32_t drmContextId) override;
@@ -146,6 +149,12 @@ class IoctlHelperXe : public IoctlHelper {
     virtual int xeWaitUserFence(uint32_t ctxId, uint16_t op, uint64_t addr, uint64_t value, int64_t timeout, bool userInterrupt, uint32_t externalInterruptId, GraphicsAllocation *allocForInterruptWait);
     void setupXeWaitUserFenceStruct(void *arg, uint32_t ctxId, uint16_t op, uint64_t addr, uint64_t value, int64_t timeout);
     int xeVmBind(const VmBindParams &vmBindParams, bool bindOp);
+    int64_t getVmBindWaitUserFenceTimeout() const;
+    bool isVmBindBatchingEnabled() const;
+    bool isVmBindBatchOwnedByCurrentThread() const;
+    int flushPendingVmBindOps();
+    void restoreBindInfoAddr(uint64_t userptr, uint64_t addr);
+    void addVmBindUserFenceToWait(uint64_t addr, uint64_t value);
     void xeShowBindTable();
     void updateBindInfo(uint64_t userPtr);
     int debuggerOpenIoctl(DrmIoctl request, void *arg);
@@ -163,6 +172,34 @@ class IoctlHelperXe : public IoctlHelper {
         uint64_t value;
     };
 
+    struct PendingVmBindOp {
+        uint64_t addr;
+        uint64_t range;
+        uint64_t objOffset;
+        uint32_t obj;
+        uint32_t op;
+        uint32_t flags;
+        uint16_t patIndex;
+        uint64_t userptr;
+        uint64_t previousUserptrAddr;
+        BufferObject *bo;
+        uint32_t boOsContextId;
+        uint32_t vmHandleId;
+        bool bindOp;
+    };
+
+    // Binds issued by the owning thread between beginVmBindBatch and endVmBindBatch are merged
+    // into array binds and their user fences are waited for once, when the batch ends.
+    struct VmBindBatch {
+        std::thread::id owner;
+        uint32_t depth = 0;
+        uint32_t vmId = 0;
+        uint64_t fenceAddress = 0;
+        uint64_t fenceValue = 0;
+        std::vector<PendingVmBindOp> pendingOps;
+        std::vector<std::pair<uint64_t, uint64_t>> userFencesToWait;
+    };
+
     uint16_t getDefaultEngineClass(const aub_stream::EngineType &defaultEngineType);
     void setOptionalContextProperties(Drm &drm, void *extProperties, uint32_t &extIndexInOut);
     virtual void setContextProperties(const OsContextLinux &osContext, void *extProperties, uint32_t &extIndexInOut);
@@ -179,6 +216,7 @@ class IoctlHelperXe : public IoctlHelper {
     std::mutex xeLock;
     std::mutex gemCloseLock;
     std::vector<BindInfo> bindInfo;
+    VmBindBatch vmBindBatch;
     std::vector<uint32_t> hwconfig;
     std::vector<XeDrm::drm_xe_engine_class_instance> contextParamEngine;
 
@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include <cstdint>
 #include <memory>
 namespace NEO {
 
@@ -14,6 +15,8 @@ class Thread {
 
   public:
     static decltype(&Thread::create) createFunc;
+    // Restricts calling thread to CPUs set in the mask, bit N selects CPU N
+    static bool setCurrentThreadAffinity(uint64_t cpuMask);
     virtual void join() = 0;
     virtual ~Thread() = default;
     virtual void yield() = 0;
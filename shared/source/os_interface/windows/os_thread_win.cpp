@@ -1,11 +1,14 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/os_interface/windows/os_thread_win.h"
+
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
 namespace NEO {
 ThreadWin::ThreadWin(std::thread *thread) {
     this->thread.reset(thread);
@@ -17,6 +20,10 @@ std::unique_ptr<Thread> Thread::create(void *(*func)(void *), void *arg) {
     return std::unique_ptr<Thread>(new ThreadWin(new std::thread(func, arg)));
 }
 
+bool Thread::setCurrentThreadAffinity(uint64_t cpuMask) {
+    return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(cpuMask)) != 0;
+}
+
 void ThreadWin::join() {
     thread->join();
 }
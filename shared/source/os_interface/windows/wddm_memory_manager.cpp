@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -56,8 +56,12 @@ WddmMemoryManager::~WddmMemoryManager() = default;
 
 WddmMemoryManager::WddmMemoryManager(ExecutionEnvironment &executionEnvironment) : MemoryManager(executionEnvironment) {
     asyncDeleterEnabled = isDeferredDeleterEnabled();
-    if (asyncDeleterEnabled)
+    if (asyncDeleterEnabled) {
         deferredDeleter = createDeferredDeleter();
+        if (debugManager.flags.EnablePeriodicTaskScheduler.get() == 1) {
+            deferredDeleter->setScheduler(executionEnvironment.initializePeriodicTaskScheduler());
+        }
+    }
     mallocRestrictions.minAddress = 0u;
 
     for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < gfxPartitions.size(); ++rootDeviceIndex) {
@@ -8,6 +8,7 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -17,6 +18,15 @@
 
 namespace NEO {
 
+CpuPageFaultManager::CpuPageFaultManager() {
+    if (debugManager.flags.PageFaultManagerFaultAheadCount.get() != -1) {
+        this->faultAheadCount = static_cast<uint32_t>(debugManager.flags.PageFaultManagerFaultAheadCount.get());
+    }
+    if (debugManager.flags.PageFaultManagerCoalesceProtection.get() != -1) {
+        this->coalesceProtection = debugManager.flags.PageFaultManagerCoalesceProtection.get() == 1;
+    }
+}
+
 void CpuPageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ, const MemoryProperties &memoryProperties) {
     auto initialPlacement = MemoryPropertiesHelper::getUSMInitialPlacement(memoryProperties);
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::cpu : AllocationDomain::none;
@@ -69,37 +79,64 @@ void CpuPageFaultManager::moveAllocationToGpuDomain(void *ptr) {
 
 void CpuPageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto allocPtr : unifiedMemoryManager->nonGpuDomainAllocs) {
+    auto &cpuAllocs = unifiedMemoryManager->nonGpuDomainAllocs;
+    // Migrate in address order, so allocations adjacent in memory can be protected together after all transfers
+    std::sort(cpuAllocs.begin(), cpuAllocs.end());
+    cpuAllocs.erase(std::unique(cpuAllocs.begin(), cpuAllocs.end()), cpuAllocs.end());
+
+    void *protectedRangeStart = nullptr;
+    void *protectedRangeEnd = nullptr;
+    for (auto allocPtr : cpuAllocs) {
         auto &pageFaultData = this->memoryData[allocPtr];
-        this->migrateStorageToGpuDomain(allocPtr, pageFaultData);
+        if (pageFaultData.domain == AllocationDomain::cpu) {
+            this->transferStorageToGpu(allocPtr, pageFaultData);
+
+            auto allocEnd = ptrOffset(allocPtr, pageFaultData.size);
+            if (this->coalesceProtection && protectedRangeEnd != nullptr && allocPtr <= alignUp(protectedRangeEnd, MemoryConstants::pageSize)) {
+                protectedRangeEnd = std::max(protectedRangeEnd, allocEnd);
+            } else {
+                if (protectedRangeEnd != nullptr) {
+                    this->protectCPUMemoryAccess(protectedRangeStart, ptrDiff(protectedRangeEnd, protectedRangeStart));
+                }
+                protectedRangeStart = allocPtr;
+                protectedRangeEnd = allocEnd;
+            }
+        }
+        pageFaultData.domain = AllocationDomain::gpu;
+    }
+    if (protectedRangeEnd != nullptr) {
+        this->protectCPUMemoryAccess(protectedRangeStart, ptrDiff(protectedRangeEnd, protectedRangeStart));
     }
-    unifiedMemoryManager->nonGpuDomainAllocs.clear();
+    cpuAllocs.clear();
 }
 
 inline void CpuPageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
     if (pageFaultData.domain == AllocationDomain::cpu) {
-        this->setCpuAllocEvictable(false, ptr, pageFaultData.unifiedMemoryManager);
-        this->allowCPUMemoryEviction(false, ptr, pageFaultData);
+        this->transferStorageToGpu(ptr, pageFaultData);
+        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+    }
+    pageFaultData.domain = AllocationDomain::gpu;
+}
 
-        std::chrono::steady_clock::time_point start;
-        std::chrono::steady_clock::time_point end;
+inline void CpuPageFaultManager::transferStorageToGpu(void *ptr, PageFaultData &pageFaultData) {
+    this->setCpuAllocEvictable(false, ptr, pageFaultData.unifiedMemoryManager);
+    this->allowCPUMemoryEviction(false, ptr, pageFaultData);
 
-        if (debugManager.flags.RegisterPageFaultHandlerOnMigration.get()) {
-            if (this->checkFaultHandlerFromPageFaultManager() == false) {
-                this->registerFaultHandler();
-            }
-        }
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
 
-        start = std::chrono::steady_clock::now();
-        this->transferToGpu(ptr, pageFaultData.cmdQ);
-        end = std::chrono::steady_clock::now();
-        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    if (debugManager.flags.RegisterPageFaultHandlerOnMigration.get()) {
+        if (this->checkFaultHandlerFromPageFaultManager() == false) {
+            this->registerFaultHandler();
+        }
+    }
 
-        PRINT_DEBUG_STRING(debugManager.flags.PrintUmdSharedMigration.get(), stdout, "UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
+    start = std::chrono::steady_clock::now();
+    this->transferToGpu(ptr, pageFaultData.cmdQ);
+    end = std::chrono::steady_clock::now();
+    long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
-        this->protectCPUMemoryAccess(ptr, pageFaultData.size);
-    }
-    pageFaultData.domain = AllocationDomain::gpu;
+    PRINT_DEBUG_STRING(debugManager.flags.PrintUmdSharedMigration.get(), stdout, "UMD transferred shared allocation 0x%llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(ptr), pageFaultData.size, elapsedTime / 1e3);
 }
 
 void CpuPageFaultManager::handlePageFault(void *ptr, PageFaultData &faultData) {
@@ -107,6 +144,19 @@ void CpuPageFaultManager::handlePageFault(void *ptr, PageFaultData &faultData) {
     gpuDomainHandler(this, ptr, faultData);
 }
 
+void CpuPageFaultManager::handleFaultAhead(void *ptr, PageFaultData &faultData) {
+    // CPU usually walks consecutive allocations after kernel execution,
+    // migrating following ones now saves a fault per allocation
+    auto neighbour = memoryData.upper_bound(ptr);
+    for (auto i = 0u; i < this->faultAheadCount && neighbour != memoryData.end(); i++, ++neighbour) {
+        auto &neighbourData = neighbour->second;
+        if (neighbourData.unifiedMemoryManager != faultData.unifiedMemoryManager || neighbourData.domain == AllocationDomain::cpu) {
+            break;
+        }
+        handlePageFault(neighbour->first, neighbourData);
+    }
+}
+
 bool CpuPageFaultManager::verifyAndHandlePageFault(void *ptr, bool handleFault) {
     std::unique_lock<SpinLock> lock{mtx};
     auto allocPtr = getFaultData(memoryData, ptr, handleFault);
@@ -114,7 +164,9 @@ bool CpuPageFaultManager::verifyAndHandlePageFault(void *ptr, bool handleFault)
         return false;
     }
     if (handleFault) {
-        handlePageFault(allocPtr, memoryData[allocPtr]);
+        auto &faultData = memoryData[allocPtr];
+        handlePageFault(allocPtr, faultData);
+        handleFaultAhead(allocPtr, faultData);
     }
     return true;
 }
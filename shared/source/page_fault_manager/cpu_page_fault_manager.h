@@ -11,8 +11,8 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <map>
 #include <memory>
-#include <unordered_map>
 
 namespace NEO {
 struct MemoryProperties;
@@ -26,7 +26,7 @@ class CpuPageFaultManager : public NonCopyableClass {
   public:
     static std::unique_ptr<CpuPageFaultManager> create();
 
-    CpuPageFaultManager() = default;
+    CpuPageFaultManager();
 
     virtual ~CpuPageFaultManager() = default;
 
@@ -69,19 +69,22 @@ class CpuPageFaultManager : public NonCopyableClass {
 
     virtual bool verifyAndHandlePageFault(void *ptr, bool handlePageFault);
 
+    // Allocations never overlap, so the only candidate is the last one starting at or below ptr
     template <class FaultDataType>
-    void *getFaultData(std::unordered_map<void *, FaultDataType> &memData, void *ptr, bool handleFault) {
-        for (auto &alloc : memData) {
-            auto allocPtr = alloc.first;
-            auto &pageFaultData = alloc.second;
-            if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-                return allocPtr;
-            }
+    void *getFaultData(std::map<void *, FaultDataType> &memData, void *ptr, bool handleFault) {
+        auto alloc = memData.upper_bound(ptr);
+        if (alloc == memData.begin()) {
+            return nullptr;
+        }
+        --alloc;
+        if (ptr < ptrOffset(alloc->first, alloc->second.size)) {
+            return alloc->first;
         }
         return nullptr;
     }
 
     void handlePageFault(void *ptr, PageFaultData &faultData);
+    void handleFaultAhead(void *ptr, PageFaultData &faultData);
 
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
@@ -92,12 +95,15 @@ class CpuPageFaultManager : public NonCopyableClass {
     static void unprotectAndTransferMemory(CpuPageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     void selectGpuDomainHandler();
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+    inline void transferStorageToGpu(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
 
     using gpuDomainHandlerType = decltype(&transferAndUnprotectMemory);
     gpuDomainHandlerType gpuDomainHandler = &transferAndUnprotectMemory;
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    std::map<void *, PageFaultData> memoryData;
     SpinLock mtx;
+    uint32_t faultAheadCount = 0u;
+    bool coalesceProtection = false;
 };
 } // namespace NEO
@@ -37,6 +37,8 @@ PageFaultManagerLinux::PageFaultManagerLinux() {
 
     this->evictMemoryAfterCopy = debugManager.flags.EnableDirectSubmission.get() &&
                                  debugManager.flags.USMEvictAfterMigration.get();
+    // mprotect accepts ranges spanning adjacent mappings, so neighbouring allocations can be protected at once
+    this->coalesceProtection = debugManager.flags.PageFaultManagerCoalesceProtection.get() != 0;
 }
 
 PageFaultManagerLinux::~PageFaultManagerLinux() {
@@ -37,7 +37,7 @@ class TbxPageFaultManager : public virtual CpuPageFaultManager {
   protected:
     void handlePageFault(void *ptr, PageFaultDataTbx &faultData);
 
-    std::unordered_map<void *, PageFaultDataTbx> memoryDataTbx;
+    std::map<void *, PageFaultDataTbx> memoryDataTbx;
     SpinLock mtxTbx;
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,12 +9,14 @@
 #include "shared/source/utilities/arrayref.h"
 
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace NEO {
+class CompilerCache;
 class Device;
 struct ExternalFunctionInfo;
 struct LinkerInput;
@@ -48,6 +50,9 @@ struct ProgramInfo {
     uint32_t minScratchSpaceSize = 0U;
     uint32_t indirectDetectionVersion = 0U;
     size_t kernelMiscInfoPos = std::string::npos;
+    CompilerCache *decodedProgramCache = nullptr;
+    // calls work for each of itemsCount kernels, possibly on several threads; kernels are decoded serially when empty
+    std::function<void(size_t itemsCount, const std::function<void(size_t)> &work)> runForEachKernel;
 };
 
 size_t getMaxInlineSlmNeeded(const ProgramInfo &programInfo);
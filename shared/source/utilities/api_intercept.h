@@ -1,12 +1,14 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
-#define SYSTEM_ENTER()
-#define SYSTEM_LEAVE(id)
-#define WAIT_ENTER()
-#define WAIT_LEAVE()
+#include "shared/source/utilities/perf_trace.h"
+
+#define SYSTEM_ENTER() NEO::PerfTracer::traceEvent(NEO::PerfTraceEventType::system, NEO::PerfTracePhase::enter, __FUNCTION__, 0u);
+#define SYSTEM_LEAVE(id) NEO::PerfTracer::traceEvent(NEO::PerfTraceEventType::system, NEO::PerfTracePhase::leave, __FUNCTION__, static_cast<uint32_t>(id));
+#define WAIT_ENTER() NEO::PerfTracer::traceEvent(NEO::PerfTraceEventType::wait, NEO::PerfTracePhase::enter, __FUNCTION__, 0u);
+#define WAIT_LEAVE() NEO::PerfTracer::traceEvent(NEO::PerfTraceEventType::wait, NEO::PerfTracePhase::leave, __FUNCTION__, 0u);
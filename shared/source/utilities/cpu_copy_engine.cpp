@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy_engine.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
+namespace NEO {
+
+CpuCopyEngine::CpuCopyEngine() {
+    workersCount = std::min(defaultMaxWorkersCount, std::thread::hardware_concurrency() / 2);
+    if (debugManager.flags.CpuCopyEngineWorkersCount.get() != -1) {
+        workersCount = static_cast<uint32_t>(debugManager.flags.CpuCopyEngineWorkersCount.get());
+    }
+    if (debugManager.flags.CpuCopyEngineMinChunkSize.get() > 0) {
+        minChunkSize = static_cast<size_t>(debugManager.flags.CpuCopyEngineMinChunkSize.get());
+    }
+    if (debugManager.flags.CpuCopyEngineAdaptiveThresholds.get() != -1) {
+        adaptiveThresholds = debugManager.flags.CpuCopyEngineAdaptiveThresholds.get() == 1;
+    }
+    nonTemporalStoresMode = debugManager.flags.CpuCopyEngineNonTemporalStores.get();
+}
+
+CpuCopyEngine::~CpuCopyEngine() {
+    UNRECOVERABLE_IF(!this->workerThreads.empty());
+}
+
+bool CpuCopyEngine::isSupported() {
+    return false;
+}
+
+void CpuCopyEngine::startThreads() {
+    for (auto i = 0u; i < workersCount; i++) {
+        this->workerThreads.push_back(Thread::createFunc(runWorker, reinterpret_cast<void *>(this)));
+    }
+}
+
+void CpuCopyEngine::stopThreads() {
+    {
+        std::lock_guard<std::mutex> lock(this->jobMutex);
+        keepRunning = false;
+    }
+    jobCondVar.notify_all();
+    for (auto &workerThread : workerThreads) {
+        workerThread->join();
+    }
+    workerThreads.clear();
+}
+
+void *CpuCopyEngine::runWorker(void *self) {
+    auto engine = reinterpret_cast<CpuCopyEngine *>(self);
+    uint64_t seenGeneration = 0u;
+    std::unique_lock<std::mutex> lock(engine->jobMutex);
+    while (true) {
+        engine->jobCondVar.wait(lock, [&]() {
+            return !engine->keepRunning || (engine->currentJob != nullptr && engine->jobGeneration != seenGeneration);
+        });
+        if (!engine->keepRunning) {
+            return nullptr;
+        }
+        seenGeneration = engine->jobGeneration;
+        auto job = engine->currentJob;
+        job->attachedWorkers++;
+
+        lock.unlock();
+        copyChunks(*job);
+        lock.lock();
+
+        // submitter waits for all attached workers before releasing the job
+        if (--job->attachedWorkers == 0u) {
+            engine->jobDoneCondVar.notify_one();
+        }
+    }
+}
+
+void CpuCopyEngine::copyChunks(CopyJob &job) {
+    for (auto chunk = job.nextChunk++; chunk < job.chunksCount; chunk = job.nextChunk++) {
+        auto offset = chunk * job.chunkSize;
+        copyRange(job.dst + offset, job.src + offset, std::min(job.chunkSize, job.size - offset), job.nonTemporal);
+    }
+}
+
+void CpuCopyEngine::copyRange(void *dst, const void *src, size_t size, bool nonTemporal) {
+    if (nonTemporal) {
+        copyNonTemporal(dst, src, size);
+    } else {
+        memcpy_s(dst, size, src, size);
+    }
+}
+
+void CpuCopyEngine::copyNonTemporal(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto headSize = std::min(size, ptrDiff(alignUp(dstBytes, sizeof(__m128i)), dstBytes));
+    memcpy_s(dstBytes, headSize, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    constexpr size_t blockSize = 4 * sizeof(__m128i);
+    for (; size >= blockSize; size -= blockSize, dstBytes += blockSize, srcBytes += blockSize) {
+        auto src128 = reinterpret_cast<const __m128i *>(srcBytes);
+        auto dst128 = reinterpret_cast<__m128i *>(dstBytes);
+        auto value0 = _mm_loadu_si128(src128);
+        auto value1 = _mm_loadu_si128(src128 + 1);
+        auto value2 = _mm_loadu_si128(src128 + 2);
+        auto value3 = _mm_loadu_si128(src128 + 3);
+        _mm_stream_si128(dst128, value0);
+        _mm_stream_si128(dst128 + 1, value1);
+        _mm_stream_si128(dst128 + 2, value2);
+        _mm_stream_si128(dst128 + 3, value3);
+    }
+    for (; size >= sizeof(__m128i); size -= sizeof(__m128i), dstBytes += sizeof(__m128i), srcBytes += sizeof(__m128i)) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes), _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes)));
+    }
+    memcpy_s(dstBytes, size, srcBytes, size);
+
+    // streaming stores are weakly ordered, make them visible before the copy is reported as done
+    _mm_sfence();
+}
+
+bool CpuCopyEngine::useNonTemporalStores(bool writeCombinedDst) const {
+    if (nonTemporalStoresMode != -1) {
+        return nonTemporalStoresMode == 1;
+    }
+    return writeCombinedDst;
+}
+
+bool CpuCopyEngine::copyParallel(void *dst, const void *src, size_t size, bool nonTemporal) {
+    // another copy owns the workers, it is cheaper to copy on this thread than to wait
+    std::unique_lock<std::mutex> submissionLock(submissionMutex, std::try_to_lock);
+    if (!submissionLock.owns_lock()) {
+        return false;
+    }
+
+    const size_t participantsCount = workersCount + 1u;
+    CopyJob job;
+    job.dst = static_cast<uint8_t *>(dst);
+    job.src = static_cast<const uint8_t *>(src);
+    job.size = size;
+    job.nonTemporal = nonTemporal;
+    // a few chunks per participant to balance uneven progress of threads
+    job.chunkSize = std::max(minChunkSize, alignUp(Math::divideAndRoundUp(size, 4 * participantsCount), MemoryConstants::pageSize));
+    job.chunksCount = Math::divideAndRoundUp(size, job.chunkSize);
+
+    {
+        std::lock_guard<std::mutex> lock(this->jobMutex);
+        currentJob = &job;
+        jobGeneration++;
+    }
+    jobCondVar.notify_all();
+
+    copyChunks(job);
+
+    std::unique_lock<std::mutex> lock(this->jobMutex);
+    currentJob = nullptr;
+    jobDoneCondVar.wait(lock, [&job]() { return job.attachedWorkers == 0u; });
+    return true;
+}
+
+void CpuCopyEngine::copy(void *dst, const void *src, size_t size, bool writeCombinedDst) {
+    const auto nonTemporal = useNonTemporalStores(writeCombinedDst);
+    auto &stats = bandwidthStats[writeCombinedDst ? 1 : 0];
+
+    // serial and parallel bandwidth are compared, so both are measured on the same range of sizes only
+    const bool splittable = !workerThreads.empty() && (size >= 2 * minChunkSize);
+    const bool measured = adaptiveThresholds && splittable;
+    const bool serialSample = measured && (stats.measuredCopiesCount.fetch_add(1u, std::memory_order_relaxed) % serialSampleInterval == 0u);
+    const auto start = std::chrono::steady_clock::now();
+
+    bool parallel = splittable && !serialSample && copyParallel(dst, src, size, nonTemporal);
+    if (!parallel) {
+        copyRange(dst, src, size, nonTemporal);
+    }
+
+    // serial fallback under contention with another copy is not representative and is not sampled
+    if (measured && (parallel || serialSample)) {
+        auto durationUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        updateBandwidth(parallel ? stats.parallelBytesPerUs : stats.serialBytesPerUs, size, durationUs);
+    }
+}
+
+void CpuCopyEngine::updateBandwidth(std::atomic<uint64_t> &bytesPerUs, size_t size, uint64_t durationUs) {
+    auto sample = static_cast<uint64_t>(size) / std::max(durationUs, static_cast<uint64_t>(1u));
+    auto current = bytesPerUs.load(std::memory_order_relaxed);
+    // exponential moving average, concurrent updates may drop a sample
+    bytesPerUs.store(current == 0u ? sample : (current * 7u + sample) / 8u, std::memory_order_relaxed);
+}
+
+size_t CpuCopyEngine::scaleTransferThreshold(size_t threshold, bool writeCombinedDst) const {
+    if (!adaptiveThresholds || workerThreads.empty()) {
+        return threshold;
+    }
+    // Break-even size against GPU copy grows with CPU bandwidth, so threshold tuned for serial memcpy
+    // is scaled by speedup measured for parallel copies of the same destination kind.
+    const auto &stats = bandwidthStats[writeCombinedDst ? 1 : 0];
+    auto serialBytesPerUs = stats.serialBytesPerUs.load(std::memory_order_relaxed);
+    auto parallelBytesPerUs = stats.parallelBytesPerUs.load(std::memory_order_relaxed);
+    if (serialBytesPerUs == 0u || parallelBytesPerUs <= serialBytesPerUs) {
+        return threshold;
+    }
+    auto scaledThreshold = static_cast<size_t>(static_cast<double>(threshold) * parallelBytesPerUs / serialBytesPerUs);
+    return std::min(scaledThreshold, threshold * maxThresholdScale);
+}
+
+} // namespace NEO
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Copies large ranges (e.g. through locked device pointers) on the calling thread and a small pool of workers.
+// Write combined destinations are filled with non-temporal stores, so no cache lines are read for ownership.
+// Achieved bandwidth of serial and parallel copies is tracked per destination kind and used to scale
+// size thresholds, below which CPU copy is preferred over a GPU submission. Both are sampled only from
+// copies large enough to be split, every few of them is copied serially to keep serial bandwidth current.
+class CpuCopyEngine : public NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t defaultMaxWorkersCount = 3u;
+    static constexpr size_t defaultMinChunkSize = MemoryConstants::megaByte;
+    static constexpr uint32_t serialSampleInterval = 8u;
+    static constexpr size_t maxThresholdScale = 16u;
+
+    CpuCopyEngine();
+    virtual ~CpuCopyEngine();
+
+    MOCKABLE_VIRTUAL void startThreads();
+    void stopThreads();
+
+    static bool isSupported();
+
+    void copy(void *dst, const void *src, size_t size, bool writeCombinedDst);
+    size_t scaleTransferThreshold(size_t threshold, bool writeCombinedDst) const;
+
+    static void copyNonTemporal(void *dst, const void *src, size_t size);
+
+    uint32_t getWorkersCount() const { return workersCount; }
+    size_t getMinChunkSize() const { return minChunkSize; }
+
+  protected:
+    struct CopyJob {
+        uint8_t *dst = nullptr;
+        const uint8_t *src = nullptr;
+        size_t size = 0u;
+        size_t chunkSize = 0u;
+        size_t chunksCount = 0u;
+        bool nonTemporal = false;
+        std::atomic<size_t> nextChunk{0u};
+        uint32_t attachedWorkers = 0u;
+    };
+
+    struct BandwidthStats {
+        std::atomic<uint64_t> serialBytesPerUs{0u};
+        std::atomic<uint64_t> parallelBytesPerUs{0u};
+        std::atomic<uint32_t> measuredCopiesCount{0u};
+    };
+
+    static void *runWorker(void *self);
+    static void copyChunks(CopyJob &job);
+    static void copyRange(void *dst, const void *src, size_t size, bool nonTemporal);
+    static void updateBandwidth(std::atomic<uint64_t> &bytesPerUs, size_t size, uint64_t durationUs);
+
+    bool useNonTemporalStores(bool writeCombinedDst) const;
+    bool copyParallel(void *dst, const void *src, size_t size, bool nonTemporal);
+
+    std::vector<std::unique_ptr<Thread>> workerThreads;
+    std::mutex submissionMutex;
+    std::mutex jobMutex;
+    std::condition_variable jobCondVar;
+    std::condition_variable jobDoneCondVar;
+    CopyJob *currentJob = nullptr;
+    uint64_t jobGeneration = 0u;
+    bool keepRunning = true;
+
+    BandwidthStats bandwidthStats[2];
+    size_t minChunkSize = defaultMinChunkSize;
+    uint32_t workersCount = 0u;
+    int32_t nonTemporalStoresMode = -1;
+    bool adaptiveThresholds = false;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@ struct CpuInfo {
     static const uint64_t featureWaitPkg = 0x000000001ULL;
     static const uint64_t featureAvX2 = 0x000800000ULL;
     static const uint64_t featureNeon = 0x001000000ULL;
+    static const uint64_t featureAvX512 = 0x002000000ULL;
     static const uint64_t featureClflush = 0x2000000000ULL;
 
     CpuInfo() : features(featureNone) {
@@ -68,6 +69,7 @@ struct CpuInfo {
     static void (*cpuidexFunc)(int *, int, int);
     static void (*cpuidFunc)(int *, int);
     static void (*getCpuFlagsFunc)(std::string &);
+    static uint64_t (*xgetbvFunc)(uint32_t);
 
   protected:
     mutable uint64_t features;
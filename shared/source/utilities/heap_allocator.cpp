@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/utilities/heap_allocator.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/utilities/logger.h"
 
@@ -18,6 +19,17 @@ bool operator<(const HeapChunk &hc1, const HeapChunk &hc2) {
     return hc1.ptr < hc2.ptr;
 }
 
+HeapAllocator::HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : baseAddress(address), size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
+    pLeftBound = address;
+    pRightBound = address + size;
+    if (debugManager.flags.EnableHeapAllocatorSegregatedFreeChunks.get() == 1) {
+        segregatedFreeChunks = std::make_unique<SegregatedFreeChunks>();
+    } else {
+        freedChunksBig.reserve(10);
+        freedChunksSmall.reserve(50);
+    }
+}
+
 uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment) {
     if (alignment < this->allocationAlignment) {
         alignment = this->allocationAlignment;
@@ -42,7 +54,7 @@ uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size
             const uint64_t misalignment = alignUp(pLeftBound, alignment) - pLeftBound;
             if (pLeftBound + misalignment + sizeToAllocate <= pRightBound) {
                 if (misalignment) {
-                    storeInFreedChunks(pLeftBound, static_cast<size_t>(misalignment), freedChunks);
+                    storeMisalignedChunk(pLeftBound, static_cast<size_t>(misalignment), freedChunks);
                     pLeftBound += misalignment;
                 }
                 ptrReturn = pLeftBound;
@@ -54,7 +66,7 @@ uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size
             if (pLeftBound + sizeToAllocate + misalignment <= pRightBound) {
                 if (misalignment) {
                     pRightBound -= misalignment;
-                    storeInFreedChunks(pRightBound, static_cast<size_t>(misalignment), freedChunks);
+                    storeMisalignedChunk(pRightBound, static_cast<size_t>(misalignment), freedChunks);
                 }
                 pRightBound -= sizeToAllocate;
                 ptrReturn = pRightBound;
@@ -63,7 +75,11 @@ uint64_t HeapAllocator::allocateWithCustomAlignment(size_t &sizeToAllocate, size
 
         size_t sizeOfFreedChunk = 0;
         if (ptrReturn == 0llu) {
-            ptrReturn = getFromFreedChunks(sizeToAllocate, freedChunks, sizeOfFreedChunk, alignment);
+            if (segregatedFreeChunks) {
+                ptrReturn = segregatedFreeChunks->allocate(sizeToAllocate, alignment);
+            } else {
+                ptrReturn = getFromFreedChunks(sizeToAllocate, freedChunks, sizeOfFreedChunk, alignment);
+            }
         }
 
         if (ptrReturn != 0llu) {
@@ -95,7 +111,9 @@ void HeapAllocator::free(uint64_t ptr, size_t size) {
     std::lock_guard<std::mutex> lock(mtx);
     DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
 
-    if (ptr == pRightBound) {
+    if (segregatedFreeChunks) {
+        freeToSegregatedFreeChunks(ptr, size);
+    } else if (ptr == pRightBound) {
         pRightBound = ptr + size;
         mergeLastFreedSmall();
     } else if (ptr == pLeftBound - size) {
@@ -172,7 +190,23 @@ uint64_t HeapAllocator::getFromFreedChunks(size_t size, std::vector<HeapChunk> &
     return 0llu;
 }
 
+void HeapAllocator::freeToSegregatedFreeChunks(uint64_t ptr, size_t size) {
+    if (ptr == pRightBound) {
+        pRightBound = ptr + size;
+        pRightBound += segregatedFreeChunks->extractStartingAt(pRightBound);
+    } else if (ptr == pLeftBound - size) {
+        pLeftBound = ptr;
+        pLeftBound -= segregatedFreeChunks->extractEndingAt(pLeftBound);
+    } else {
+        segregatedFreeChunks->insert(ptr, size);
+    }
+}
+
 void HeapAllocator::defragment() {
+    if (segregatedFreeChunks) {
+        // segregated free chunks are coalesced on every free
+        return;
+    }
 
     if (freedChunksSmall.size() > 1) {
         std::sort(freedChunksSmall.rbegin(), freedChunksSmall.rend());
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,8 +8,10 @@
 #pragma once
 
 #include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/segregated_free_chunks.h"
 
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -31,12 +33,7 @@ class HeapAllocator {
     HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment) : HeapAllocator(address, size, allocationAlignment, 4 * MemoryConstants::megaByte) {
     }
 
-    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : baseAddress(address), size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
-        pLeftBound = address;
-        pRightBound = address + size;
-        freedChunksBig.reserve(10);
-        freedChunksSmall.reserve(50);
-    }
+    HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold);
 
     MOCKABLE_VIRTUAL ~HeapAllocator() = default;
 
@@ -62,6 +59,10 @@ class HeapAllocator {
         return this->baseAddress;
     }
 
+    bool usesSegregatedFreeChunks() const {
+        return nullptr != segregatedFreeChunks;
+    }
+
   protected:
     const uint64_t baseAddress;
     const uint64_t size;
@@ -73,6 +74,7 @@ class HeapAllocator {
 
     std::vector<HeapChunk> freedChunksSmall;
     std::vector<HeapChunk> freedChunksBig;
+    std::unique_ptr<SegregatedFreeChunks> segregatedFreeChunks;
     std::mutex mtx;
 
     uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment);
@@ -93,6 +95,14 @@ class HeapAllocator {
         freedChunks.emplace_back(ptr, size);
     }
 
+    void storeMisalignedChunk(uint64_t ptr, size_t size, std::vector<HeapChunk> &freedChunks) {
+        if (segregatedFreeChunks) {
+            segregatedFreeChunks->insert(ptr, size);
+        } else {
+            storeInFreedChunks(ptr, size, freedChunks);
+        }
+    }
+
     void mergeLastFreedSmall() {
         size_t maxSizeOfSmallChunks = freedChunksSmall.size();
 
@@ -119,6 +129,7 @@ class HeapAllocator {
         }
     }
 
+    void freeToSegregatedFreeChunks(uint64_t ptr, size_t size);
     void defragment();
 };
 } // namespace NEO
@@ -219,6 +219,10 @@ class IDList {
         return processLocked<ThisType, &ThisType::detachNodesImpl>();
     }
 
+    NodeObjectType *detachFrontNodes(size_t count) {
+        return processLocked<ThisType, &ThisType::detachFrontNodesImpl>(nullptr, &count);
+    }
+
     void splice(NodeObjectType &nodes) {
         processLocked<ThisType, &ThisType::spliceImpl>(&nodes);
     }
@@ -417,6 +421,19 @@ class IDList {
         return rest;
     }
 
+    NodeObjectType *detachFrontNodesImpl(NodeObjectType *, void *data) {
+        auto count = *static_cast<size_t *>(data);
+        if (head == nullptr || count == 0u) {
+            return nullptr;
+        }
+
+        NodeObjectType *last = head;
+        while (--count > 0u && last->next != nullptr) {
+            last = last->next;
+        }
+        return detachSequenceImpl(head, last);
+    }
+
     NodeObjectType *spliceImpl(NodeObjectType *node, void *) {
         if (tail == nullptr) {
             DEBUG_BREAK_IF(head != nullptr);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,10 @@ void cpuidLinuxWrapper(int cpuInfo[4], int functionId) {
 void cpuidexLinuxWrapper(int *cpuInfo, int functionId, int subfunctionId) {
 }
 
+uint64_t xgetbvLinuxWrapper(uint32_t xcr) {
+    return 0u;
+}
+
 void getCpuFlagsLinux(std::string &cpuFlags) {
     std::ifstream cpuinfo(std::string(Os::sysFsProcPathPrefix) + "/cpuinfo");
     std::string line;
@@ -36,6 +40,7 @@ void getCpuFlagsLinux(std::string &cpuFlags) {
 void (*CpuInfo::cpuidexFunc)(int *, int, int) = cpuidexLinuxWrapper;
 void (*CpuInfo::cpuidFunc)(int[4], int) = cpuidLinuxWrapper;
 void (*CpuInfo::getCpuFlagsFunc)(std::string &) = getCpuFlagsLinux;
+uint64_t (*CpuInfo::xgetbvFunc)(uint32_t) = xgetbvLinuxWrapper;
 
 const CpuInfo CpuInfo::instance;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,15 @@ void cpuidexLinuxWrapper(int *cpuInfo, int functionId, int subfunctionId) {
     __cpuid_count(functionId, subfunctionId, cpuInfo[0], cpuInfo[1], cpuInfo[2], cpuInfo[3]);
 }
 
+uint64_t xgetbvLinuxWrapper(uint32_t xcr) {
+    uint32_t eax = 0;
+    uint32_t edx = 0;
+    __asm__ volatile("xgetbv"
+                     : "=a"(eax), "=d"(edx)
+                     : "c"(xcr));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+}
+
 void getCpuFlagsLinux(std::string &cpuFlags) {
     std::ifstream cpuinfo(std::string(Os::sysFsProcPathPrefix) + "/cpuinfo");
     std::string line;
@@ -36,6 +45,7 @@ void getCpuFlagsLinux(std::string &cpuFlags) {
 void (*CpuInfo::cpuidexFunc)(int *, int, int) = cpuidexLinuxWrapper;
 void (*CpuInfo::cpuidFunc)(int[4], int) = cpuidLinuxWrapper;
 void (*CpuInfo::getCpuFlagsFunc)(std::string &) = getCpuFlagsLinux;
+uint64_t (*CpuInfo::xgetbvFunc)(uint32_t) = xgetbvLinuxWrapper;
 
 const CpuInfo CpuInfo::instance;
 
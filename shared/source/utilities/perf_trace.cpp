@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/perf_trace.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace NEO {
+
+namespace {
+struct ThreadBufferEntry {
+    ~ThreadBufferEntry() {
+        if (buffer) {
+            buffer->markOwnerExited();
+        }
+    }
+    uint64_t tracerId = 0u;
+    std::shared_ptr<PerfTraceRingBuffer> buffer;
+};
+thread_local ThreadBufferEntry threadBufferEntry;
+} // namespace
+
+PerfTraceRingBuffer::PerfTraceRingBuffer(size_t capacity, uint32_t threadIndex)
+    : capacityMask(static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(std::max(capacity, static_cast<size_t>(2u))))) - 1), threadIndex(threadIndex) {
+    records = std::make_unique<PerfTraceRecord[]>(capacityMask + 1);
+}
+
+bool PerfTraceRingBuffer::push(const PerfTraceRecord &record) {
+    auto write = writeIndex.load(std::memory_order_relaxed);
+    if (write - readIndex.load(std::memory_order_acquire) > capacityMask) {
+        droppedCount.fetch_add(1u, std::memory_order_relaxed);
+        return false;
+    }
+    records[write & capacityMask] = record;
+    writeIndex.store(write + 1, std::memory_order_release);
+    return true;
+}
+
+size_t PerfTraceRingBuffer::pop(PerfTraceRecord *outRecords, size_t maxCount) {
+    auto read = readIndex.load(std::memory_order_relaxed);
+    auto available = static_cast<size_t>(writeIndex.load(std::memory_order_acquire) - read);
+    auto count = std::min(available, maxCount);
+    for (size_t i = 0; i < count; i++) {
+        outRecords[i] = records[(read + i) & capacityMask];
+    }
+    readIndex.store(read + count, std::memory_order_release);
+    return count;
+}
+
+std::atomic<PerfTracer *> PerfTracer::activeTracer{nullptr};
+std::mutex PerfTracer::activeTracerMutex;
+uint32_t PerfTracer::activeTracerRefCount = 0u;
+std::atomic<uint64_t> PerfTracer::lastTracerId{0u};
+std::vector<std::unique_ptr<PerfTracer>> PerfTracer::retiredTracers;
+
+PerfTracer::PerfTracer(std::unique_ptr<std::ostream> &&output, size_t bufferCapacity)
+    : output(std::move(output)), tracerId(++lastTracerId), bufferCapacity(bufferCapacity) {
+    FileHeader header = {};
+    memcpy(header.magic, fileMagic, sizeof(header.magic));
+    header.version = fileVersion;
+    this->output->write(reinterpret_cast<const char *>(&header), sizeof(header));
+    writeCalibration();
+}
+
+PerfTracer::~PerfTracer() {
+    UNRECOVERABLE_IF(flushThread);
+    if (!isClosed()) {
+        flush();
+    }
+    releaseCurrentThreadBuffer();
+}
+
+void PerfTracer::releaseCurrentThreadBuffer() {
+    if (threadBufferEntry.tracerId == this->tracerId) {
+        threadBufferEntry.buffer.reset();
+    }
+}
+
+void PerfTracer::acquire() {
+    std::lock_guard<std::mutex> lock(activeTracerMutex);
+    if (activeTracerRefCount++ > 0u) {
+        return;
+    }
+    const auto &fileName = debugManager.flags.PerfTraceFile.get();
+    if (fileName == "unk") {
+        return;
+    }
+    auto file = std::make_unique<std::ofstream>(fileName, std::ios::binary | std::ios::trunc);
+    if (!file->good()) {
+        return;
+    }
+    size_t bufferCapacity = defaultBufferCapacity;
+    if (debugManager.flags.PerfTraceBufferSize.get() != -1) {
+        bufferCapacity = static_cast<size_t>(debugManager.flags.PerfTraceBufferSize.get());
+    }
+    auto tracer = new PerfTracer(std::move(file), bufferCapacity);
+    tracer->startThread();
+    activeTracer.store(tracer, std::memory_order_release);
+}
+
+void PerfTracer::release() {
+    std::lock_guard<std::mutex> lock(activeTracerMutex);
+    DEBUG_BREAK_IF(activeTracerRefCount == 0u);
+    if (--activeTracerRefCount > 0u) {
+        return;
+    }
+    auto tracer = activeTracer.exchange(nullptr);
+    if (tracer) {
+        tracer->close();
+        // threads which loaded the tracer before it was deactivated may still call into it, so it is kept until process teardown
+        retiredTracers.emplace_back(tracer);
+    }
+}
+
+void PerfTracer::startThread() {
+    this->flushThread = Thread::createFunc(flushRecords, reinterpret_cast<void *>(this));
+}
+
+void PerfTracer::stopThread() {
+    {
+        std::lock_guard<std::mutex> lock(this->flushThreadMutex);
+        keepRunning = false;
+    }
+    condVar.notify_one();
+    if (flushThread) {
+        flushThread->join();
+        flushThread.reset();
+    }
+}
+
+void *PerfTracer::flushRecords(void *self) {
+    auto tracer = reinterpret_cast<PerfTracer *>(self);
+    std::unique_lock<std::mutex> lock(tracer->flushThreadMutex);
+    while (tracer->keepRunning) {
+        tracer->condVar.wait_for(lock, flushInterval, [&]() { return !tracer->keepRunning; });
+        lock.unlock();
+        tracer->flush();
+        lock.lock();
+    }
+    return nullptr;
+}
+
+PerfTraceRingBuffer *PerfTracer::getThreadBuffer() {
+    if (threadBufferEntry.tracerId != this->tracerId) {
+        if (threadBufferEntry.buffer) {
+            threadBufferEntry.buffer->markOwnerExited();
+            threadBufferEntry.buffer.reset();
+        }
+        std::lock_guard<std::mutex> lock(this->threadBuffersMutex);
+        threadBufferEntry.tracerId = this->tracerId;
+        if (isClosed()) {
+            return nullptr;
+        }
+        threadBufferEntry.buffer = std::make_shared<PerfTraceRingBuffer>(bufferCapacity, nextThreadIndex++);
+        threadBuffers.push_back(threadBufferEntry.buffer);
+    }
+    return threadBufferEntry.buffer.get();
+}
+
+void PerfTracer::record(PerfTraceEventType type, PerfTracePhase phase, const char *name, uint32_t payload) {
+    if (isClosed()) {
+        return;
+    }
+    if (auto buffer = getThreadBuffer()) {
+        buffer->push({CpuIntrinsics::rdtsc(), name, payload, type, phase});
+    }
+}
+
+uint32_t PerfTracer::getNameId(const char *name) {
+    auto it = nameIds.find(name);
+    if (it != nameIds.end()) {
+        return it->second;
+    }
+    auto nameId = static_cast<uint32_t>(nameIds.size());
+    nameIds.emplace(name, nameId);
+
+    uint32_t header[3] = {static_cast<uint32_t>(ChunkType::name), nameId, static_cast<uint32_t>(strlen(name))};
+    output->write(reinterpret_cast<const char *>(header), sizeof(header));
+    output->write(name, header[2]);
+    return nameId;
+}
+
+void PerfTracer::writeCalibration() {
+    uint32_t chunkType = static_cast<uint32_t>(ChunkType::calibration);
+    uint64_t calibration[2] = {CpuIntrinsics::rdtsc(),
+                               static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count())};
+    output->write(reinterpret_cast<const char *>(&chunkType), sizeof(chunkType));
+    output->write(reinterpret_cast<const char *>(calibration), sizeof(calibration));
+}
+
+void PerfTracer::writeDroppedRecords(const PerfTraceRingBuffer &buffer) {
+    // count is cumulative for the thread, so only the last chunk of each thread matters
+    uint32_t header[2] = {static_cast<uint32_t>(ChunkType::droppedRecords), buffer.getThreadIndex()};
+    uint64_t droppedCount = buffer.getWrittenDroppedCount();
+    output->write(reinterpret_cast<const char *>(header), sizeof(header));
+    output->write(reinterpret_cast<const char *>(&droppedCount), sizeof(droppedCount));
+}
+
+void PerfTracer::writeFooter() {
+    uint32_t chunkType = static_cast<uint32_t>(ChunkType::footer);
+    output->write(reinterpret_cast<const char *>(&chunkType), sizeof(chunkType));
+    output->write(reinterpret_cast<const char *>(&writtenDroppedRecordsCount), sizeof(writtenDroppedRecordsCount));
+}
+
+void PerfTracer::flush() {
+    std::lock_guard<std::mutex> lock(this->outputMutex);
+    if (!output) {
+        return;
+    }
+
+    std::vector<std::shared_ptr<PerfTraceRingBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> buffersLock(this->threadBuffersMutex);
+        buffers = threadBuffers;
+    }
+
+    std::vector<PerfTraceRingBuffer *> exitedBuffers;
+    for (auto &buffer : buffers) {
+        // checked before draining, so everything pushed before the owning thread exited is written
+        if (buffer->hasOwnerExited()) {
+            exitedBuffers.push_back(buffer.get());
+        }
+        drainedRecords.resize(buffer->getCapacity());
+        size_t count = 0u;
+        while ((count = buffer->pop(drainedRecords.data(), drainedRecords.size())) > 0u) {
+            fileRecords.clear();
+            for (size_t i = 0; i < count; i++) {
+                auto &record = drainedRecords[i];
+                fileRecords.push_back({record.timestamp, getNameId(record.name), buffer->getThreadIndex(), record.payload,
+                                       static_cast<uint16_t>(record.type), static_cast<uint16_t>(record.phase)});
+            }
+            uint32_t header[2] = {static_cast<uint32_t>(ChunkType::records), static_cast<uint32_t>(count)};
+            output->write(reinterpret_cast<const char *>(header), sizeof(header));
+            output->write(reinterpret_cast<const char *>(fileRecords.data()), count * sizeof(FileRecord));
+        }
+
+        auto droppedCount = buffer->getDroppedCount();
+        if (droppedCount != buffer->getWrittenDroppedCount()) {
+            writtenDroppedRecordsCount += droppedCount - buffer->getWrittenDroppedCount();
+            buffer->setWrittenDroppedCount(droppedCount);
+            writeDroppedRecords(*buffer);
+        }
+    }
+    writeCalibration();
+    output->flush();
+
+    if (!exitedBuffers.empty()) {
+        std::lock_guard<std::mutex> buffersLock(this->threadBuffersMutex);
+        threadBuffers.erase(std::remove_if(threadBuffers.begin(), threadBuffers.end(), [&](const auto &buffer) {
+                                return std::find(exitedBuffers.begin(), exitedBuffers.end(), buffer.get()) != exitedBuffers.end();
+                            }),
+                            threadBuffers.end());
+    }
+}
+
+void PerfTracer::close() {
+    stopThread();
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(this->threadBuffersMutex);
+        closed.store(true, std::memory_order_release);
+        // buffers of threads still alive are freed when they exit
+        threadBuffers.clear();
+    }
+    releaseCurrentThreadBuffer();
+    std::lock_guard<std::mutex> lock(this->outputMutex);
+    if (output) {
+        writeFooter();
+        output->flush();
+    }
+    output.reset();
+    nameIds.clear();
+    drainedRecords = {};
+    fileRecords = {};
+}
+
+size_t PerfTracer::getThreadBuffersCount() {
+    std::lock_guard<std::mutex> lock(this->threadBuffersMutex);
+    return threadBuffers.size();
+}
+
+uint64_t PerfTracer::getDroppedRecordsCount() {
+    std::lock_guard<std::mutex> lock(this->threadBuffersMutex);
+    uint64_t droppedRecords = 0u;
+    for (auto &buffer : threadBuffers) {
+        droppedRecords += buffer->getDroppedCount();
+    }
+    return droppedRecords;
+}
+
+} // namespace NEO
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+enum class PerfTraceEventType : uint16_t {
+    api = 0,
+    system,
+    wait,
+    flush
+};
+
+enum class PerfTracePhase : uint16_t {
+    enter = 0,
+    leave
+};
+
+struct PerfTraceRecord {
+    uint64_t timestamp;
+    const char *name;
+    uint32_t payload;
+    PerfTraceEventType type;
+    PerfTracePhase phase;
+};
+
+// Ring of trace records with a single producer (the owning thread) and a single consumer (the flush thread).
+// Records pushed while the ring is full are dropped and counted. The ring is shared by the owning thread and the tracer
+// and is freed once both have dropped it: the tracer drops it on the first flush after the owning thread exits.
+class PerfTraceRingBuffer : public NonCopyableOrMovableClass {
+  public:
+    PerfTraceRingBuffer(size_t capacity, uint32_t threadIndex);
+
+    bool push(const PerfTraceRecord &record);
+    size_t pop(PerfTraceRecord *outRecords, size_t maxCount);
+
+    size_t getCapacity() const { return capacityMask + 1; }
+    uint32_t getThreadIndex() const { return threadIndex; }
+    uint64_t getDroppedCount() const { return droppedCount.load(std::memory_order_relaxed); }
+    uint64_t getWrittenDroppedCount() const { return writtenDroppedCount; }
+    void setWrittenDroppedCount(uint64_t count) { writtenDroppedCount = count; }
+    void markOwnerExited() { ownerExited.store(true, std::memory_order_release); }
+    bool hasOwnerExited() const { return ownerExited.load(std::memory_order_acquire); }
+
+  protected:
+    std::unique_ptr<PerfTraceRecord[]> records;
+    const size_t capacityMask;
+    const uint32_t threadIndex;
+    alignas(64) std::atomic<uint64_t> writeIndex{0u};
+    alignas(64) std::atomic<uint64_t> readIndex{0u};
+    std::atomic<uint64_t> droppedCount{0u};
+    uint64_t writtenDroppedCount = 0u; // dropped count already written to trace, used by the flushing thread only
+    std::atomic<bool> ownerExited{false};
+};
+
+// Low overhead tracing backend. Threads append binary records with rdtsc timestamps to their own ring buffers,
+// a background thread drains them into a compact binary file (see scripts/perf_trace_to_chrome.py for conversion).
+// Records dropped on full buffers are reported per thread on flush and in total in the footer written on close.
+class PerfTracer : public NonCopyableOrMovableClass {
+  public:
+    enum class ChunkType : uint32_t {
+        name = 1,
+        calibration = 2,
+        records = 3,
+        droppedRecords = 4,
+        footer = 5
+    };
+
+    struct FileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t reserved;
+    };
+
+    struct FileRecord {
+        uint64_t timestamp;
+        uint32_t nameId;
+        uint32_t threadIndex;
+        uint32_t payload;
+        uint16_t type;
+        uint16_t phase;
+    };
+    static_assert(sizeof(FileRecord) == 24u);
+
+    static constexpr char fileMagic[8] = {'N', 'E', 'O', 'T', 'R', 'A', 'C', 'E'};
+    static constexpr uint32_t fileVersion = 2u;
+    static constexpr size_t defaultBufferCapacity = 64 * 1024;
+    static constexpr std::chrono::milliseconds flushInterval{100};
+
+    PerfTracer(std::unique_ptr<std::ostream> &&output, size_t bufferCapacity);
+    virtual ~PerfTracer();
+
+    static void acquire();
+    static void release();
+    static PerfTracer *getActive() { return activeTracer.load(std::memory_order_acquire); }
+
+    static void traceEvent(PerfTraceEventType type, PerfTracePhase phase, const char *name, uint32_t payload) {
+        auto tracer = getActive();
+        if (tracer) {
+            tracer->record(type, phase, name, payload);
+        }
+    }
+
+    void record(PerfTraceEventType type, PerfTracePhase phase, const char *name, uint32_t payload);
+    MOCKABLE_VIRTUAL void startThread();
+    void stopThread();
+    void flush();
+    // Stops the flush thread, writes remaining records and releases the output and all thread buffers.
+    // Records traced afterwards are ignored.
+    void close();
+    bool isClosed() const { return closed.load(std::memory_order_acquire); }
+
+    size_t getThreadBuffersCount();
+    uint64_t getDroppedRecordsCount();
+
+  protected:
+    static void *flushRecords(void *self);
+    PerfTraceRingBuffer *getThreadBuffer();
+    void releaseCurrentThreadBuffer();
+    uint32_t getNameId(const char *name);
+    void writeCalibration();
+    void writeDroppedRecords(const PerfTraceRingBuffer &buffer);
+    void writeFooter();
+
+    static std::atomic<PerfTracer *> activeTracer;
+    static std::mutex activeTracerMutex;
+    static uint32_t activeTracerRefCount;
+    static std::atomic<uint64_t> lastTracerId;
+    static std::vector<std::unique_ptr<PerfTracer>> retiredTracers;
+
+    std::unique_ptr<std::ostream> output;
+    std::unique_ptr<Thread> flushThread;
+    std::vector<std::shared_ptr<PerfTraceRingBuffer>> threadBuffers;
+    std::mutex threadBuffersMutex;
+    std::mutex outputMutex;
+    std::mutex flushThreadMutex;
+    std::condition_variable condVar;
+    std::unordered_map<const char *, uint32_t> nameIds;
+    std::vector<PerfTraceRecord> drainedRecords;
+    std::vector<FileRecord> fileRecords;
+    const uint64_t tracerId;
+    const size_t bufferCapacity;
+    uint64_t writtenDroppedRecordsCount = 0u;
+    uint32_t nextThreadIndex = 0u;
+    std::atomic<bool> closed{false};
+    bool keepRunning = true;
+};
+
+class PerfTraceScope : public NonCopyableOrMovableClass {
+  public:
+    PerfTraceScope(PerfTraceEventType type, const char *name) : name(name), type(type) {
+        PerfTracer::traceEvent(type, PerfTracePhase::enter, name, 0u);
+    }
+    ~PerfTraceScope() {
+        PerfTracer::traceEvent(type, PerfTracePhase::leave, name, 0u);
+    }
+
+  protected:
+    const char *name;
+    PerfTraceEventType type;
+};
+
+} // namespace NEO
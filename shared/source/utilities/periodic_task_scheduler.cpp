@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/periodic_task_scheduler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+PeriodicTaskScheduler::PeriodicTaskScheduler() {
+    if (debugManager.flags.PeriodicTaskSchedulerCoalescingWindowUs.get() != -1) {
+        coalescingWindow = std::chrono::microseconds(debugManager.flags.PeriodicTaskSchedulerCoalescingWindowUs.get());
+    }
+    if (debugManager.flags.PeriodicTaskSchedulerThreadsCount.get() > 0) {
+        threadsCount = static_cast<uint32_t>(debugManager.flags.PeriodicTaskSchedulerThreadsCount.get());
+    }
+    if (debugManager.flags.PeriodicTaskSchedulerCpuAffinityMask.get() > 0) {
+        cpuAffinityMask = static_cast<uint64_t>(debugManager.flags.PeriodicTaskSchedulerCpuAffinityMask.get());
+    }
+}
+
+PeriodicTaskScheduler::~PeriodicTaskScheduler() {
+    UNRECOVERABLE_IF(!schedulerThreads.empty());
+}
+
+void PeriodicTaskScheduler::startThread() {
+    for (uint32_t i = 0u; i < threadsCount; i++) {
+        auto schedulerThread = Thread::createFunc(runTasks, reinterpret_cast<void *>(this));
+        if (schedulerThread) {
+            schedulerThreads.push_back(std::move(schedulerThread));
+        }
+    }
+}
+
+void PeriodicTaskScheduler::stopThread() {
+    {
+        std::lock_guard<std::mutex> lock(this->tasksMutex);
+        keepRunning = false;
+    }
+    condVar.notify_all();
+    for (auto &schedulerThread : schedulerThreads) {
+        schedulerThread->join();
+    }
+    schedulerThreads.clear();
+}
+
+PeriodicTaskScheduler::TaskId PeriodicTaskScheduler::registerTask(std::function<void()> task, std::chrono::microseconds period) {
+    TaskId taskId = invalidTaskId;
+    {
+        std::lock_guard<std::mutex> lock(this->tasksMutex);
+        taskId = ++lastTaskId;
+        tasks.push_back({std::move(task), period, getNextRun(SteadyClock::now(), period), taskId});
+    }
+    condVar.notify_one();
+    return taskId;
+}
+
+void PeriodicTaskScheduler::unregisterTask(TaskId taskId) {
+    std::unique_lock<std::mutex> lock(this->tasksMutex);
+    taskFinishedCondVar.wait(lock, [&]() {
+        auto it = findTask(taskId);
+        return it == tasks.end() || !it->running;
+    });
+    auto it = findTask(taskId);
+    if (it != tasks.end()) {
+        tasks.erase(it);
+    }
+}
+
+void PeriodicTaskScheduler::notifyTask(TaskId taskId) {
+    {
+        std::lock_guard<std::mutex> lock(this->tasksMutex);
+        auto it = findTask(taskId);
+        if (it == tasks.end()) {
+            return;
+        }
+        it->notified = true;
+        if (!it->running) {
+            it->nextRun = SteadyClock::time_point::min();
+        }
+    }
+    condVar.notify_one();
+}
+
+void PeriodicTaskScheduler::setTaskPeriod(TaskId taskId, std::chrono::microseconds period) {
+    {
+        std::lock_guard<std::mutex> lock(this->tasksMutex);
+        auto it = findTask(taskId);
+        if (it == tasks.end() || it->period == period) {
+            return;
+        }
+        it->period = period;
+        if (!it->running && !it->notified) {
+            it->nextRun = getNextRun(SteadyClock::now(), period);
+        }
+    }
+    condVar.notify_one();
+}
+
+size_t PeriodicTaskScheduler::getTasksCount() {
+    std::lock_guard<std::mutex> lock(this->tasksMutex);
+    return tasks.size();
+}
+
+std::list<PeriodicTaskScheduler::PeriodicTask>::iterator PeriodicTaskScheduler::findTask(TaskId taskId) {
+    return std::find_if(tasks.begin(), tasks.end(), [taskId](const auto &periodicTask) { return periodicTask.id == taskId; });
+}
+
+PeriodicTaskScheduler::SteadyClock::time_point PeriodicTaskScheduler::getNextRun(SteadyClock::time_point now, std::chrono::microseconds period) {
+    if (period == onDemandPeriod) {
+        return SteadyClock::time_point::max();
+    }
+    return now + period;
+}
+
+void *PeriodicTaskScheduler::runTasks(void *self) {
+    auto scheduler = reinterpret_cast<PeriodicTaskScheduler *>(self);
+    if (scheduler->cpuAffinityMask != 0u) {
+        Thread::setCurrentThreadAffinity(scheduler->cpuAffinityMask);
+    }
+
+    std::unique_lock<std::mutex> lock(scheduler->tasksMutex);
+    while (scheduler->keepRunning) {
+        auto nextWakeup = scheduler->runDueTasks(lock, SteadyClock::now());
+        if (!scheduler->keepRunning) {
+            break;
+        }
+        if (nextWakeup == SteadyClock::time_point::max()) {
+            scheduler->condVar.wait(lock);
+        } else {
+            scheduler->condVar.wait_until(lock, nextWakeup);
+        }
+    }
+    return nullptr;
+}
+
+PeriodicTaskScheduler::SteadyClock::time_point PeriodicTaskScheduler::runDueTasks(std::unique_lock<std::mutex> &tasksLock, SteadyClock::time_point now) {
+    const auto coalescedDeadline = now + coalescingWindow;
+
+    // every due task runs at most once per wakeup, so tasks with period shorter than coalescing window cannot starve others
+    std::vector<TaskId> dueTasks;
+    for (const auto &periodicTask : tasks) {
+        if (!periodicTask.running && periodicTask.nextRun <= coalescedDeadline) {
+            dueTasks.push_back(periodicTask.id);
+        }
+    }
+    if (!dueTasks.empty()) {
+        wakeupsCount++;
+    }
+
+    for (auto taskId : dueTasks) {
+        auto it = findTask(taskId);
+        if (it == tasks.end() || it->running) {
+            continue;
+        }
+        it->running = true;
+        it->notified = false;
+        it->nextRun = SteadyClock::time_point::max();
+
+        // task stays in the list while running, unregisterTask waits for it
+        tasksLock.unlock();
+        it->task();
+        tasksLock.lock();
+
+        it->running = false;
+        it->nextRun = it->notified ? SteadyClock::time_point::min() : getNextRun(now, it->period);
+        taskFinishedCondVar.notify_all();
+    }
+
+    auto nextWakeup = SteadyClock::time_point::max();
+    for (const auto &periodicTask : tasks) {
+        if (!periodicTask.running) {
+            nextWakeup = std::min(nextWakeup, periodicTask.nextRun);
+        }
+    }
+    return nextWakeup;
+}
+
+} // namespace NEO
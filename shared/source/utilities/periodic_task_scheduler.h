@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Runs periodic and on-demand housekeeping of several runtime components on a shared pool of service threads.
+// Tasks whose deadlines fall within the coalescing window are executed in one wakeup.
+class PeriodicTaskScheduler : public NonCopyableOrMovableClass {
+  public:
+    using TaskId = uint64_t;
+    using SteadyClock = std::chrono::steady_clock;
+
+    static constexpr TaskId invalidTaskId = 0u;
+    static constexpr auto defaultCoalescingWindow = std::chrono::milliseconds(10);
+    // Tasks registered with this period run only after notifyTask
+    static constexpr auto onDemandPeriod = std::chrono::microseconds::zero();
+
+    PeriodicTaskScheduler();
+    virtual ~PeriodicTaskScheduler();
+
+    MOCKABLE_VIRTUAL void startThread();
+    void stopThread();
+
+    TaskId registerTask(std::function<void()> task, std::chrono::microseconds period);
+    // Blocks until an in-flight execution of the task has finished, must not be called from the task itself.
+    void unregisterTask(TaskId taskId);
+    // Makes the task due immediately; a task notified while running is executed once more.
+    void notifyTask(TaskId taskId);
+    // New period applies from the next execution, may be called from the task itself.
+    void setTaskPeriod(TaskId taskId, std::chrono::microseconds period);
+
+    size_t getTasksCount();
+    std::chrono::microseconds getCoalescingWindow() const { return coalescingWindow; }
+    uint32_t getThreadsCount() const { return threadsCount; }
+    uint64_t getCpuAffinityMask() const { return cpuAffinityMask; }
+
+  protected:
+    struct PeriodicTask {
+        std::function<void()> task;
+        std::chrono::microseconds period;
+        SteadyClock::time_point nextRun;
+        TaskId id;
+        bool running = false;
+        bool notified = false;
+    };
+
+    static void *runTasks(void *self);
+    SteadyClock::time_point runDueTasks(std::unique_lock<std::mutex> &tasksLock, SteadyClock::time_point now);
+    std::list<PeriodicTask>::iterator findTask(TaskId taskId);
+    static SteadyClock::time_point getNextRun(SteadyClock::time_point now, std::chrono::microseconds period);
+
+    std::vector<std::unique_ptr<Thread>> schedulerThreads;
+    std::list<PeriodicTask> tasks;
+    std::mutex tasksMutex;
+    std::condition_variable condVar;
+    std::condition_variable taskFinishedCondVar;
+    std::chrono::microseconds coalescingWindow = defaultCoalescingWindow;
+    uint32_t threadsCount = 1u;
+    uint64_t cpuAffinityMask = 0u;
+    TaskId lastTaskId = invalidTaskId;
+    uint32_t wakeupsCount = 0u;
+    bool keepRunning = true;
+};
+
+} // namespace NEO
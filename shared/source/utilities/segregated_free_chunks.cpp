@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/segregated_free_chunks.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace NEO {
+
+uint32_t SegregatedFreeChunks::getBinIndex(size_t size) {
+    DEBUG_BREAK_IF(size == 0u);
+    return Math::log2(static_cast<uint64_t>(size));
+}
+
+void SegregatedFreeChunks::addChunk(uint64_t ptr, size_t size) {
+    chunksByAddress.emplace(ptr, size);
+    bins[getBinIndex(size)].emplace(size, ptr);
+    freeSize += size;
+}
+
+void SegregatedFreeChunks::removeChunk(ChunksByAddress::iterator chunk) {
+    bins[getBinIndex(chunk->second)].erase({chunk->second, chunk->first});
+    freeSize -= chunk->second;
+    chunksByAddress.erase(chunk);
+}
+
+void SegregatedFreeChunks::insert(uint64_t ptr, size_t size) {
+    if (size == 0u) {
+        return;
+    }
+    auto next = chunksByAddress.lower_bound(ptr);
+    DEBUG_BREAK_IF(next != chunksByAddress.end() && next->first < ptr + size);
+
+    if (next != chunksByAddress.end() && next->first == ptr + size) {
+        size += next->second;
+        auto toRemove = next++;
+        removeChunk(toRemove);
+    }
+    if (next != chunksByAddress.begin()) {
+        auto prev = std::prev(next);
+        DEBUG_BREAK_IF(prev->first + prev->second > ptr);
+        if (prev->first + prev->second == ptr) {
+            ptr = prev->first;
+            size += prev->second;
+            removeChunk(prev);
+        }
+    }
+    addChunk(ptr, size);
+}
+
+uint64_t SegregatedFreeChunks::allocate(size_t size, size_t alignment) {
+    if (size == 0u || size > freeSize) {
+        return 0llu;
+    }
+    alignment = std::max(alignment, static_cast<size_t>(1u));
+
+    for (auto binIndex = getBinIndex(size); binIndex < binsCount; binIndex++) {
+        auto &bin = bins[binIndex];
+        // chunks in a bin are sorted by size, so the first fitting chunk is the best fit
+        for (auto candidate = bin.lower_bound({size, 0llu}); candidate != bin.end(); ++candidate) {
+            const auto chunkPtr = candidate->second;
+            const auto chunkSize = candidate->first;
+            const auto alignedPtr = alignUp(chunkPtr, alignment);
+            const auto padding = static_cast<size_t>(alignedPtr - chunkPtr);
+            if (padding + size > chunkSize) {
+                continue;
+            }
+
+            removeChunk(chunksByAddress.find(chunkPtr));
+            if (padding > 0u) {
+                addChunk(chunkPtr, padding);
+            }
+            if (chunkSize > padding + size) {
+                addChunk(alignedPtr + size, chunkSize - padding - size);
+            }
+            return alignedPtr;
+        }
+    }
+    return 0llu;
+}
+
+size_t SegregatedFreeChunks::extractStartingAt(uint64_t ptr) {
+    auto chunk = chunksByAddress.find(ptr);
+    if (chunk == chunksByAddress.end()) {
+        return 0u;
+    }
+    auto size = chunk->second;
+    removeChunk(chunk);
+    return size;
+}
+
+size_t SegregatedFreeChunks::extractEndingAt(uint64_t endPtr) {
+    auto next = chunksByAddress.lower_bound(endPtr);
+    if (next == chunksByAddress.begin()) {
+        return 0u;
+    }
+    auto chunk = std::prev(next);
+    if (chunk->first + chunk->second != endPtr) {
+        return 0u;
+    }
+    auto size = chunk->second;
+    removeChunk(chunk);
+    return size;
+}
+
+size_t SegregatedFreeChunks::getLargestChunkSize() const {
+    for (auto bin = bins.rbegin(); bin != bins.rend(); ++bin) {
+        if (!bin->empty()) {
+            return bin->rbegin()->first;
+        }
+    }
+    return 0u;
+}
+
+} // namespace NEO
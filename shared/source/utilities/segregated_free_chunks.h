@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <utility>
+
+namespace NEO {
+
+// Free chunks kept in power-of-two size bins (for best-fit search) and ordered by address (for coalescing).
+// Insertion, best-fit allocation and neighbour lookup are O(log n) in the number of free chunks.
+class SegregatedFreeChunks {
+  public:
+    void insert(uint64_t ptr, size_t size);
+    uint64_t allocate(size_t size, size_t alignment);
+    size_t extractStartingAt(uint64_t ptr);
+    size_t extractEndingAt(uint64_t endPtr);
+
+    size_t getChunksCount() const { return chunksByAddress.size(); }
+    size_t getFreeSize() const { return freeSize; }
+    size_t getLargestChunkSize() const;
+
+  protected:
+    using ChunksByAddress = std::map<uint64_t, size_t>;
+    static constexpr size_t binsCount = 64u;
+    static uint32_t getBinIndex(size_t size);
+
+    void addChunk(uint64_t ptr, size_t size);
+    void removeChunk(ChunksByAddress::iterator chunk);
+
+    ChunksByAddress chunksByAddress;
+    std::array<std::set<std::pair<size_t, uint64_t>>, binsCount> bins;
+    size_t freeSize = 0u;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,22 +33,19 @@ class BaseSortedPointerWithValueVector {
         return data->size;
     }
 
+    // O(log n) search, O(n) shift of 16-byte entries; keeps lookups and residency iteration on contiguous storage
     void insert(const void *ptr, const ValueType &value) {
-        allocations.push_back(std::make_pair(ptr, std::make_unique<ValueType>(value)));
-        for (size_t i = allocations.size() - 1; i > 0; --i) {
-            if (allocations[i].first < allocations[i - 1].first) {
-                std::iter_swap(allocations.begin() + i, allocations.begin() + i - 1);
-            } else {
-                break;
-            }
-        }
+        auto position = std::upper_bound(allocations.begin(), allocations.end(), ptr, [](const void *ptr, const PointerPair &allocation) {
+            return ptr < allocation.first;
+        });
+        allocations.emplace(position, ptr, std::make_unique<ValueType>(value));
     }
 
     void remove(const void *ptr) {
-        auto removeIt = std::remove_if(allocations.begin(), allocations.end(), [&ptr](const PointerPair &other) {
-            return ptr == other.first;
-        });
-        allocations.erase(removeIt);
+        auto it = getImpl(ptr, false);
+        if (it != allocations.end()) {
+            allocations.erase(it);
+        }
     }
 
     typename Container::iterator getImpl(const void *ptr, bool allowOffset) {
@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/device_bitfield.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
@@ -137,6 +138,14 @@ class TagNode : public TagNodeBase, public IDNode<TagNode<TagType>> {
     MetricsLibraryApi::QueryHandle_1_0 &getQueryHandleRef() const override;
 };
 
+// Counters of slow paths taken by TagAllocator, updated outside of the tag cache hit path
+struct TagAllocatorCounters {
+    std::atomic<uint64_t> freeTagsMisses{0u};
+    std::atomic<uint64_t> allocatorMutexContentions{0u};
+    std::atomic<uint64_t> threadCacheRefills{0u};
+    std::atomic<uint64_t> threadCachesDrains{0u};
+};
+
 class TagAllocatorBase {
   public:
     virtual ~TagAllocatorBase() { cleanUpResources(); };
@@ -147,6 +156,8 @@ class TagAllocatorBase {
 
     const std::vector<std::unique_ptr<MultiGraphicsAllocation>> &getGfxAllocations() const { return gfxAllocations; }
 
+    const TagAllocatorCounters &getCounters() const { return counters; }
+
   protected:
     TagAllocatorBase() = delete;
 
@@ -169,9 +180,11 @@ class TagAllocatorBase {
     MemoryManager *memoryManager;
     size_t tagCount;
     size_t tagSize;
+    size_t threadCacheSize = 0u;
     bool doNotReleaseNodes = false;
 
     std::mutex allocatorMutex;
+    TagAllocatorCounters counters;
 };
 
 template <typename TagType>
@@ -180,17 +193,32 @@ class TagAllocator : public TagAllocatorBase {
     using NodeType = TagNode<TagType>;
     using ValueT = typename TagType::ValueT;
 
+    static constexpr size_t threadCachesCount = 16u;
+
     TagAllocator(const RootDeviceIndicesContainer &rootDeviceIndices, MemoryManager *memMngr, size_t tagCount,
                  size_t tagAlignment, size_t tagSize, ValueT initialValue, bool doNotReleaseNodes, bool initializeTags, DeviceBitfield deviceBitfield);
+    ~TagAllocator() override;
 
     TagNodeBase *getTag() override;
 
     void returnTag(TagNodeBase *node) override;
     ValueT getInitialValue() const { return initialValue; }
+    uint64_t getThreadCacheHits() const;
 
   protected:
+    // Free tags taken and returned without touching shared free list, threads are mapped to caches by id hash.
+    struct alignas(MemoryConstants::cacheLineSize) ThreadCache {
+        IDList<NodeType> tags;
+        std::atomic<size_t> tagsCount{0u};
+        std::atomic<uint64_t> hits{0u};
+    };
+
     TagAllocator() = delete;
 
+    ThreadCache &getThreadCache();
+    NodeType *getTagFromThreadCache();
+    void drainThreadCaches();
+
     void returnTagToFreePool(TagNodeBase *node) override;
 
     void returnTagToDeferredPool(TagNodeBase *node) override;
@@ -204,6 +232,7 @@ class TagAllocator : public TagAllocatorBase {
     IDList<NodeType> deferredTags;
 
     std::vector<std::unique_ptr<NodeType[]>> tagPoolMemory;
+    std::unique_ptr<ThreadCache[]> threadCaches;
 
     const ValueT initialValue;
     bool initializeTags = true;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,25 +10,59 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/sys_calls_common.h"
 
+#include <functional>
+#include <thread>
+
 namespace NEO {
 template <typename TagType>
 TagAllocator<TagType>::TagAllocator(const RootDeviceIndicesContainer &rootDeviceIndices, MemoryManager *memMngr, size_t tagCount, size_t tagAlignment,
                                     size_t tagSize, ValueT initialValue, bool doNotReleaseNodes, bool initializeTags, DeviceBitfield deviceBitfield)
     : TagAllocatorBase(rootDeviceIndices, memMngr, tagCount, tagAlignment, tagSize, doNotReleaseNodes, deviceBitfield), initialValue(initialValue), initializeTags(initializeTags) {
 
+    if (threadCacheSize > 0u) {
+        threadCaches = std::make_unique<ThreadCache[]>(threadCachesCount);
+    }
     populateFreeTags();
 }
 
+template <typename TagType>
+TagAllocator<TagType>::~TagAllocator() {
+    if (debugManager.flags.PrintTagAllocatorCounters.get() == 1) {
+        printf("\nPID: %u, TagAllocator counters: free tags misses: %" PRIu64 ", allocator mutex contentions: %" PRIu64 ", thread cache hits: %" PRIu64 ", thread cache refills: %" PRIu64 ", thread caches drains: %" PRIu64 ", tag pools: %zu",
+               SysCalls::getProcessId(), counters.freeTagsMisses.load(), counters.allocatorMutexContentions.load(), getThreadCacheHits(),
+               counters.threadCacheRefills.load(), counters.threadCachesDrains.load(), tagPoolMemory.size());
+    }
+}
+
 template <typename TagType>
 TagNodeBase *TagAllocator<TagType>::getTag() {
-    if (freeTags.peekIsEmpty()) {
-        releaseDeferredTags();
+    NodeType *node = nullptr;
+    if (threadCaches) {
+        node = getTagFromThreadCache();
+    } else {
+        if (freeTags.peekIsEmpty()) {
+            releaseDeferredTags();
+        }
+        node = freeTags.removeFrontOne().release();
     }
-    auto node = freeTags.removeFrontOne().release();
     if (!node) {
-        std::unique_lock<std::mutex> lock(allocatorMutex);
-        populateFreeTags();
+        counters.freeTagsMisses++;
+        std::unique_lock<std::mutex> lock(allocatorMutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            counters.allocatorMutexContentions++;
+            lock.lock();
+        }
+        // free tags could be refilled by other thread while this one was waiting for the lock
         node = freeTags.removeFrontOne().release();
+        if (!node && threadCaches) {
+            // tags idle in caches of other threads are reused before a new pool is allocated
+            drainThreadCaches();
+            node = freeTags.removeFrontOne().release();
+        }
+        if (!node) {
+            populateFreeTags();
+            node = freeTags.removeFrontOne().release();
+        }
     }
     usedTags.pushFrontOne(*node);
     node->incRefCount();
@@ -54,9 +88,75 @@ void TagAllocator<TagType>::returnTagToFreePool(TagNodeBase *node) {
         printf("\nPID: %u, TSP returned to pool: 0x%" PRIX64, SysCalls::getProcessId(), nodeT->getGpuAddress());
     }
 
+    if (threadCaches) {
+        auto &threadCache = getThreadCache();
+        // count is raised before push and lowered after removal, so it never drops below number of cached tags
+        if (threadCache.tagsCount.fetch_add(1u, std::memory_order_relaxed) < threadCacheSize) {
+            threadCache.tags.pushFrontOne(*nodeT);
+            return;
+        }
+        threadCache.tagsCount.fetch_sub(1u, std::memory_order_relaxed);
+    }
     freeTags.pushFrontOne(*nodeT);
 }
 
+template <typename TagType>
+typename TagAllocator<TagType>::ThreadCache &TagAllocator<TagType>::getThreadCache() {
+    return threadCaches[std::hash<std::thread::id>{}(std::this_thread::get_id()) % threadCachesCount];
+}
+
+template <typename TagType>
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::getTagFromThreadCache() {
+    auto &threadCache = getThreadCache();
+    auto node = threadCache.tags.removeFrontOne().release();
+    if (node) {
+        threadCache.tagsCount.fetch_sub(1u, std::memory_order_relaxed);
+        threadCache.hits.fetch_add(1u, std::memory_order_relaxed);
+        return node;
+    }
+
+    if (freeTags.peekIsEmpty()) {
+        releaseDeferredTags();
+    }
+    // one tag for the caller and half of the cache are taken from shared list with single lock
+    auto refillSize = std::max(threadCacheSize / 2, static_cast<size_t>(1u));
+    node = freeTags.detachFrontNodes(refillSize + 1u);
+    if (!node) {
+        return nullptr;
+    }
+    counters.threadCacheRefills++;
+
+    auto refill = node->next;
+    if (refill) {
+        node->next = nullptr;
+        refill->prev = nullptr;
+        threadCache.tagsCount.fetch_add(refill->countThisAndAllConnected(), std::memory_order_relaxed);
+        threadCache.tags.splice(*refill);
+    }
+    return node;
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::drainThreadCaches() {
+    counters.threadCachesDrains++;
+    for (size_t i = 0; i < threadCachesCount; i++) {
+        auto cachedTags = threadCaches[i].tags.detachNodes();
+        if (cachedTags) {
+            threadCaches[i].tagsCount.fetch_sub(cachedTags->countThisAndAllConnected(), std::memory_order_relaxed);
+            freeTags.splice(*cachedTags);
+        }
+    }
+}
+
+template <typename TagType>
+uint64_t TagAllocator<TagType>::getThreadCacheHits() const {
+    uint64_t hits = 0u;
+    for (size_t i = 0; threadCaches && i < threadCachesCount; i++) {
+        hits += threadCaches[i].hits.load(std::memory_order_relaxed);
+    }
+    return hits;
+}
+
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToDeferredPool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
@@ -119,6 +219,7 @@ void TagAllocator<TagType>::populateFreeTags() {
     gfxAllocations.emplace_back(multiGraphicsAllocation);
 
     auto nodesMemory = std::make_unique<NodeType[]>(tagCount);
+    IDList<NodeType, false> newTags;
 
     for (size_t i = 0; i < tagCount; ++i) {
         auto tagOffset = i * tagSize;
@@ -129,7 +230,12 @@ void TagAllocator<TagType>::populateFreeTags() {
         nodesMemory[i].gpuAddress = baseGpuAddress + tagOffset;
         nodesMemory[i].setDoNotReleaseNodes(doNotReleaseNodes);
 
-        freeTags.pushTailOne(nodesMemory[i]);
+        newTags.pushTailOne(nodesMemory[i]);
+    }
+
+    // whole pool is linked locally and published with single locked splice
+    if (!newTags.peekIsEmpty()) {
+        freeTags.splice(*newTags.detachNodes());
     }
 
     tagPoolMemory.push_back(std::move(nodesMemory));
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,6 +59,18 @@ inline bool waitFunction(volatile TagAddressType *pollAddress, TaskCountType exp
     return waitFunctionWithPredicate<TaskCountType>(pollAddress, expectedValue, std::greater_equal<TaskCountType>());
 }
 
+// Wait step for loops checking many completion addresses at once. Only one cache line can be monitored,
+// so CPU sleeps until given address is written or monitor times out, then caller checks all addresses again.
+inline void waitFunctionForMultiple(volatile void const *monitorAddress) {
+    for (uint32_t i = 0; i < waitCount; i++) {
+        CpuIntrinsics::pause();
+    }
+    if (waitpkgUse && monitorAddress != nullptr) {
+        monitorWait(monitorAddress, 0);
+    }
+    std::this_thread::yield();
+}
+
 void init();
 } // namespace WaitUtils
 
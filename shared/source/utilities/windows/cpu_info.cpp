@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,11 +19,16 @@ void cpuidexWindowsWrapper(int *cpuInfo, int functionId, int subfunctionId) {
     __cpuidex(cpuInfo, functionId, subfunctionId);
 }
 
+uint64_t xgetbvWindowsWrapper(uint32_t xcr) {
+    return _xgetbv(xcr);
+}
+
 void getCpuFlagsWindows(std::string &cpuFlags) {}
 
 void (*CpuInfo::cpuidexFunc)(int *, int, int) = cpuidexWindowsWrapper;
 void (*CpuInfo::cpuidFunc)(int *, int) = cpuidWindowsWrapper;
 void (*CpuInfo::getCpuFlagsFunc)(std::string &) = getCpuFlagsWindows;
+uint64_t (*CpuInfo::xgetbvFunc)(uint32_t) = xgetbvWindowsWrapper;
 
 const CpuInfo CpuInfo::instance;
 
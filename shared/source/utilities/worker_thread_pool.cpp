@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_thread_pool.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/os_interface/os_thread.h"
+
+namespace NEO {
+
+WorkerThreadPool::WorkerThreadPool(uint32_t workersCount) : workersCount(workersCount) {}
+
+WorkerThreadPool::~WorkerThreadPool() {
+    UNRECOVERABLE_IF(!this->workerThreads.empty());
+}
+
+void WorkerThreadPool::startThreads() {
+    for (auto i = 0u; i < workersCount; i++) {
+        this->workerThreads.push_back(Thread::createFunc(runWorker, reinterpret_cast<void *>(this)));
+    }
+}
+
+void WorkerThreadPool::stopThreads() {
+    {
+        std::lock_guard<std::mutex> lock(this->jobMutex);
+        keepRunning = false;
+    }
+    jobCondVar.notify_all();
+    for (auto &workerThread : workerThreads) {
+        workerThread->join();
+    }
+    workerThreads.clear();
+}
+
+void *WorkerThreadPool::runWorker(void *self) {
+    auto pool = reinterpret_cast<WorkerThreadPool *>(self);
+    uint64_t seenGeneration = 0u;
+    std::unique_lock<std::mutex> lock(pool->jobMutex);
+    while (true) {
+        pool->jobCondVar.wait(lock, [&]() {
+            return !pool->keepRunning || (pool->currentJob != nullptr && pool->jobGeneration != seenGeneration);
+        });
+        if (!pool->keepRunning) {
+            return nullptr;
+        }
+        seenGeneration = pool->jobGeneration;
+        auto job = pool->currentJob;
+        job->attachedWorkers++;
+
+        lock.unlock();
+        processItems(*job);
+        lock.lock();
+
+        // caller waits for all attached workers before releasing the job
+        if (--job->attachedWorkers == 0u) {
+            pool->jobDoneCondVar.notify_one();
+        }
+    }
+}
+
+void WorkerThreadPool::processItems(Job &job) {
+    for (auto item = job.nextItem++; item < job.itemsCount; item = job.nextItem++) {
+        (*job.work)(item);
+    }
+}
+
+void WorkerThreadPool::runForEachItem(size_t itemsCount, const std::function<void(size_t)> &work) {
+    Job job;
+    job.work = &work;
+    job.itemsCount = itemsCount;
+
+    // workers busy with another caller would only be waited for, so items are processed on this thread
+    std::unique_lock<std::mutex> submissionLock(submissionMutex, std::try_to_lock);
+    if (!submissionLock.owns_lock() || workerThreads.empty() || itemsCount <= 1u) {
+        processItems(job);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->jobMutex);
+        currentJob = &job;
+        jobGeneration++;
+    }
+    jobCondVar.notify_all();
+
+    processItems(job);
+
+    std::unique_lock<std::mutex> lock(this->jobMutex);
+    currentJob = nullptr;
+    jobDoneCondVar.wait(lock, [&job]() { return job.attachedWorkers == 0u; });
+}
+
+} // namespace NEO
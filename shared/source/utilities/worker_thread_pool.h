@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Splits independent items of CPU work (e.g. per-kernel steps of module build) between the calling thread
+// and a fixed set of workers, which are started once and reused by all callers.
+// Workers serve one caller at a time; concurrent callers process their items on their own threads.
+class WorkerThreadPool : public NonCopyableOrMovableClass {
+  public:
+    explicit WorkerThreadPool(uint32_t workersCount);
+    virtual ~WorkerThreadPool();
+
+    MOCKABLE_VIRTUAL void startThreads();
+    void stopThreads();
+
+    // Returns after work was called for each item in [0, itemsCount), items are processed in no particular order.
+    void runForEachItem(size_t itemsCount, const std::function<void(size_t)> &work);
+
+    uint32_t getWorkersCount() const { return workersCount; }
+
+  protected:
+    struct Job {
+        const std::function<void(size_t)> *work = nullptr;
+        size_t itemsCount = 0u;
+        std::atomic<size_t> nextItem{0u};
+        uint32_t attachedWorkers = 0u;
+    };
+
+    static void *runWorker(void *self);
+    static void processItems(Job &job);
+
+    std::vector<std::unique_ptr<Thread>> workerThreads;
+    std::mutex submissionMutex;
+    std::mutex jobMutex;
+    std::condition_variable jobCondVar;
+    std::condition_variable jobDoneCondVar;
+    Job *currentJob = nullptr;
+    uint64_t jobGeneration = 0u;
+    uint32_t workersCount = 0u;
+    bool keepRunning = true;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@ void CpuInfo::detect() const {
     constexpr size_t edx = 3;
 
     uint32_t cpuInfo[4] = {};
+    bool osSavesAvx512State = false;
 
     cpuid(cpuInfo, 0u);
     auto numFunctionIds = cpuInfo[eax];
@@ -32,6 +33,11 @@ void CpuInfo::detect() const {
         {
             features |= cpuInfo[edx] & BIT(19) ? featureClflush : featureNone;
         }
+        // AVX-512 instructions fault unless OS saves SSE, AVX, opmask and ZMM state on context switch (XCR0 bits 1, 2, 5, 6 and 7)
+        if (cpuInfo[ecx] & BIT(27)) {
+            constexpr uint64_t avx512StateMask = BIT(1) | BIT(2) | BIT(5) | BIT(6) | BIT(7);
+            osSavesAvx512State = (xgetbvFunc(0u) & avx512StateMask) == avx512StateMask;
+        }
     }
 
     if (numFunctionIds >= extendedFeatures) {
@@ -40,6 +46,9 @@ void CpuInfo::detect() const {
             auto mask = BIT(5) | BIT(3) | BIT(8);
             features |= (cpuInfo[ebx] & mask) == mask ? featureAvX2 : featureNone;
 
+            auto avx512Mask = mask | BIT(16) | BIT(30);
+            features |= osSavesAvx512State && (cpuInfo[ebx] & avx512Mask) == avx512Mask ? featureAvX512 : featureNone;
+
             features |= (cpuInfo[ecx] & BIT(5)) ? featureWaitPkg : featureNone;
         }
     }
@@ -53,7 +62,7 @@ void CpuInfo::detect() const {
         }
     }
     if (debugManager.flags.PrintCpuFlags.get()) {
-        printf("CPUFlags:\nCLFlush: %d Avx2: %d WaitPkg: %d\nVirtual Address Size %u\n", !!(features & featureClflush), !!(features & featureAvX2), !!(features & featureWaitPkg), virtualAddressSize);
+        printf("CPUFlags:\nCLFlush: %d Avx2: %d Avx512: %d WaitPkg: %d\nVirtual Address Size %u\n", !!(features & featureClflush), !!(features & featureAvX2), !!(features & featureAvX512), !!(features & featureWaitPkg), virtualAddressSize);
     }
 }
 } // namespace NEO
@@ -160,6 +160,7 @@ int main(int argc, char **argv) {
     applyCommonWorkarounds();
     CpuInfo::cpuidexFunc = [](int *, int, int) -> void {};
     CpuInfo::cpuidFunc = [](int[4], int) -> void {};
+    CpuInfo::xgetbvFunc = [](uint32_t) -> uint64_t { return 0u; };
 
 #if defined(__linux__)
     if (getenv("IGDRCL_TEST_SELF_EXEC") == nullptr) {
@@ -40,6 +40,8 @@ class MockIoctlHelper : public IoctlHelperPrelim20 {
     ADDMETHOD_CONST_NOBASE(getNumMediaDecoders, uint32_t, 0, ());
     ADDMETHOD_CONST_NOBASE(getNumMediaEncoders, uint32_t, 0, ());
     ADDMETHOD_NOBASE(queryDeviceParams, bool, true, (uint32_t *, uint16_t *));
+    ADDMETHOD_NOBASE(beginVmBindBatch, bool, false, ());
+    ADDMETHOD_NOBASE(endVmBindBatch, int, 0, ());
 
     int getDrmParamValue(DrmParam drmParam) const override {
         if (drmParam == DrmParam::memoryClassSystem) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@ class MockBindlesHeapsHelper : public BindlessHeapsHelper {
     using BaseClass::allocateFromReusePool;
     using BaseClass::allocatePoolIndex;
     using BaseClass::borderColorStates;
+    using BaseClass::counters;
     using BaseClass::globalBindlessDsh;
     using BaseClass::growHeap;
     using BaseClass::heapFrontWindow;
@@ -41,6 +42,9 @@ class MockBindlesHeapsHelper : public BindlessHeapsHelper {
     using BaseClass::isMultiOsContextCapable;
     using BaseClass::isReservedMemoryModeAvailable;
     using BaseClass::memManager;
+    using BaseClass::mtx;
+    using BaseClass::releasedSlotsCount;
+    using BaseClass::releaseMtx;
     using BaseClass::releasePoolIndex;
     using BaseClass::reservedMemoryInitialized;
     using BaseClass::reservedRangeBase;
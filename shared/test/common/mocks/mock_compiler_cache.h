@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,10 +13,16 @@ namespace NEO {
 class CompilerCacheMock : public CompilerCache {
   public:
     using CompilerCache::config;
+    using CompilerCache::maxPendingWritesSize;
+    using CompilerCache::pendingWrites;
 
     CompilerCacheMock() : CompilerCache(CompilerCacheConfig{}) {
     }
 
+    ~CompilerCacheMock() override {
+        stopWriter();
+    }
+
     bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) override {
         cacheInvoked++;
         hashToBinaryMap[kernelFileHash] = std::string(pBinary, binarySize);
@@ -18,6 +18,8 @@ template <class BaseFaultManager>
 class MockPageFaultManagerImpl : public BaseFaultManager {
   public:
     using BaseFaultManager::BaseFaultManager;
+    using BaseFaultManager::coalesceProtection;
+    using BaseFaultManager::faultAheadCount;
     using BaseFaultManager::gpuDomainHandler;
     using BaseFaultManager::memoryData;
     using PageFaultData = typename BaseFaultManager::PageFaultData;
@@ -37,6 +37,7 @@ class MockMemoryManager : public MemoryManagerCreate<OsAgnosticMemoryManager> {
     using MemoryManager::createGraphicsAllocation;
     using MemoryManager::createStorageInfoFromProperties;
     using MemoryManager::defaultEngineIndex;
+    using MemoryManager::deferredSubmissionsCsrsCount;
     using MemoryManager::externalLocalMemoryUsageBankSelector;
     using MemoryManager::getAllocationData;
     using MemoryManager::gfxPartitions;
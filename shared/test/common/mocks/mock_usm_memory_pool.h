@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,9 +24,12 @@ class MockUsmMemAllocPoolsManager : public UsmMemAllocPoolsManager {
   public:
     using UsmMemAllocPoolsManager::canBePooled;
     using UsmMemAllocPoolsManager::device;
+    using UsmMemAllocPoolsManager::deviceBitFields;
     using UsmMemAllocPoolsManager::getPoolContainingAlloc;
+    using UsmMemAllocPoolsManager::getShardsCount;
     using UsmMemAllocPoolsManager::memoryManager;
     using UsmMemAllocPoolsManager::pools;
+    using UsmMemAllocPoolsManager::rootDeviceIndices;
     using UsmMemAllocPoolsManager::totalSize;
     using UsmMemAllocPoolsManager::UsmMemAllocPoolsManager;
     uint64_t getFreeMemory() override {
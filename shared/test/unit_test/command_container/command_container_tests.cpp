@@ -444,6 +444,67 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddAlreadyAddedAlloc
     EXPECT_EQ(sizeAfterFirstAdd, sizeAfterDuplicatesRemoved);
 }
 
+TEST_F(CommandContainerTest, givenDeduplicatedResidencyContainerWhenAddingAllocationsAndRemovingDuplicatesAgainThenOnlyNewAllocationsAreKept) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice, nullptr, HeapSize::defaultHeapSize, true, false);
+    MockGraphicsAllocation allocations[3];
+    auto &residencyContainer = cmdContainer.getResidencyContainer();
+    residencyContainer.clear();
+
+    cmdContainer.addToResidencyContainer(&allocations[2]);
+    cmdContainer.addToResidencyContainer(&allocations[0]);
+    cmdContainer.addToResidencyContainer(&allocations[2]);
+    cmdContainer.removeDuplicatesFromResidencyContainer();
+    EXPECT_EQ(2u, residencyContainer.size());
+
+    cmdContainer.addToResidencyContainer(&allocations[1]);
+    cmdContainer.addToResidencyContainer(&allocations[0]);
+    cmdContainer.addToResidencyContainer(&allocations[1]);
+    cmdContainer.removeDuplicatesFromResidencyContainer();
+    ASSERT_EQ(3u, residencyContainer.size());
+    EXPECT_TRUE(std::is_sorted(residencyContainer.begin(), residencyContainer.end()));
+    for (auto &allocation : allocations) {
+        EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), &allocation));
+    }
+
+    cmdContainer.clearResidencyContainer();
+    cmdContainer.addToResidencyContainer(&allocations[1]);
+    cmdContainer.addToResidencyContainer(&allocations[1]);
+    cmdContainer.removeDuplicatesFromResidencyContainer();
+    ASSERT_EQ(1u, residencyContainer.size());
+    EXPECT_EQ(&allocations[1], residencyContainer[0]);
+}
+
+TEST_F(CommandContainerTest, givenDeduplicatedResidencyContainerWhenErasingAllocationAndRemovingDuplicatesThenContainerIsSortedAndUnique) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice, nullptr, HeapSize::defaultHeapSize, true, false);
+    MockGraphicsAllocation allocations[4];
+    auto &residencyContainer = cmdContainer.getResidencyContainer();
+    cmdContainer.clearResidencyContainer();
+
+    cmdContainer.addToResidencyContainer(&allocations[0]);
+    cmdContainer.addToResidencyContainer(&allocations[1]);
+    cmdContainer.addToResidencyContainer(&allocations[2]);
+    cmdContainer.removeDuplicatesFromResidencyContainer();
+    ASSERT_EQ(3u, residencyContainer.size());
+
+    auto erased = residencyContainer[0];
+    cmdContainer.eraseFromResidencyContainer(erased);
+    EXPECT_EQ(2u, residencyContainer.size());
+    cmdContainer.eraseFromResidencyContainer(erased);
+    EXPECT_EQ(2u, residencyContainer.size());
+
+    cmdContainer.addToResidencyContainer(erased);
+    cmdContainer.addToResidencyContainer(&allocations[3]);
+    cmdContainer.addToResidencyContainer(&allocations[3]);
+    cmdContainer.removeDuplicatesFromResidencyContainer();
+    ASSERT_EQ(4u, residencyContainer.size());
+    EXPECT_TRUE(std::is_sorted(residencyContainer.begin(), residencyContainer.end()));
+    for (auto &allocation : allocations) {
+        EXPECT_EQ(1, std::count(residencyContainer.begin(), residencyContainer.end(), &allocation));
+    }
+}
+
 HWTEST_F(CommandContainerTest, givenCmdContainerWhenInitializeCalledThenSSHHeapHasBindlessOffsetReserved) {
     std::unique_ptr<CommandContainer> cmdContainer(new CommandContainer);
     cmdContainer->setReservedSshSize(4 * MemoryConstants::pageSize);
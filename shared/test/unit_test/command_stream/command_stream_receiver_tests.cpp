@@ -64,6 +64,7 @@
 #include <chrono>
 #include <functional>
 #include <limits>
+#include <thread>
 
 namespace NEO {
 extern ApiSpecificConfig::ApiType apiTypeForUlts;
@@ -165,6 +166,40 @@ HWTEST_F(CommandStreamReceiverTest, whenContextCreateReturnsFalseThenExpectCSRIn
     EXPECT_FALSE(ret);
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenIncrementalResidencyEnabledWhenMakingAllocationResidentAgainThenItIsAddedToResidencyAllocationsOnlyWhenResidencyChanged) {
+    auto &ultCsr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    ultCsr.incrementalResidencyEnabled = true;
+    auto contextId = ultCsr.getOsContext().getContextId();
+    auto &residencyAllocations = ultCsr.getResidencyAllocations();
+    residencyAllocations.clear();
+    MockGraphicsAllocation allocation;
+
+    ultCsr.makeResident(allocation);
+    ultCsr.makeResident(allocation);
+    EXPECT_EQ(1u, residencyAllocations.size());
+    EXPECT_EQ(ultCsr.getResidencyGeneration(), allocation.getResidencyGeneration(contextId));
+
+    residencyAllocations.clear();
+    ultCsr.taskCount++;
+    ultCsr.makeResident(allocation);
+    EXPECT_EQ(0u, residencyAllocations.size());
+    EXPECT_EQ(ultCsr.taskCount + 1, allocation.getTaskCount(contextId));
+    EXPECT_EQ(ultCsr.taskCount + 1, allocation.getResidencyTaskCount(contextId));
+
+    ultCsr.invalidateResidencyGeneration();
+    ultCsr.taskCount++;
+    ultCsr.makeResident(allocation);
+    EXPECT_EQ(1u, residencyAllocations.size());
+
+    residencyAllocations.clear();
+    allocation.releaseResidencyInOsContext(contextId);
+    ultCsr.taskCount++;
+    ultCsr.makeResident(allocation);
+    EXPECT_EQ(1u, residencyAllocations.size());
+
+    residencyAllocations.clear();
+}
+
 HWTEST_F(CommandStreamReceiverTest, givenFlagsDisabledWhenCallFillReusableAllocationsListThenDoNotAllocateCommandBuffer) {
     DebugManagerStateRestore stateRestore;
     debugManager.flags.SetAmountOfReusableAllocations.set(0);
@@ -325,6 +360,71 @@ HWTEST_F(CommandStreamReceiverTest, whenRegisterClientThenIncrementClientNum) {
     EXPECT_EQ(csr.getNumClients(), numClients);
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenRegisteredDeferredSubmissionsFlushWhenWaitingForCompletionThenDeferredSubmissionsAreFlushedUntilUnregistered) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.callBaseWaitForCompletionWithTimeout = true;
+
+    auto mockMemoryManager = static_cast<MockMemoryManager *>(csr.getMemoryManager());
+    EXPECT_EQ(0u, mockMemoryManager->deferredSubmissionsCsrsCount.load());
+
+    int owner;
+    uint32_t flushesCount = 0;
+    bool lastFlushBlocking = true;
+    csr.registerDeferredSubmissionsFlush(&owner, [&](bool blocking) {
+        flushesCount++;
+        lastFlushBlocking = blocking;
+    });
+    EXPECT_EQ(1u, mockMemoryManager->deferredSubmissionsCsrsCount.load());
+
+    EXPECT_EQ(WaitStatus::ready, csr.waitForCompletionWithTimeout(false, 0, 0u));
+    EXPECT_EQ(1u, flushesCount);
+    EXPECT_FALSE(lastFlushBlocking);
+
+    csr.flushDeferredSubmissions(true);
+    EXPECT_EQ(2u, flushesCount);
+    EXPECT_TRUE(lastFlushBlocking);
+
+    csr.unregisterDeferredSubmissionsFlush(&owner);
+    EXPECT_EQ(0u, mockMemoryManager->deferredSubmissionsCsrsCount.load());
+    EXPECT_EQ(WaitStatus::ready, csr.waitForCompletionWithTimeout(false, 0, 0u));
+    EXPECT_EQ(2u, flushesCount);
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenDeferredSubmissionsFlushInProgressWhenUnregisteringOwnerThenUnregisterWaitsForFlushToFinish) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    int owner;
+    std::atomic<bool> flushStarted = false;
+    std::atomic<bool> finishFlush = false;
+    std::atomic<bool> flushFinished = false;
+    csr.registerDeferredSubmissionsFlush(&owner, [&](bool blocking) {
+        flushStarted = true;
+        while (!finishFlush) {
+            std::this_thread::yield();
+        }
+        flushFinished = true;
+    });
+
+    std::thread flushingThread([&csr]() { csr.flushDeferredSubmissions(true); });
+    while (!flushStarted) {
+        std::this_thread::yield();
+    }
+
+    std::atomic<bool> unregistered = false;
+    std::thread unregisteringThread([&]() {
+        csr.unregisterDeferredSubmissionsFlush(&owner);
+        EXPECT_TRUE(flushFinished);
+        unregistered = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_FALSE(unregistered);
+
+    finishFlush = true;
+    unregisteringThread.join();
+    flushingThread.join();
+    EXPECT_TRUE(unregistered);
+}
+
 HWTEST_F(CommandStreamReceiverTest, WhenCreatingCsrThenTimestampTypeIs32b) {
     auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
 
@@ -5058,7 +5158,7 @@ HWTEST_F(CommandStreamReceiverHwTest, GivenDirtyFlagForContextInBindlessHelperWh
     MockBindlesHeapsHelper *bindlessHeapsHelperPtr = bindlessHeapsHelper.get();
     pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->bindlessHeapsHelper.reset(bindlessHeapsHelper.release());
 
-    bindlessHeapsHelperPtr->stateCacheDirtyForContext.set(commandStreamReceiver.getOsContext().getContextId());
+    bindlessHeapsHelperPtr->stateCacheDirtyForContext.fetch_or(1ull << commandStreamReceiver.getOsContext().getContextId());
 
     flushTaskFlags.implicitFlush = true;
     auto usedSpaceBefore = commandStreamReceiver.commandStream.getUsed();
@@ -5108,7 +5208,7 @@ HWTEST_F(CommandStreamReceiverHwTest, GivenDirtyFlagForContextInBindlessHelperWh
     MockBindlesHeapsHelper *bindlessHeapsHelperPtr = bindlessHeapsHelper.get();
     pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->bindlessHeapsHelper.reset(bindlessHeapsHelper.release());
 
-    bindlessHeapsHelperPtr->stateCacheDirtyForContext.set(commandStreamReceiver.getOsContext().getContextId());
+    bindlessHeapsHelperPtr->stateCacheDirtyForContext.fetch_or(1ull << commandStreamReceiver.getOsContext().getContextId());
 
     commandStreamReceiver.flushImmediateTask(commandStream, commandStream.getUsed(), immediateFlushTaskFlags, *pDevice);
 
@@ -5139,7 +5239,7 @@ HWTEST_F(CommandStreamReceiverHwTest, GivenContextInitializedAndDirtyFlagForCont
     MockBindlesHeapsHelper *bindlessHeapsHelperPtr = bindlessHeapsHelper.get();
     pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->bindlessHeapsHelper.reset(bindlessHeapsHelper.release());
 
-    bindlessHeapsHelperPtr->stateCacheDirtyForContext.set(commandStreamReceiver.getOsContext().getContextId());
+    bindlessHeapsHelperPtr->stateCacheDirtyForContext.fetch_or(1ull << commandStreamReceiver.getOsContext().getContextId());
 
     // only state cache flush is dispatched in dynamic preamble
     auto immediateBufferStartOffset = commandStream.getUsed();
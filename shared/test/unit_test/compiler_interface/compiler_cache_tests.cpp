@@ -29,6 +29,7 @@
 #include "os_inc.h"
 
 #include <array>
+#include <atomic>
 #include <list>
 #include <memory>
 
@@ -379,6 +380,108 @@ TEST(CompilerCacheTests, GivenNonExistantConfigWhenLoadingFromCacheThenNullIsRet
     EXPECT_EQ(0U, size);
 }
 
+TEST(CompilerCacheTests, GivenAsyncWritesDisabledWhenCachingBinaryAsyncThenBinaryIsCachedImmediately) {
+    CompilerCacheMock cache;
+    cache.config.cacheSize = MemoryConstants::megaByte;
+
+    const char binary[] = "binary";
+    cache.cacheBinaryAsync("some_hash", binary, sizeof(binary));
+
+    EXPECT_EQ(1u, cache.cacheInvoked);
+    EXPECT_EQ(std::string(binary, sizeof(binary)), cache.hashToBinaryMap["some_hash"]);
+}
+
+TEST(CompilerCacheTests, GivenAsyncWritesEnabledWhenCachingBinaryAsyncThenBinaryIsWrittenByBackgroundThread) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableAsyncCompilerCacheWrites.set(1);
+
+    CompilerCacheMock cache;
+    cache.config.cacheSize = MemoryConstants::megaByte;
+
+    const char binary[] = "binary";
+    cache.cacheBinaryAsync("some_hash", binary, sizeof(binary));
+    cache.cacheBinaryAsync("some_hash", nullptr, sizeof(binary));
+    cache.flushPendingWrites();
+
+    EXPECT_EQ(1u, cache.cacheInvoked);
+    EXPECT_EQ(std::string(binary, sizeof(binary)), cache.hashToBinaryMap["some_hash"]);
+}
+
+TEST(CompilerCacheTests, GivenPendingAsyncWriteWhenLoadingFromCacheThenPendingBinaryIsReturned) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableAsyncCompilerCacheWrites.set(1);
+
+    struct BlockingCompilerCache : public CompilerCache {
+        using CompilerCache::CompilerCache;
+        using CompilerCache::pendingWrites;
+        using CompilerCache::pendingWritesMtx;
+
+        ~BlockingCompilerCache() override {
+            release();
+            stopWriter();
+        }
+
+        bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) override {
+            std::unique_lock<std::mutex> lock(blockMtx);
+            blockCondition.wait(lock, [&]() { return released; });
+            cacheInvoked++;
+            return true;
+        }
+
+        void release() {
+            std::lock_guard<std::mutex> lock(blockMtx);
+            released = true;
+            blockCondition.notify_all();
+        }
+
+        std::mutex blockMtx;
+        std::condition_variable blockCondition;
+        bool released = false;
+        std::atomic<uint32_t> cacheInvoked = 0u;
+    };
+
+    CompilerCacheConfig config = {};
+    config.cacheSize = MemoryConstants::megaByte;
+    config.cacheDir = "----do-not-exists----";
+    BlockingCompilerCache cache(config);
+
+    const char binary[] = "binary";
+    cache.cacheBinaryAsync("some_hash", binary, sizeof(binary));
+
+    size_t size = 0u;
+    auto loaded = cache.loadCachedBinary("some_hash", size);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loaded.get(), size));
+
+    cache.cacheBinaryAsync("some_hash", binary, sizeof(binary));
+    {
+        std::lock_guard<std::mutex> lock(cache.pendingWritesMtx);
+        EXPECT_EQ(1u, cache.pendingWrites.size());
+    }
+
+    cache.release();
+    cache.flushPendingWrites();
+    EXPECT_EQ(1u, cache.cacheInvoked);
+}
+
+TEST(CompilerCacheTests, GivenPendingWritesSizeLimitExceededWhenCachingBinaryAsyncThenBinaryIsCachedSynchronously) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableAsyncCompilerCacheWrites.set(1);
+
+    CompilerCacheMock cache;
+    cache.config.cacheSize = MemoryConstants::megaByte;
+    EXPECT_EQ(CompilerCache::defaultMaxPendingWritesSize, cache.maxPendingWritesSize);
+
+    const char binary[] = "binary";
+    cache.maxPendingWritesSize = sizeof(binary) - 1;
+    cache.cacheBinaryAsync("some_hash", binary, sizeof(binary));
+
+    EXPECT_EQ(1u, cache.cacheInvoked);
+    EXPECT_TRUE(cache.pendingWrites.empty());
+    EXPECT_EQ(std::string(binary, sizeof(binary)), cache.hashToBinaryMap["some_hash"]);
+}
+
 TEST(CompilerInterfaceCachedTests, GivenNoCachedBinaryWhenBuildingThenErrorIsReturned) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "shared/source/compiler_interface/compiler_interface.inl"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/oclc_extensions.h"
+#include "shared/source/compiler_interface/translation_output_cache.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
@@ -157,6 +158,41 @@ TEST_F(CompilerInterfaceTest, WhenCompilingToIsaThenSuccessIsReturned) {
     EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
 }
 
+TEST_F(CompilerInterfaceTest, GivenBuildOutputCacheEnabledWhenBuildingSameInputTwiceThenSecondOutputIsTakenFromBuildOutputCache) {
+    pCompilerInterface->buildOutputCache = std::make_unique<TranslationOutputCache>(TranslationOutputCache::defaultMaxEntriesCount);
+
+    TranslationOutput firstOutput;
+    auto err = pCompilerInterface->build(*pDevice, inputArgs, firstOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
+    EXPECT_EQ(1u, pCompilerInterface->buildOutputCache->getEntriesCount());
+
+    TranslationOutput secondOutput;
+    err = pCompilerInterface->build(*pDevice, inputArgs, secondOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
+    EXPECT_EQ(1u, pCompilerInterface->buildOutputCache->getEntriesCount());
+    ASSERT_EQ(firstOutput.deviceBinary.size, secondOutput.deviceBinary.size);
+    EXPECT_EQ(0, memcmp(firstOutput.deviceBinary.mem.get(), secondOutput.deviceBinary.mem.get(), firstOutput.deviceBinary.size));
+
+    inputArgs.allowCaching = false;
+    TranslationOutput uncachedOutput;
+    err = pCompilerInterface->build(*pDevice, inputArgs, uncachedOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, err);
+    EXPECT_EQ(1u, pCompilerInterface->buildOutputCache->getEntriesCount());
+}
+
+TEST_F(CompilerInterfaceTest, GivenEnableBuildOutputCacheDebugFlagWhenCreatingCompilerInterfaceThenBuildOutputCacheIsCreated) {
+    DebugManagerStateRestore restorer;
+    {
+        MockCompilerInterface compilerInterface;
+        EXPECT_EQ(nullptr, compilerInterface.buildOutputCache);
+    }
+    debugManager.flags.EnableBuildOutputCache.set(1);
+    {
+        MockCompilerInterface compilerInterface;
+        EXPECT_NE(nullptr, compilerInterface.buildOutputCache);
+    }
+}
+
 TEST_F(CompilerInterfaceTest, WhenPreferredIntermediateRepresentationSpecifiedThenPreserveIt) {
     CompilerCacheConfig config = {};
     config.enabled = false;
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/compiler_interface/translation_output_cache.h"
+#include "shared/source/helpers/string.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace NEO;
+
+namespace {
+void setDeviceBinary(TranslationOutput &output, const std::string &binary) {
+    output.deviceBinary.mem = ::makeCopy(binary.c_str(), binary.size());
+    output.deviceBinary.size = binary.size();
+}
+
+std::string getDeviceBinary(const TranslationOutput &output) {
+    return std::string(output.deviceBinary.mem.get(), output.deviceBinary.size);
+}
+} // namespace
+
+TEST(TranslationOutputCacheTests, GivenEmptyCacheWhenLookingUpKeyThenCallerBecomesBuilder) {
+    TranslationOutputCache cache(TranslationOutputCache::defaultMaxEntriesCount);
+    TranslationOutput output;
+    EXPECT_FALSE(cache.lookupOrStartBuild("key", output));
+    EXPECT_EQ(nullptr, output.deviceBinary.mem);
+    cache.finishBuild("key", nullptr);
+    EXPECT_EQ(0u, cache.getEntriesCount());
+}
+
+TEST(TranslationOutputCacheTests, GivenFinishedBuildWhenLookingUpSameKeyThenCopyOfOutputIsReturned) {
+    TranslationOutputCache cache(TranslationOutputCache::defaultMaxEntriesCount);
+    TranslationOutput builtOutput;
+    ASSERT_FALSE(cache.lookupOrStartBuild("key", builtOutput));
+    setDeviceBinary(builtOutput, "binary");
+    builtOutput.backendCompilerLog = "log";
+    cache.finishBuild("key", &builtOutput);
+    EXPECT_EQ(1u, cache.getEntriesCount());
+
+    TranslationOutput cachedOutput;
+    EXPECT_TRUE(cache.lookupOrStartBuild("key", cachedOutput));
+    EXPECT_EQ("binary", getDeviceBinary(cachedOutput));
+    EXPECT_NE(builtOutput.deviceBinary.mem.get(), cachedOutput.deviceBinary.mem.get());
+    EXPECT_EQ("log", cachedOutput.backendCompilerLog);
+    EXPECT_EQ(nullptr, cachedOutput.debugData.mem);
+}
+
+TEST(TranslationOutputCacheTests, GivenFullCacheWhenAddingNewEntryThenLeastRecentlyUsedEntryIsEvicted) {
+    TranslationOutputCache cache(2u);
+    TranslationOutput output;
+    for (auto key : {"a", "b"}) {
+        ASSERT_FALSE(cache.lookupOrStartBuild(key, output));
+        setDeviceBinary(output, key);
+        cache.finishBuild(key, &output);
+    }
+
+    EXPECT_TRUE(cache.lookupOrStartBuild("a", output));
+
+    ASSERT_FALSE(cache.lookupOrStartBuild("c", output));
+    setDeviceBinary(output, "c");
+    cache.finishBuild("c", &output);
+    EXPECT_EQ(2u, cache.getEntriesCount());
+
+    EXPECT_TRUE(cache.lookupOrStartBuild("a", output));
+    EXPECT_TRUE(cache.lookupOrStartBuild("c", output));
+    EXPECT_FALSE(cache.lookupOrStartBuild("b", output));
+    cache.finishBuild("b", nullptr);
+}
+
+TEST(TranslationOutputCacheTests, GivenZeroCapacityWhenBuildFinishesThenOutputIsNotCached) {
+    TranslationOutputCache cache(0u);
+    TranslationOutput output;
+    ASSERT_FALSE(cache.lookupOrStartBuild("key", output));
+    setDeviceBinary(output, "binary");
+    cache.finishBuild("key", &output);
+    EXPECT_EQ(0u, cache.getEntriesCount());
+    EXPECT_FALSE(cache.lookupOrStartBuild("key", output));
+    cache.finishBuild("key", nullptr);
+}
+
+TEST(TranslationOutputCacheTests, GivenBuildInFlightWhenOtherThreadLooksUpSameKeyThenItWaitsForBuildResult) {
+    TranslationOutputCache cache(TranslationOutputCache::defaultMaxEntriesCount);
+    TranslationOutput builtOutput;
+    ASSERT_FALSE(cache.lookupOrStartBuild("key", builtOutput));
+
+    std::atomic<bool> waiterStarted = false;
+    std::atomic<bool> waiterDone = false;
+    bool waiterHit = false;
+    TranslationOutput waiterOutput;
+    std::thread waiter([&] {
+        waiterStarted = true;
+        waiterHit = cache.lookupOrStartBuild("key", waiterOutput);
+        waiterDone = true;
+    });
+    while (!waiterStarted) {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(waiterDone);
+
+    setDeviceBinary(builtOutput, "binary");
+    cache.finishBuild("key", &builtOutput);
+    waiter.join();
+
+    EXPECT_TRUE(waiterHit);
+    EXPECT_EQ("binary", getDeviceBinary(waiterOutput));
+}
+
+TEST(TranslationOutputCacheTests, GivenFailedBuildInFlightWhenOtherThreadWaitsForSameKeyThenItBecomesBuilder) {
+    TranslationOutputCache cache(TranslationOutputCache::defaultMaxEntriesCount);
+    TranslationOutput output;
+    ASSERT_FALSE(cache.lookupOrStartBuild("key", output));
+
+    bool waiterHit = true;
+    std::thread waiter([&] {
+        TranslationOutput waiterOutput;
+        waiterHit = cache.lookupOrStartBuild("key", waiterOutput);
+        cache.finishBuild("key", nullptr);
+    });
+    cache.finishBuild("key", nullptr);
+    waiter.join();
+
+    EXPECT_FALSE(waiterHit);
+    EXPECT_EQ(0u, cache.getEntriesCount());
+}
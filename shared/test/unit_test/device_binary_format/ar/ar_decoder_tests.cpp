@@ -1,11 +1,14 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
+#include "shared/source/device_binary_format/ar/ar_encoder.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/test/common/test_macros/test.h"
 
 using namespace NEO::Ar;
@@ -424,3 +427,68 @@ TEST(ArDecoderDecodeAr, GivenFilesWithLongFilenamesWhenLongNameIsOutOfBoundsThen
     EXPECT_FALSE(decodeErrors.empty());
     EXPECT_STREQ("Corrupt AR archive - long file name entry has broken identifier : '/100            '", decodeErrors.c_str());
 }
+
+TEST(ArDecoderDecodeAr, GivenArWithIndexThenFilesAreDecodedFromIndexAndAliasesReferToSharedData) {
+    const uint8_t data0[8] = "1234567";
+    const uint8_t data1[16] = "9ABCDEFGHIJKLMN";
+    ArEncoder encoder(true, true);
+    encoder.appendFileEntry("a", data0);
+    encoder.appendFileEntry("b", data1);
+    encoder.appendFileEntry("c", data0);
+    auto arStorage = encoder.encode();
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arStorage, decodeErrors, decodeWarnings);
+    EXPECT_TRUE(decodeErrors.empty());
+    EXPECT_TRUE(decodeWarnings.empty());
+    EXPECT_EQ(SpecialFileNames::indexFile, ar.indexEntry.fileName);
+
+    ASSERT_EQ(3U, ar.files.size());
+    EXPECT_EQ("a", ar.files[0].fileName);
+    EXPECT_EQ("b", ar.files[1].fileName);
+    EXPECT_EQ("c", ar.files[2].fileName);
+    EXPECT_EQ(0, memcmp(data0, ar.files[0].fileData.begin(), sizeof(data0)));
+    EXPECT_EQ(0, memcmp(data1, ar.files[1].fileData.begin(), sizeof(data1)));
+    EXPECT_EQ(ar.files[0].fileData.begin(), ar.files[2].fileData.begin());
+    EXPECT_EQ(sizeof(data0), ar.files[2].fileData.size());
+    EXPECT_EQ(ar.files[0].fullHeader, ar.files[2].fullHeader);
+    EXPECT_EQ(0U, ptrDiff(ar.files[0].fileData.begin(), arStorage.data()) % MemoryConstants::pageSize);
+    EXPECT_EQ(0U, ptrDiff(ar.files[1].fileData.begin(), arStorage.data()) % MemoryConstants::pageSize);
+}
+
+TEST(ArDecoderDecodeAr, GivenArWithInvalidIndexThenAllFileEntriesAreDecodedAndAliasesAreResolved) {
+    const uint8_t data0[8] = "1234567";
+    ArEncoder encoder(true, true);
+    encoder.appendFileEntry("a", data0);
+    encoder.appendFileEntry("c", data0);
+    auto arStorage = encoder.encode();
+    auto indexData = arStorage.data() + arMagic.size() + sizeof(ArFileEntryHeader);
+    indexData[2] = 'x'; // "a x096 8"
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arStorage, decodeErrors, decodeWarnings);
+    EXPECT_TRUE(decodeErrors.empty());
+    EXPECT_STREQ("Invalid AR index, decoding all file entries", decodeWarnings.c_str());
+
+    ASSERT_EQ(3U, ar.files.size());
+    EXPECT_EQ("pad_0", ar.files[0].fileName);
+    EXPECT_EQ("a", ar.files[1].fileName);
+    EXPECT_EQ("c", ar.files[2].fileName);
+    EXPECT_EQ(ar.files[1].fileData.begin(), ar.files[2].fileData.begin());
+    EXPECT_EQ(sizeof(data0), ar.files[2].fileData.size());
+}
+
+TEST(ArDecoderDecodeAr, GivenAliasToUnknownFileEntryThenDecodingFails) {
+    const uint8_t aliasData[] = "!<alias>\nb";
+    ArEncoder encoder;
+    encoder.appendFileEntry("a", ArrayRef<const uint8_t>(aliasData, sizeof(aliasData) - 1));
+    auto arStorage = encoder.encode();
+
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto ar = decodeAr(arStorage, decodeErrors, decodeWarnings);
+    EXPECT_EQ(nullptr, ar.magic);
+    EXPECT_STREQ("Corrupt AR archive - alias file entry 'a' refers to unknown file entry", decodeErrors.c_str());
+}
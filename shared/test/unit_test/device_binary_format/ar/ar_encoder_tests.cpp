@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/test/common/test_macros/test.h"
@@ -147,3 +148,34 @@ TEST(ArEncoder, GivenValidTwoFileEntriesWhen8BytePaddingIsRequestedThenPaddingFi
     EXPECT_EQ(0, memcmp(file1Data, data1, sizeof(data1)));
     EXPECT_EQ(0, memcmp(file2Data, data2, sizeof(data2)));
 }
+
+TEST(ArEncoder, GivenDeduplicatingEncoderWhenAppendingIdenticalFilesThenDataIsStoredOnceAndAliasEntryIsAdded) {
+    const uint8_t data0[8] = "1234567";
+    const uint8_t data1[16] = "9ABCDEFGHIJKLMN";
+    ArEncoder encoder(true, true);
+
+    EXPECT_EQ(nullptr, encoder.appendFileEntry(SpecialFileNames::indexFile, data0));
+    ASSERT_NE(nullptr, encoder.appendFileEntry("a", data0));
+    ASSERT_NE(nullptr, encoder.appendFileEntry("b", data1));
+    auto aliasHeader = encoder.appendFileEntry("c", data0);
+    ASSERT_NE(nullptr, aliasHeader);
+    EXPECT_EQ(0, memcmp("!<alias>\na", aliasHeader + 1, arAliasMagic.size() + 1));
+
+    auto arData = encoder.encode();
+    EXPECT_TRUE(NEO::hasSameMagic(arMagic, arData));
+
+    auto indexHeader = reinterpret_cast<ArFileEntryHeader *>(arData.data() + arMagic.size());
+    EXPECT_EQ(0, memcmp("index/", indexHeader->identifier, 6));
+    auto indexData = reinterpret_cast<const char *>(indexHeader + 1);
+    auto indexSize = static_cast<size_t>(atoi(indexHeader->fileSizeInBytes));
+    EXPECT_EQ(0U, (arMagic.size() + sizeof(ArFileEntryHeader) + indexSize) % MemoryConstants::pageSize);
+
+    const std::string expectedIndex = "a 4096 8\nb 8192 16\nc 4096 8\n";
+    EXPECT_EQ(expectedIndex, std::string(indexData, expectedIndex.size()));
+
+    auto files = reinterpret_cast<const uint8_t *>(indexData) + indexSize;
+    EXPECT_EQ(0U, ptrDiff(files, arData.data()) % MemoryConstants::pageSize);
+    EXPECT_EQ(0, memcmp(files + 4096, data0, sizeof(data0)));
+    EXPECT_EQ(0, memcmp(files + 8192, data1, sizeof(data1)));
+    EXPECT_EQ(0, memcmp(files + 8192 + sizeof(data1) + sizeof(ArFileEntryHeader), "!<alias>\na", arAliasMagic.size() + 1));
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,8 +11,10 @@
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/product_config_helper.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
 #include "shared/test/common/helpers/default_hw_info.h"
@@ -131,6 +133,43 @@ TEST(UnpackSingleDeviceBinaryAr, WhenBinaryWithProductConfigIsFoundThenPackedTar
     EXPECT_NE(0U, unpacked.packedTargetDeviceBinary.size());
 }
 
+TEST(UnpackSingleDeviceBinaryAr, GivenDeduplicatedArchiveWhenBinaryWithProductConfigIsAliasThenSharedBinaryIsUsedInPlace) {
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    const auto &compilerProductHelper = mockExecutionEnvironment.rootDeviceEnvironments[0]->getHelper<NEO::CompilerProductHelper>();
+    NEO::HardwareInfo hwInfo = *NEO::defaultHwInfo;
+    NEO::HardwareIpVersion aotConfig = {0};
+    aotConfig.value = compilerProductHelper.getHwIpVersion(hwInfo);
+
+    NEO::Ar::ArEncoder encoder(true, true);
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredProductConfig = ProductConfigHelper::parseMajorMinorRevisionValue(aotConfig);
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + ".unk", programTokens.storage));
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProductConfig, programTokens.storage));
+
+    NEO::TargetDevice target;
+    target.coreFamily = static_cast<GFXCORE_FAMILY>(programTokens.header->Device);
+    target.aotConfig = aotConfig;
+    target.stepping = programTokens.header->SteppingId;
+    target.maxPointerSizeInBytes = programTokens.header->GPUPointerSizeInBytes;
+
+    auto arData = encoder.encode();
+    std::string unpackErrors;
+    std::string unpackWarnings;
+    auto unpacked = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::archive>(arData, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpackErrors.empty()) << unpackErrors;
+    EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
+    EXPECT_EQ(NEO::DeviceBinaryFormat::patchtokens, unpacked.format);
+
+    auto decodedAr = NEO::Ar::decodeAr(arData, unpackErrors, unpackWarnings);
+    ASSERT_EQ(2U, decodedAr.files.size());
+    EXPECT_EQ(decodedAr.files[0].fileData.begin(), unpacked.packedTargetDeviceBinary.begin());
+    EXPECT_EQ(0U, ptrDiff(unpacked.packedTargetDeviceBinary.begin(), arData.data()) % MemoryConstants::pageSize);
+    EXPECT_LT(arData.size(), 3 * MemoryConstants::pageSize + 2 * programTokens.storage.size());
+}
+
 TEST(UnpackSingleDeviceBinaryAr, WhenMultipleBinariesMatchedThenChooseBestMatch) {
     PatchTokensTestData::ValidEmptyProgram programTokens;
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
@@ -1,13 +1,15 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
+#include "shared/source/device_binary_format/yaml/yaml_scanner.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <algorithm>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
@@ -334,6 +336,49 @@ TEST(YamlConstructParseError, WhenConstructingErrorThenTakesLineNumberAndContext
     EXPECT_STREQ("NEO::Yaml : Could not parse line : [146] : [Not r] <-- parser position on error. Reason : Yup, not a yaml\n", NEO::Yaml::constructYamlError(146, line.begin(), line.begin() + 4, "Yup, not a yaml").c_str());
 }
 
+TEST(YamlScanner, GivenCharacterAtAnyPositionThenFindCharacterReturnsItsFirstOccurrence) {
+    std::string text(3 * scanChunkSize + 5, 'a');
+    for (size_t i = 0; i < text.size(); ++i) {
+        text[i] = '#';
+        EXPECT_EQ(text.data() + i, findCharacter(text.data(), text.data() + text.size(), '#')) << i;
+        EXPECT_EQ(text.data() + i, findCharacter(text.data() + i, text.data() + text.size(), '#')) << i;
+        text[i] = 'a';
+    }
+    EXPECT_EQ(text.data() + text.size(), findCharacter(text.data(), text.data() + text.size(), '#'));
+    EXPECT_EQ(text.data(), findCharacter(text.data(), text.data(), 'a'));
+}
+
+TEST(YamlScanner, GivenRunOfCharacterOfAnyLengthThenSkipCharacterReturnsItsEnd) {
+    std::string text(3 * scanChunkSize + 5, ' ');
+    EXPECT_EQ(text.data() + text.size(), skipCharacter(text.data(), text.data() + text.size(), ' '));
+    for (size_t i = 0; i < text.size(); ++i) {
+        text[i] = 'a';
+        EXPECT_EQ(text.data() + i, skipCharacter(text.data(), text.data() + text.size(), ' ')) << i;
+        text[i] = ' ';
+    }
+    EXPECT_EQ(text.data(), skipCharacter(text.data(), text.data(), ' '));
+}
+
+TEST(YamlScanner, GivenYamlWithLongIndentsAndCommentsThenTokenizerSkipsThemInWideChunks) {
+    std::string yaml = "kernels:\n";
+    for (int i = 0; i < 64; ++i) {
+        yaml += "  - name : kernel_" + std::to_string(i) + " # some comment that spans more than a single chunk\n";
+        yaml += "                          dims : [1, 2, 3]\n";
+        yaml += "                          simd : 16\n";
+    }
+
+    NEO::Yaml::LinesCache lines;
+    NEO::Yaml::TokensCache tokens;
+    std::string warnings;
+    std::string errors;
+    EXPECT_TRUE(NEO::Yaml::tokenize(yaml, lines, tokens, errors, warnings));
+    EXPECT_TRUE(errors.empty()) << errors;
+    EXPECT_TRUE(warnings.empty()) << warnings;
+    EXPECT_EQ(1U + 3U * 64U, lines.size());
+    EXPECT_EQ(26U, lines[2].indent);
+    EXPECT_EQ(ConstStringRef(" some comment that spans more than a single chunk"), tokens[lines[1].last - 1].cstrref());
+}
+
 TEST(YamlTokenize, GivenEmptyInputStringThenEmitsWarning) {
     NEO::Yaml::LinesCache lines;
     NEO::Yaml::TokensCache tokens;
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/device_binary_format/zebin/zeinfo_cache.h"
+#include "shared/source/device_binary_format/zebin/zeinfo_decoder.h"
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/kernel/kernel_arg_descriptor_extended_vme.h"
+#include "shared/source/program/kernel_info.h"
+#include "shared/source/program/program_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_compiler_cache.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/test_macros/test.h"
+
+using namespace NEO;
+using namespace NEO::Zebin::ZeInfo;
+
+namespace {
+constexpr ConstStringRef zeInfoForCache = R"===(
+kernels:
+    - name : some_kernel
+      execution_env:
+        simd_size: 16
+      payload_arguments:
+        - arg_type:        global_id_offset
+          offset:          0
+          size:            12
+        - arg_type:        arg_bypointer
+          offset:          16
+          size:            8
+          arg_index:       0
+          addrmode : stateful
+        - arg_type:        arg_bypointer
+          offset:          24
+          size:            8
+          arg_index:       1
+          addrmode : stateful
+          addrspace : image
+        - arg_type:        arg_byvalue
+          offset:          32
+          size:            4
+          arg_index:       2
+      binding_table_indices:
+        - arg_index: 0
+          bti_value:2
+        - arg_index: 1
+          bti_value:7
+    - name : other_kernel
+      execution_env:
+        simd_size: 8
+global_host_access_table:
+    - device_name:     int_var
+      host_name:       IntVarName
+functions:
+    - name: fun1
+      execution_env:
+        grf_count: 128
+        simd_size: 8
+        barrier_count: 1
+)===";
+
+void decodeForCache(ProgramInfo &programInfo) {
+    std::string errors;
+    std::string warnings;
+    ASSERT_EQ(DecodeError::success, decodeZeInfo(programInfo, zeInfoForCache, errors, warnings)) << errors;
+}
+} // namespace
+
+TEST(DecodedZeInfoCacheTest, givenDecodedZeInfoWhenSerializedAndDeserializedThenProgramInfoIsRestored) {
+    ProgramInfo decoded;
+    decodeForCache(decoded);
+    ASSERT_TRUE(isDecodedZeInfoSerializable(decoded));
+    auto serialized = serializeDecodedZeInfo(decoded, zeInfoForCache);
+
+    ProgramInfo restored;
+    ASSERT_TRUE(deserializeDecodedZeInfo(serialized, zeInfoForCache, restored));
+
+    EXPECT_STREQ("IntVarName", restored.globalsDeviceToHostNameMap["int_var"].c_str());
+    ASSERT_EQ(1u, restored.externalFunctions.size());
+    EXPECT_STREQ("fun1", restored.externalFunctions[0].functionName.c_str());
+    EXPECT_EQ(128u, restored.externalFunctions[0].numGrfRequired);
+    EXPECT_EQ(1u, restored.externalFunctions[0].barrierCount);
+
+    ASSERT_EQ(2u, restored.kernelInfos.size());
+    const auto &src = decoded.kernelInfos[0]->kernelDescriptor;
+    const auto &dst = restored.kernelInfos[0]->kernelDescriptor;
+    EXPECT_STREQ("some_kernel", dst.kernelMetadata.kernelName.c_str());
+    EXPECT_STREQ("other_kernel", restored.kernelInfos[1]->kernelDescriptor.kernelMetadata.kernelName.c_str());
+    EXPECT_EQ(16u, dst.kernelAttributes.simdSize);
+    EXPECT_EQ(src.kernelAttributes.crossThreadDataSize, dst.kernelAttributes.crossThreadDataSize);
+    EXPECT_EQ(src.kernelAttributes.binaryFormat, dst.kernelAttributes.binaryFormat);
+    EXPECT_EQ(src.kernelAttributes.flags.packed, dst.kernelAttributes.flags.packed);
+    EXPECT_EQ(0, memcmp(src.payloadMappings.dispatchTraits.globalWorkOffset, dst.payloadMappings.dispatchTraits.globalWorkOffset, sizeof(src.payloadMappings.dispatchTraits.globalWorkOffset)));
+    EXPECT_EQ(src.payloadMappings.bindingTable.numEntries, dst.payloadMappings.bindingTable.numEntries);
+    EXPECT_EQ(src.payloadMappings.bindingTable.tableOffset, dst.payloadMappings.bindingTable.tableOffset);
+
+    ASSERT_EQ(3u, dst.payloadMappings.explicitArgs.size());
+    EXPECT_EQ(src.payloadMappings.explicitArgs[0].as<ArgDescPointer>().bindful, dst.payloadMappings.explicitArgs[0].as<ArgDescPointer>().bindful);
+    EXPECT_EQ(16u, dst.payloadMappings.explicitArgs[0].as<ArgDescPointer>().stateless);
+    EXPECT_EQ(src.payloadMappings.explicitArgs[1].as<ArgDescImage>().bindful, dst.payloadMappings.explicitArgs[1].as<ArgDescImage>().bindful);
+    ASSERT_EQ(1u, dst.payloadMappings.explicitArgs[2].as<ArgDescValue>().elements.size());
+    EXPECT_EQ(32u, dst.payloadMappings.explicitArgs[2].as<ArgDescValue>().elements[0].offset);
+    EXPECT_EQ(4u, dst.payloadMappings.explicitArgs[2].as<ArgDescValue>().elements[0].size);
+    EXPECT_EQ(src.generatedSsh, dst.generatedSsh);
+    EXPECT_EQ(src.generatedDsh, dst.generatedDsh);
+}
+
+TEST(DecodedZeInfoCacheTest, givenInvalidSerializedDataWhenDeserializingThenFailAndLeaveProgramInfoUntouched) {
+    ProgramInfo decoded;
+    decodeForCache(decoded);
+    auto serialized = serializeDecodedZeInfo(decoded, zeInfoForCache);
+
+    ProgramInfo restored;
+    auto truncated = serialized;
+    truncated.resize(truncated.size() - 1);
+    EXPECT_FALSE(deserializeDecodedZeInfo(truncated, zeInfoForCache, restored));
+
+    auto trailing = serialized;
+    trailing.push_back(0u);
+    EXPECT_FALSE(deserializeDecodedZeInfo(trailing, zeInfoForCache, restored));
+
+    auto wrongVersion = serialized;
+    reinterpret_cast<DecodedZeInfoHeader *>(wrongVersion.data())->version = decodedZeInfoVersion + 1;
+    EXPECT_FALSE(deserializeDecodedZeInfo(wrongVersion, zeInfoForCache, restored));
+
+    auto wrongMagic = serialized;
+    wrongMagic[0] = 'X';
+    EXPECT_FALSE(deserializeDecodedZeInfo(wrongMagic, zeInfoForCache, restored));
+
+    EXPECT_FALSE(deserializeDecodedZeInfo(serialized, zeInfoForCache.substr(1), restored));
+
+    EXPECT_TRUE(restored.kernelInfos.empty());
+    EXPECT_TRUE(restored.externalFunctions.empty());
+    EXPECT_TRUE(restored.globalsDeviceToHostNameMap.empty());
+}
+
+TEST(DecodedZeInfoCacheTest, givenExtendedArgDescriptorsWhenCheckingIfSerializableThenReturnFalse) {
+    ProgramInfo decoded;
+    decodeForCache(decoded);
+    EXPECT_TRUE(isDecodedZeInfoSerializable(decoded));
+
+    decoded.kernelInfos[0]->kernelDescriptor.payloadMappings.explicitArgsExtendedDescriptors.push_back(std::make_unique<ArgDescVme>());
+    EXPECT_FALSE(isDecodedZeInfoSerializable(decoded));
+}
+
+TEST(DecodedZeInfoCacheTest, givenDifferentDecodeInputsWhenGettingCacheKeyThenKeysDiffer) {
+    DebugManagerStateRestore restorer;
+    ProgramInfo programInfo;
+    auto key = getDecodedZeInfoCacheKey(zeInfoForCache, programInfo);
+    EXPECT_EQ(key, getDecodedZeInfoCacheKey(zeInfoForCache, programInfo));
+    EXPECT_NE(std::string::npos, key.find(decodedZeInfoKeySuffix.str()));
+    EXPECT_NE(key, getDecodedZeInfoCacheKey(zeInfoForCache.substr(1), programInfo));
+
+    programInfo.grfSize *= 2;
+    EXPECT_NE(key, getDecodedZeInfoCacheKey(zeInfoForCache, programInfo));
+    programInfo.grfSize /= 2;
+
+    debugManager.flags.ZebinAppendElws.set(true);
+    EXPECT_NE(key, getDecodedZeInfoCacheKey(zeInfoForCache, programInfo));
+}
+
+TEST(DecodedZeInfoCacheTest, givenDifferentDriverVersionOrRevisionWhenGettingCacheKeyThenKeysDiffer) {
+    ProgramInfo programInfo;
+    auto key = getDecodedZeInfoCacheKey(zeInfoForCache, programInfo, "1.0.0", "abc");
+    EXPECT_EQ(key, getDecodedZeInfoCacheKey(zeInfoForCache, programInfo, "1.0.0", "abc"));
+    EXPECT_NE(key, getDecodedZeInfoCacheKey(zeInfoForCache, programInfo, "1.0.1", "abc"));
+    EXPECT_NE(key, getDecodedZeInfoCacheKey(zeInfoForCache, programInfo, "1.0.0", "abd"));
+}
+
+TEST(DecodedZeInfoCacheTest, givenCacheEnabledWhenDecodingSameZeInfoTwiceThenSecondDecodeIsServedFromCache) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableDecodedProgramCache.set(1);
+    CompilerCacheMock cache;
+    std::string errors;
+    std::string warnings;
+
+    ProgramInfo first;
+    first.decodedProgramCache = &cache;
+    EXPECT_EQ(DecodeError::success, decodeZeInfoWithCache(first, zeInfoForCache, errors, warnings));
+    EXPECT_EQ(1u, cache.cacheInvoked);
+    ASSERT_EQ(1u, cache.cacheBinaryKernelFileHashes.size());
+    EXPECT_EQ(getDecodedZeInfoCacheKey(zeInfoForCache, first), cache.cacheBinaryKernelFileHashes[0]);
+
+    warnings.clear();
+    ProgramInfo second;
+    second.decodedProgramCache = &cache;
+    EXPECT_EQ(DecodeError::success, decodeZeInfoWithCache(second, zeInfoForCache, errors, warnings));
+    EXPECT_EQ(1u, cache.cacheInvoked);
+    EXPECT_TRUE(warnings.empty());
+    ASSERT_EQ(2u, second.kernelInfos.size());
+    EXPECT_STREQ("some_kernel", second.kernelInfos[0]->kernelDescriptor.kernelMetadata.kernelName.c_str());
+    EXPECT_EQ(first.kernelInfos[0]->kernelDescriptor.generatedSsh, second.kernelInfos[0]->kernelDescriptor.generatedSsh);
+}
+
+TEST(DecodedZeInfoCacheTest, givenCorruptedCacheEntryWhenDecodingThenFallBackToFullDecodeAndRefreshEntry) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableDecodedProgramCache.set(1);
+    CompilerCacheMock cache;
+    std::string errors;
+    std::string warnings;
+
+    ProgramInfo programInfo;
+    programInfo.decodedProgramCache = &cache;
+    cache.hashToBinaryMap[getDecodedZeInfoCacheKey(zeInfoForCache, programInfo)] = "corrupted";
+    EXPECT_EQ(DecodeError::success, decodeZeInfoWithCache(programInfo, zeInfoForCache, errors, warnings));
+    EXPECT_EQ(2u, programInfo.kernelInfos.size());
+    EXPECT_EQ(1u, cache.cacheInvoked);
+}
+
+TEST(DecodedZeInfoCacheTest, givenCacheDisabledWhenDecodingThenCacheIsNotUsed) {
+    CompilerCacheMock cache;
+    std::string errors;
+    std::string warnings;
+
+    ProgramInfo programInfo;
+    programInfo.decodedProgramCache = &cache;
+    EXPECT_EQ(DecodeError::success, decodeZeInfoWithCache(programInfo, zeInfoForCache, errors, warnings));
+    EXPECT_EQ(2u, programInfo.kernelInfos.size());
+    EXPECT_EQ(0u, cache.cacheInvoked);
+}
+
+TEST(DecodedZeInfoCacheTest, givenNoCompilerInterfaceWhenGettingDecodedProgramCacheThenReturnNull) {
+    DebugManagerStateRestore restorer;
+    MockExecutionEnvironment executionEnvironment;
+    auto &rootDeviceEnvironment = *executionEnvironment.rootDeviceEnvironments[0];
+    EXPECT_EQ(nullptr, rootDeviceEnvironment.getDecodedProgramCache());
+
+    debugManager.flags.EnableDecodedProgramCache.set(1);
+    rootDeviceEnvironment.compilerInterface.reset();
+    EXPECT_EQ(nullptr, rootDeviceEnvironment.getDecodedProgramCache());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@ struct DirectSubmissionControllerMock : public DirectSubmissionController {
     using DirectSubmissionController::bcsTimeoutDivisor;
     using DirectSubmissionController::checkNewSubmissions;
     using DirectSubmissionController::condVarMutex;
+    using DirectSubmissionController::controlDirectSubmissionsStateInScheduler;
     using DirectSubmissionController::directSubmissionControllingThread;
     using DirectSubmissionController::directSubmissions;
     using DirectSubmissionController::directSubmissionsMutex;
@@ -24,11 +25,15 @@ struct DirectSubmissionControllerMock : public DirectSubmissionController {
     using DirectSubmissionController::keepControlling;
     using DirectSubmissionController::lastTerminateCpuTimestamp;
     using DirectSubmissionController::lowestThrottleSubmitted;
+    using DirectSubmissionController::maxPredictedIdleGap;
     using DirectSubmissionController::maxTimeout;
     using DirectSubmissionController::pagingFenceRequests;
+    using DirectSubmissionController::scheduler;
+    using DirectSubmissionController::schedulerTaskId;
     using DirectSubmissionController::timeout;
     using DirectSubmissionController::timeoutDivisor;
     using DirectSubmissionController::timeoutParamsMap;
+    using DirectSubmissionController::timeoutPolicy;
     using DirectSubmissionController::timeSinceLastCheck;
 
     bool sleep(std::unique_lock<std::mutex> &lock) override {
@@ -78,6 +78,118 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     controller.unregisterDirectSubmission(&csr);
 }
 
+TEST(DirectSubmissionControllerTests, givenTimeoutPolicyDebugFlagsWhenCreateObjectThenPolicyIsSetAccordingly) {
+    DebugManagerStateRestore restorer;
+    {
+        DirectSubmissionControllerMock controller;
+        EXPECT_EQ(DirectSubmissionTimeoutPolicy::staticTimeout, controller.timeoutPolicy);
+        EXPECT_EQ(std::chrono::microseconds{DirectSubmissionController::defaultMaxPredictedIdleGap}, controller.maxPredictedIdleGap);
+    }
+    debugManager.flags.DirectSubmissionControllerTimeoutPolicy.set(1);
+    debugManager.flags.DirectSubmissionControllerMaxPredictedIdleGap.set(2'000);
+    {
+        DirectSubmissionControllerMock controller;
+        EXPECT_EQ(DirectSubmissionTimeoutPolicy::predictedIdleGap, controller.timeoutPolicy);
+        EXPECT_EQ(std::chrono::microseconds{2'000}, controller.maxPredictedIdleGap);
+    }
+}
+
+struct DirectSubmissionControllerTimeoutPolicyTests : public ::testing::Test {
+    void SetUp() override {
+        executionEnvironment.prepareRootDeviceEnvironments(1);
+        executionEnvironment.initializeMemoryManager();
+        executionEnvironment.rootDeviceEnvironments[0]->initOsTime();
+
+        csr = std::make_unique<MockCommandStreamReceiver>(executionEnvironment, 0, deviceBitfield);
+        osContext.reset(OsContext::create(nullptr, 0, 0,
+                                          EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                       PreemptionMode::ThreadGroup, deviceBitfield)));
+        csr->setupContext(*osContext);
+        csr->taskCount.store(1u);
+
+        controller.timeoutElapsedReturnValue.store(TimeoutElapsedMode::fullyElapsed);
+        controller.cpuTimestamp = SteadyClock::now();
+        controller.registerDirectSubmission(csr.get());
+        controller.checkNewSubmissions();
+    }
+
+    void TearDown() override {
+        controller.unregisterDirectSubmission(csr.get());
+    }
+
+    void submitAfterIdleGap(std::chrono::microseconds idleGap) {
+        controller.checkNewSubmissions();
+        controller.cpuTimestamp += idleGap;
+        csr->taskCount++;
+        controller.checkNewSubmissions();
+    }
+
+    MockExecutionEnvironment executionEnvironment;
+    DeviceBitfield deviceBitfield{1};
+    std::unique_ptr<MockCommandStreamReceiver> csr;
+    std::unique_ptr<OsContext> osContext;
+    DirectSubmissionControllerMock controller;
+};
+
+TEST_F(DirectSubmissionControllerTimeoutPolicyTests, givenStaticTimeoutPolicyWhenDirectSubmissionIsIdleThenItIsStoppedAndCountersAreUpdated) {
+    for (int i = 0; i < 5; i++) {
+        submitAfterIdleGap(std::chrono::microseconds{20'000});
+    }
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[csr.get()].isStopped);
+
+    auto counters = controller.getTimeoutPolicyCounters();
+    EXPECT_EQ(6u, counters.stops);
+    EXPECT_EQ(5u, counters.restartsAfterStop);
+    EXPECT_EQ(0u, counters.deferredStops);
+    EXPECT_EQ(0u, controller.directSubmissions[csr.get()].idleGapSamples);
+}
+
+TEST_F(DirectSubmissionControllerTimeoutPolicyTests, givenPredictedIdleGapPolicyWhenNextSubmissionIsExpectedSoonThenStopIsDeferredUntilPredictedGapElapses) {
+    controller.timeoutPolicy = DirectSubmissionTimeoutPolicy::predictedIdleGap;
+
+    for (uint32_t i = 0; i < DirectSubmissionController::minIdleGapSamplesForPrediction; i++) {
+        submitAfterIdleGap(std::chrono::microseconds{20'000});
+    }
+    auto &state = controller.directSubmissions[csr.get()];
+    EXPECT_EQ(DirectSubmissionController::minIdleGapSamplesForPrediction, state.idleGapSamples);
+    EXPECT_EQ(std::chrono::microseconds{20'000}, state.idleGapMean);
+
+    auto counters = controller.getTimeoutPolicyCounters();
+    EXPECT_EQ(DirectSubmissionController::minIdleGapSamplesForPrediction, counters.stops);
+    EXPECT_EQ(DirectSubmissionController::minIdleGapSamplesForPrediction, counters.restartsAfterStop);
+    EXPECT_EQ(0u, counters.deferredStops);
+
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(state.isStopped);
+    controller.cpuTimestamp += std::chrono::microseconds{10'000};
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(state.isStopped);
+
+    counters = controller.getTimeoutPolicyCounters();
+    EXPECT_EQ(2u, counters.deferredStops);
+
+    controller.cpuTimestamp += std::chrono::microseconds{30'000};
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(state.isStopped);
+
+    counters = controller.getTimeoutPolicyCounters();
+    EXPECT_EQ(DirectSubmissionController::minIdleGapSamplesForPrediction + 1, counters.stops);
+}
+
+TEST_F(DirectSubmissionControllerTimeoutPolicyTests, givenPredictedIdleGapPolicyWhenPredictedGapExceedsMaxThenDirectSubmissionIsStoppedImmediately) {
+    controller.timeoutPolicy = DirectSubmissionTimeoutPolicy::predictedIdleGap;
+    controller.maxPredictedIdleGap = std::chrono::microseconds{10'000};
+
+    for (uint32_t i = 0; i < DirectSubmissionController::minIdleGapSamplesForPrediction; i++) {
+        submitAfterIdleGap(std::chrono::microseconds{20'000});
+    }
+
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[csr.get()].isStopped);
+    EXPECT_EQ(0u, controller.getTimeoutPolicyCounters().deferredStops);
+}
+
 TEST(DirectSubmissionControllerTests, givenDebugFlagSetWhenCheckingIfTimeoutElapsedThenReturnCorrectValue) {
     DebugManagerStateRestore restorer;
     DirectSubmissionControllerMock defaultController;
@@ -732,6 +844,44 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenEnqueue
     EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 5u);
 }
 
+TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerStartedInSchedulerWhenEnqueueWaitForPagingFenceThenTaskHandlesRequestAndChecksSubmissions) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    DeviceBitfield deviceBitfield(1);
+
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    PeriodicTaskScheduler scheduler;
+    DirectSubmissionControllerMock controller;
+    controller.startInScheduler(scheduler);
+    EXPECT_EQ(nullptr, controller.directSubmissionControllingThread.get());
+    EXPECT_EQ(&scheduler, controller.scheduler);
+    EXPECT_NE(PeriodicTaskScheduler::invalidTaskId, controller.schedulerTaskId.load());
+    EXPECT_EQ(1u, scheduler.getTasksCount());
+
+    controller.enqueueWaitForPagingFence(&csr, 10u);
+    controller.controlDirectSubmissionsStateInScheduler();
+    EXPECT_EQ(10u, csr.pagingFenceValueToUnblock);
+    EXPECT_TRUE(controller.pagingFenceRequests.empty());
+
+    csr.taskCount.store(5u);
+    controller.registerDirectSubmission(&csr);
+    controller.startControlling();
+    controller.timeoutElapsedReturnValue.store(TimeoutElapsedMode::fullyElapsed);
+    controller.controlDirectSubmissionsStateInScheduler();
+    EXPECT_EQ(5u, controller.directSubmissions[&csr].taskCount);
+
+    controller.stopThread();
+    EXPECT_EQ(nullptr, controller.scheduler);
+    EXPECT_EQ(0u, scheduler.getTasksCount());
+    controller.unregisterDirectSubmission(&csr);
+}
+
 TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenCheckTimeoutElapsedThenReturnCorrectValue) {
     DirectSubmissionControllerMock controller;
     controller.timeout = std::chrono::seconds(5);
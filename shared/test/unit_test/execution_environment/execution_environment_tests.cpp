@@ -312,6 +312,41 @@ TEST(ExecutionEnvironment, givenExperimentalUSMAllocationReuseCleanerSetWhenInit
     EXPECT_EQ(cleaner, executionEnvironment.unifiedMemoryReuseCleaner.get());
 }
 
+TEST(ExecutionEnvironment, givenPeriodicTaskSchedulerEnabledWhenInitializeUnifiedMemoryReuseCleanerThenCleanerIsRegisteredInSharedScheduler) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.ExperimentalUSMAllocationReuseCleaner.set(1);
+    debugManager.flags.EnablePeriodicTaskScheduler.set(1);
+
+    VariableBackup<decltype(NEO::Thread::createFunc)> funcBackup{&NEO::Thread::createFunc, [](void *(*func)(void *), void *arg) -> std::unique_ptr<Thread> { return nullptr; }};
+    MockExecutionEnvironment executionEnvironment{};
+    executionEnvironment.initializeUnifiedMemoryReuseCleaner();
+
+    ASSERT_NE(nullptr, executionEnvironment.unifiedMemoryReuseCleaner.get());
+    ASSERT_NE(nullptr, executionEnvironment.periodicTaskScheduler.get());
+    EXPECT_EQ(executionEnvironment.periodicTaskScheduler.get(), executionEnvironment.initializePeriodicTaskScheduler());
+    EXPECT_EQ(1u, executionEnvironment.periodicTaskScheduler->getTasksCount());
+
+    executionEnvironment.unifiedMemoryReuseCleaner->stopThread();
+    EXPECT_EQ(0u, executionEnvironment.periodicTaskScheduler->getTasksCount());
+}
+
+TEST(ExecutionEnvironment, givenPeriodicTaskSchedulerEnabledWhenInitializeDirectSubmissionControllerThenControllerIsRegisteredInSharedScheduler) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableDirectSubmissionController.set(1);
+    debugManager.flags.EnablePeriodicTaskScheduler.set(1);
+
+    VariableBackup<decltype(NEO::Thread::createFunc)> funcBackup{&NEO::Thread::createFunc, [](void *(*func)(void *), void *arg) -> std::unique_ptr<Thread> { return nullptr; }};
+    MockExecutionEnvironment executionEnvironment{};
+    auto controller = executionEnvironment.initializeDirectSubmissionController();
+
+    ASSERT_NE(nullptr, controller);
+    ASSERT_NE(nullptr, executionEnvironment.periodicTaskScheduler.get());
+    EXPECT_EQ(1u, executionEnvironment.periodicTaskScheduler->getTasksCount());
+
+    controller->stopThread();
+    EXPECT_EQ(0u, executionEnvironment.periodicTaskScheduler->getTasksCount());
+}
+
 TEST(ExecutionEnvironment, givenExperimentalUSMAllocationReuseCleanerSetZeroWhenInitializeUnifiedMemoryReuseCleanerThenNull) {
     DebugManagerStateRestore restorer;
     debugManager.flags.ExperimentalUSMAllocationReuseCleaner.set(0);
@@ -390,6 +425,7 @@ TEST(ExecutionEnvironment, givenExecutionEnvironmentWhenInitializeMemoryManagerI
 static_assert(sizeof(ExecutionEnvironment) == sizeof(std::unique_ptr<MemoryManager>) +
                                                   sizeof(std::unique_ptr<DirectSubmissionController>) +
                                                   sizeof(std::unique_ptr<UnifiedMemoryReuseCleaner>) +
+                                                  sizeof(std::unique_ptr<PeriodicTaskScheduler>) +
                                                   sizeof(std::unique_ptr<OsEnvironment>) +
                                                   sizeof(std::vector<std::unique_ptr<RootDeviceEnvironment>>) +
                                                   sizeof(std::unordered_map<uint32_t, std::tuple<uint32_t, uint32_t, uint32_t>>) +
@@ -399,7 +435,7 @@ static_assert(sizeof(ExecutionEnvironment) == sizeof(std::unique_ptr<MemoryManag
                                                   sizeof(DeviceHierarchyMode) +
                                                   sizeof(DebuggingMode) +
                                                   sizeof(std::unordered_map<uint32_t, uint32_t>) +
-                                                  sizeof(std::mutex) +
+                                                  2 * sizeof(std::mutex) +
                                                   sizeof(std::vector<std::tuple<std::string, uint32_t>>) +
                                                   (is64bit ? 22 : 14),
               "New members detected in ExecutionEnvironment, please ensure that destruction sequence of objects is correct");
@@ -52,6 +52,8 @@ EncodeDispatchKernelArgs CommandEncodeStatesFixture::createDefaultDispatchKernel
         nullptr,                                  // cpuWalkerBuffer
         nullptr,                                  // cpuPayloadBuffer
         nullptr,                                  // outImplicitArgsPtr
+        nullptr,                                  // outIndirectDataPtr
+        nullptr,                                  // outSurfaceStatesPtr
         nullptr,                                  // additionalCommands
         PreemptionMode::Disabled,                 // preemptionMode
         NEO::RequiredPartitionDim::none,          // requiredPartitionDim
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,9 @@
 #include "shared/test/common/test_macros/test.h"
 #include "shared/test/unit_test/fixtures/front_window_fixture.h"
 
+#include <set>
+#include <thread>
+
 using namespace NEO;
 
 TEST(BindlessHeapsHelper, givenExternalAllocatorFlagAndBindlessModeEnabledWhenCreatingRootDevicesThenBindlessHeapsHelperCreated) {
@@ -334,7 +337,7 @@ TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenCreatedThenAllocateA
     EXPECT_EQ(0u, bindlessHeapHelper->allocatePoolIndex);
     EXPECT_EQ(0u, bindlessHeapHelper->releasePoolIndex);
 
-    EXPECT_EQ(0u, bindlessHeapHelper->stateCacheDirtyForContext.to_ulong());
+    EXPECT_EQ(0u, bindlessHeapHelper->stateCacheDirtyForContext.load());
 }
 
 TEST_F(BindlessHeapsHelperTests, givenFreeSlotsExceedingThresholdInResuePoolWhenNewSlotsAllocatedThenSlotsAreAllocatedFromReusePool) {
@@ -365,7 +368,7 @@ TEST_F(BindlessHeapsHelperTests, givenFreeSlotsExceedingThresholdInResuePoolWhen
     EXPECT_EQ(0u, bindlessHeapHelper->allocatePoolIndex);
     EXPECT_EQ(1u, bindlessHeapHelper->releasePoolIndex);
 
-    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), bindlessHeapHelper->stateCacheDirtyForContext.to_ullong());
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), bindlessHeapHelper->stateCacheDirtyForContext.load());
 }
 
 TEST_F(BindlessHeapsHelperTests, givenReusePoolExhaustedWhenNewSlotsAllocatedThenSlotsAreNotResuedAndStateCacheDirtyFlagsAreNotSet) {
@@ -406,14 +409,14 @@ TEST_F(BindlessHeapsHelperTests, givenReusePoolExhaustedWhenNewSlotsAllocatedThe
     EXPECT_EQ(bindlessHeapHelper->surfaceStateInHeapVectorReuse[allocatePoolIndex][0].size(), 0u);
     EXPECT_EQ(bindlessHeapHelper->surfaceStateInHeapVectorReuse[releasePoolIndex][1].size(), 2u);
 
-    bindlessHeapHelper->stateCacheDirtyForContext.reset();
+    bindlessHeapHelper->stateCacheDirtyForContext.store(0);
 
     ssInHeapInfos[3] = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
     EXPECT_NE(0u, ssInHeapInfos[3].surfaceStateOffset);
     EXPECT_NE(nullptr, ssInHeapInfos[3].ssPtr);
 
     EXPECT_FALSE(bindlessHeapHelper->allocateFromReusePool);
-    EXPECT_EQ(0u, bindlessHeapHelper->stateCacheDirtyForContext.to_ullong());
+    EXPECT_EQ(0u, bindlessHeapHelper->stateCacheDirtyForContext.load());
     EXPECT_EQ(bindlessHeapHelper->surfaceStateInHeapVectorReuse[allocatePoolIndex][0].size(), 0u);
     EXPECT_EQ(bindlessHeapHelper->surfaceStateInHeapVectorReuse[allocatePoolIndex][1].size(), 0u);
     EXPECT_EQ(bindlessHeapHelper->surfaceStateInHeapVectorReuse[releasePoolIndex][0].size(), 0u);
@@ -484,13 +487,13 @@ TEST_F(BindlessHeapsHelperTests, givenReleasedSlotsToSecondPoolWhenThresholdReac
     EXPECT_EQ(bindlessHeapHelper->surfaceStateInHeapVectorReuse[releasePoolIndex][0].size(), 3u);
     EXPECT_EQ(bindlessHeapHelper->surfaceStateInHeapVectorReuse[releasePoolIndex][1].size(), 2u);
 
-    bindlessHeapHelper->stateCacheDirtyForContext.reset();
+    bindlessHeapHelper->stateCacheDirtyForContext.store(0);
 
     ssInHeapInfos[0] = bindlessHeapHelper->allocateSSInHeap(NEO::BindlessImageSlot::max * size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
 
     EXPECT_EQ(0u, bindlessHeapHelper->allocatePoolIndex);
     EXPECT_EQ(1u, bindlessHeapHelper->releasePoolIndex);
-    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), bindlessHeapHelper->stateCacheDirtyForContext.to_ullong());
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), bindlessHeapHelper->stateCacheDirtyForContext.load());
     EXPECT_TRUE(bindlessHeapHelper->allocateFromReusePool);
 
     allocatePoolIndex = bindlessHeapHelper->allocatePoolIndex;
@@ -545,13 +548,152 @@ TEST_F(BindlessHeapsHelperTests, givenBindlessHelperWhenGettingAndClearingDirsty
     auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
 
     EXPECT_FALSE(bindlessHeapHelper->getStateDirtyForContext(1));
-    bindlessHeapHelper->stateCacheDirtyForContext.set(3);
+    bindlessHeapHelper->stateCacheDirtyForContext.store(1ull << 3);
     EXPECT_TRUE(bindlessHeapHelper->getStateDirtyForContext(3));
 
     bindlessHeapHelper->clearStateDirtyForContext(3);
     EXPECT_FALSE(bindlessHeapHelper->getStateDirtyForContext(3));
 }
 
+TEST_F(BindlessHeapsHelperTests, givenReleasedSlotsWhenPoolsAreSwitchedThenReleasedSlotsCountIsTrackedForReleasePool) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    bindlessHeapHelper->reuseSlotCountThreshold = 2;
+
+    size_t size = bindlessHeapHelper->surfaceStateSize;
+
+    SurfaceStateInHeapInfo ssInHeapInfos[4];
+    for (int i = 0; i < 3; i++) {
+        ssInHeapInfos[i] = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    }
+    ssInHeapInfos[3] = bindlessHeapHelper->allocateSSInHeap(NEO::BindlessImageSlot::max * size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    EXPECT_EQ(0u, bindlessHeapHelper->releasedSlotsCount.load());
+
+    for (auto &ssInHeapInfo : ssInHeapInfos) {
+        bindlessHeapHelper->releaseSSToReusePool(ssInHeapInfo);
+    }
+    EXPECT_EQ(4u, bindlessHeapHelper->releasedSlotsCount.load());
+
+    for (int i = 0; i < 3; i++) {
+        bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    }
+    EXPECT_FALSE(bindlessHeapHelper->allocateFromReusePool);
+    EXPECT_EQ(1u, bindlessHeapHelper->releasedSlotsCount.load());
+    EXPECT_EQ(1u, bindlessHeapHelper->surfaceStateInHeapVectorReuse[bindlessHeapHelper->releasePoolIndex][1].size());
+}
+
+TEST_F(BindlessHeapsHelperTests, givenMultipleThreadsAllocatingAndReleasingSlotsWhenSlotsAreInUseThenEachSlotIsHandedOutOnlyOnce) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    bindlessHeapHelper->reuseSlotCountThreshold = 4;
+
+    constexpr size_t numThreads = 4;
+    constexpr size_t slotsPerThread = 16;
+    size_t size = bindlessHeapHelper->surfaceStateSize;
+
+    std::vector<SurfaceStateInHeapInfo> ssInHeapInfos[numThreads];
+    for (int iteration = 0; iteration < 4; iteration++) {
+        std::vector<std::thread> threads;
+        for (size_t threadId = 0; threadId < numThreads; threadId++) {
+            threads.emplace_back([&, threadId] {
+                for (auto &ssInHeapInfo : ssInHeapInfos[threadId]) {
+                    bindlessHeapHelper->releaseSSToReusePool(ssInHeapInfo);
+                }
+                ssInHeapInfos[threadId].clear();
+                for (size_t slot = 0; slot < slotsPerThread; slot++) {
+                    ssInHeapInfos[threadId].push_back(bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh));
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        std::set<void *> slotsInUse;
+        for (auto &threadSlots : ssInHeapInfos) {
+            for (auto &ssInHeapInfo : threadSlots) {
+                EXPECT_NE(nullptr, ssInHeapInfo.ssPtr);
+                EXPECT_TRUE(slotsInUse.insert(ssInHeapInfo.ssPtr).second);
+            }
+        }
+    }
+    EXPECT_NE(0u, bindlessHeapHelper->stateCacheDirtyForContext.load());
+
+    const auto &counters = bindlessHeapHelper->getCounters();
+    EXPECT_EQ(4 * numThreads * slotsPerThread, counters.allocations.load());
+    EXPECT_EQ(3 * numThreads * slotsPerThread, counters.releases.load());
+    EXPECT_LE(counters.allocationMutexContentions.load(), counters.allocations.load());
+}
+
+TEST_F(BindlessHeapsHelperTests, givenSlotsAllocatedAndReleasedFromSingleThreadWhenCheckingCountersThenNoContentionIsCounted) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    size_t size = bindlessHeapHelper->surfaceStateSize;
+
+    SurfaceStateInHeapInfo ssInHeapInfos[3];
+    for (auto &ssInHeapInfo : ssInHeapInfos) {
+        ssInHeapInfo = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    }
+    for (auto &ssInHeapInfo : ssInHeapInfos) {
+        bindlessHeapHelper->releaseSSToReusePool(ssInHeapInfo);
+    }
+
+    const auto &counters = bindlessHeapHelper->getCounters();
+    EXPECT_EQ(3u, counters.allocations.load());
+    EXPECT_EQ(3u, counters.releases.load());
+    EXPECT_EQ(0u, counters.allocationMutexContentions.load());
+    EXPECT_EQ(0u, counters.releaseMutexContentions.load());
+}
+
+TEST_F(BindlessHeapsHelperTests, givenLockedMutexesWhenAllocatingAndReleasingSlotsFromOtherThreadThenContentionsAreCounted) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    size_t size = bindlessHeapHelper->surfaceStateSize;
+    const auto &counters = bindlessHeapHelper->getCounters();
+
+    SurfaceStateInHeapInfo ssInHeapInfo = {};
+    {
+        std::unique_lock<std::mutex> lock(bindlessHeapHelper->mtx);
+        std::thread allocatingThread([&] {
+            ssInHeapInfo = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+        });
+        while (counters.allocationMutexContentions.load() == 0u) {
+            std::this_thread::yield();
+        }
+        lock.unlock();
+        allocatingThread.join();
+    }
+    EXPECT_NE(nullptr, ssInHeapInfo.ssPtr);
+
+    {
+        std::unique_lock<std::mutex> lock(bindlessHeapHelper->releaseMtx);
+        std::thread releasingThread([&] {
+            bindlessHeapHelper->releaseSSToReusePool(ssInHeapInfo);
+        });
+        while (counters.releaseMutexContentions.load() == 0u) {
+            std::this_thread::yield();
+        }
+        lock.unlock();
+        releasingThread.join();
+    }
+
+    EXPECT_EQ(1u, counters.allocations.load());
+    EXPECT_EQ(1u, counters.allocationMutexContentions.load());
+    EXPECT_EQ(1u, counters.releases.load());
+    EXPECT_EQ(1u, counters.releaseMutexContentions.load());
+}
+
+TEST_F(BindlessHeapsHelperTests, givenPrintBindlessHeapsHelperCountersWhenHelperIsDestroyedThenCountersArePrinted) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.PrintBindlessHeapsHelperCounters.set(1);
+
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    auto ssInHeapInfo = bindlessHeapHelper->allocateSSInHeap(bindlessHeapHelper->surfaceStateSize, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    bindlessHeapHelper->releaseSSToReusePool(ssInHeapInfo);
+
+    testing::internal::CaptureStdout();
+    bindlessHeapHelper.reset();
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(std::string::npos, output.find("BindlessHeapsHelper counters: allocations: 1, allocation mutex contentions: 0, releases: 1, release mutex contentions: 0"));
+}
+
 TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenItsCreatedThenSshAllocationsAreResident) {
     auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
     MemoryOperationsHandler *memoryOperationsIface = getDevice()->getRootDeviceEnvironmentRef().memoryOperationsInterface.get();
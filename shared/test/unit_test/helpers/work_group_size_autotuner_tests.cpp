@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/work_group_size_autotuner.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_compiler_cache.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <algorithm>
+
+using namespace NEO;
+
+namespace {
+constexpr uint32_t maxWorkGroupSize = 1024u;
+constexpr uint32_t simdSize = 16u;
+
+struct MockWorkGroupSizeAutotuner : WorkGroupSizeAutotuner {
+    using WorkGroupSizeAutotuner::entries;
+    using WorkGroupSizeAutotuner::getPersistentKey;
+    using WorkGroupSizeAutotuner::samplesPerCandidate;
+    using WorkGroupSizeAutotuner::WorkGroupSizeAutotuner;
+};
+
+void runAllSamples(WorkGroupSizeAutotuner &autotuner, const WorkGroupSizeAutotunerKey &key, const Vec3<size_t> &heuristicLws, const Vec3<size_t> &gws, uint32_t workDim,
+                   const Vec3<size_t> &fastestLws, size_t maxLaunches) {
+    for (size_t i = 0; i < maxLaunches; i++) {
+        bool sampleRequested = false;
+        auto lws = autotuner.selectWorkGroupSize(key, heuristicLws, gws, workDim, maxWorkGroupSize, simdSize, true, sampleRequested);
+        if (!sampleRequested) {
+            return;
+        }
+        autotuner.reportDuration(key, lws, (lws == fastestLws) ? 100u : 200u + i);
+    }
+}
+} // namespace
+
+TEST(WorkGroupSizeAutotunerTest, givenGlobalSizesWhenCreatingKeysThenSizesWithSameMagnitudeAndDivisorShareBucket) {
+    auto key = WorkGroupSizeAutotuner::createKey(1u, {4096, 1, 1}, 1, 0);
+    EXPECT_TRUE(key == WorkGroupSizeAutotuner::createKey(1u, {5120, 1, 1}, 1, 0));
+    EXPECT_TRUE(key == WorkGroupSizeAutotuner::createKey(1u, {7168, 1, 1}, 1, 0));
+
+    EXPECT_FALSE(key == WorkGroupSizeAutotuner::createKey(2u, {4096, 1, 1}, 1, 0));
+    EXPECT_FALSE(key == WorkGroupSizeAutotuner::createKey(1u, {4608, 1, 1}, 1, 0));
+    EXPECT_FALSE(key == WorkGroupSizeAutotuner::createKey(1u, {8192, 1, 1}, 1, 0));
+    EXPECT_FALSE(key == WorkGroupSizeAutotuner::createKey(1u, {4096, 2, 1}, 2, 0));
+    EXPECT_FALSE(key == WorkGroupSizeAutotuner::createKey(1u, {4096, 1, 1}, 1, 64));
+}
+
+TEST(WorkGroupSizeAutotunerTest, givenGlobalSizeWhenGeneratingCandidatesThenHeuristicComesFirstAndAllCandidatesAreValid) {
+    Vec3<size_t> gws{256, 64, 1};
+    Vec3<size_t> heuristicLws{64, 4, 1};
+    auto candidates = WorkGroupSizeAutotuner::generateCandidates(heuristicLws, gws, 2, maxWorkGroupSize, simdSize);
+    ASSERT_LE(2u, candidates.size());
+    EXPECT_GE(WorkGroupSizeAutotuner::maxCandidates, candidates.size());
+    EXPECT_EQ(heuristicLws, candidates[0]);
+    for (size_t i = 1; i < candidates.size(); i++) {
+        EXPECT_TRUE(WorkGroupSizeAutotuner::isValidWorkGroupSize(candidates[i], gws, maxWorkGroupSize)) << i;
+        EXPECT_EQ(0u, (candidates[i].x * candidates[i].y * candidates[i].z) % simdSize) << i;
+        EXPECT_EQ(1u, candidates[i].z) << i;
+        EXPECT_EQ(candidates.end(), std::find(candidates.begin() + i + 1, candidates.end(), candidates[i])) << i;
+    }
+}
+
+TEST(WorkGroupSizeAutotunerTest, givenWorkGroupSizeWhenCheckingIfValidThenItMustDivideGlobalSizeAndFitMaxSize) {
+    Vec3<size_t> gws{256, 6, 1};
+    EXPECT_TRUE(WorkGroupSizeAutotuner::isValidWorkGroupSize({128, 2, 1}, gws, maxWorkGroupSize));
+    EXPECT_FALSE(WorkGroupSizeAutotuner::isValidWorkGroupSize({128, 4, 1}, gws, maxWorkGroupSize));
+    EXPECT_FALSE(WorkGroupSizeAutotuner::isValidWorkGroupSize({256, 6, 1}, gws, maxWorkGroupSize));
+    EXPECT_FALSE(WorkGroupSizeAutotuner::isValidWorkGroupSize({0, 1, 1}, gws, maxWorkGroupSize));
+}
+
+TEST(WorkGroupSizeAutotunerTest, givenSamplingNotPossibleWhenSelectingWorkGroupSizeThenHeuristicIsReturned) {
+    MockWorkGroupSizeAutotuner autotuner(0u, nullptr);
+    Vec3<size_t> gws{4096, 1, 1};
+    Vec3<size_t> heuristicLws{256, 1, 1};
+    auto key = WorkGroupSizeAutotuner::createKey(1u, gws, 1, 0);
+    bool sampleRequested = true;
+    EXPECT_EQ(heuristicLws, autotuner.selectWorkGroupSize(key, heuristicLws, gws, 1, maxWorkGroupSize, simdSize, false, sampleRequested));
+    EXPECT_FALSE(sampleRequested);
+
+    Vec3<size_t> tunedLws{0, 0, 0};
+    EXPECT_FALSE(autotuner.getTunedWorkGroupSize(key, gws, maxWorkGroupSize, tunedLws));
+}
+
+TEST(WorkGroupSizeAutotunerTest, givenReportedDurationsWhenAllCandidatesAreSampledThenFastestCandidateIsSelected) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.WorkGroupSizeAutotuningSamples.set(2);
+    MockWorkGroupSizeAutotuner autotuner(0u, nullptr);
+    EXPECT_EQ(2u, autotuner.samplesPerCandidate);
+
+    Vec3<size_t> gws{4096, 1, 1};
+    Vec3<size_t> heuristicLws{256, 1, 1};
+    Vec3<size_t> fastestLws{64, 1, 1};
+    auto key = WorkGroupSizeAutotuner::createKey(1u, gws, 1, 0);
+    auto candidates = WorkGroupSizeAutotuner::generateCandidates(heuristicLws, gws, 1, maxWorkGroupSize, simdSize);
+    ASSERT_NE(candidates.end(), std::find(candidates.begin(), candidates.end(), fastestLws));
+
+    runAllSamples(autotuner, key, heuristicLws, gws, 1, fastestLws, 2 * candidates.size() + 1);
+
+    bool sampleRequested = true;
+    EXPECT_EQ(fastestLws, autotuner.selectWorkGroupSize(key, heuristicLws, gws, 1, maxWorkGroupSize, simdSize, true, sampleRequested));
+    EXPECT_FALSE(sampleRequested);
+    Vec3<size_t> tunedLws{0, 0, 0};
+    EXPECT_TRUE(autotuner.getTunedWorkGroupSize(key, {5120, 1, 1}, maxWorkGroupSize, tunedLws));
+    EXPECT_EQ(fastestLws, tunedLws);
+    EXPECT_FALSE(autotuner.getTunedWorkGroupSize(key, gws, 32u, tunedLws));
+}
+
+TEST(WorkGroupSizeAutotunerTest, givenLostSamplesWhenCandidatesWereIssuedTwiceAsOftenAsNeededThenAutotuningConverges) {
+    MockWorkGroupSizeAutotuner autotuner(0u, nullptr);
+    Vec3<size_t> gws{4096, 1, 1};
+    Vec3<size_t> heuristicLws{256, 1, 1};
+    auto key = WorkGroupSizeAutotuner::createKey(1u, gws, 1, 0);
+    auto candidatesCount = WorkGroupSizeAutotuner::generateCandidates(heuristicLws, gws, 1, maxWorkGroupSize, simdSize).size();
+
+    bool sampleRequested = false;
+    Vec3<size_t> lastLws{0, 0, 0};
+    for (size_t i = 0; i < 2 * autotuner.samplesPerCandidate * candidatesCount; i++) {
+        lastLws = autotuner.selectWorkGroupSize(key, heuristicLws, gws, 1, maxWorkGroupSize, simdSize, true, sampleRequested);
+        EXPECT_TRUE(sampleRequested);
+    }
+    autotuner.reportDuration(key, lastLws, 100u);
+
+    EXPECT_EQ(lastLws, autotuner.selectWorkGroupSize(key, heuristicLws, gws, 1, maxWorkGroupSize, simdSize, true, sampleRequested));
+    EXPECT_FALSE(sampleRequested);
+}
+
+TEST(WorkGroupSizeAutotunerTest, givenPersistentCacheWhenAutotuningConvergesThenDecisionIsReusedByNewAutotuner) {
+    CompilerCacheMock cache;
+    Vec3<size_t> gws{4096, 1, 1};
+    Vec3<size_t> heuristicLws{256, 1, 1};
+    Vec3<size_t> fastestLws{128, 1, 1};
+    auto key = WorkGroupSizeAutotuner::createKey(1u, gws, 1, 0);
+    {
+        MockWorkGroupSizeAutotuner autotuner(7u, &cache);
+        runAllSamples(autotuner, key, heuristicLws, gws, 1, fastestLws, 1000);
+        EXPECT_EQ(1u, cache.cacheInvoked);
+        ASSERT_EQ(1u, cache.cacheBinaryKernelFileHashes.size());
+        EXPECT_EQ(autotuner.getPersistentKey(key), cache.cacheBinaryKernelFileHashes[0]);
+        EXPECT_NE(std::string::npos, cache.cacheBinaryKernelFileHashes[0].find(WorkGroupSizeAutotuner::persistentKeySuffix.str()));
+    }
+
+    MockWorkGroupSizeAutotuner otherDeviceAutotuner(8u, &cache);
+    Vec3<size_t> tunedLws{0, 0, 0};
+    EXPECT_FALSE(otherDeviceAutotuner.getTunedWorkGroupSize(key, gws, maxWorkGroupSize, tunedLws));
+
+    MockWorkGroupSizeAutotuner autotuner(7u, &cache);
+    EXPECT_TRUE(autotuner.getTunedWorkGroupSize(key, gws, maxWorkGroupSize, tunedLws));
+    EXPECT_EQ(fastestLws, tunedLws);
+
+    cache.hashToBinaryMap[autotuner.getPersistentKey(key)] = "corrupted";
+    MockWorkGroupSizeAutotuner autotunerWithCorruptedEntry(7u, &cache);
+    EXPECT_FALSE(autotunerWithCorruptedEntry.getTunedWorkGroupSize(key, gws, maxWorkGroupSize, tunedLws));
+}
+
+TEST(WorkGroupSizeAutotunerTest, givenSingleCandidateWhenSelectingWorkGroupSizeThenConvergeWithoutSampling) {
+    MockWorkGroupSizeAutotuner autotuner(0u, nullptr);
+    Vec3<size_t> gws{16, 1, 1};
+    Vec3<size_t> heuristicLws{16, 1, 1};
+    auto key = WorkGroupSizeAutotuner::createKey(1u, gws, 1, 0);
+    bool sampleRequested = true;
+    EXPECT_EQ(heuristicLws, autotuner.selectWorkGroupSize(key, heuristicLws, gws, 1, maxWorkGroupSize, simdSize, true, sampleRequested));
+    EXPECT_FALSE(sampleRequested);
+    EXPECT_TRUE(autotuner.entries[key].converged);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,11 +17,15 @@
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <atomic>
+#include <thread>
+
 class MockLocalIdsCache : public NEO::LocalIdsCache {
   public:
     using Base = NEO::LocalIdsCache;
     using Base::Base;
     using Base::cache;
+    using Base::trySetLocalIdsFromEntry;
     MockLocalIdsCache(size_t cacheSize) : MockLocalIdsCache(cacheSize, 32u){};
     MockLocalIdsCache(size_t cacheSize, uint8_t simd) : Base(cacheSize, {0, 1, 2}, GrfConfig::defaultGrfNumber, simd, 32, false){};
 };
@@ -38,13 +42,13 @@ struct LocalIdsCacheFixture {
 
 using LocalIdsCacheTests = Test<LocalIdsCacheFixture>;
 TEST_F(LocalIdsCacheTests, GivenCacheMissWhenGetLocalIdsForGroupThenNewEntryIsCommitedIntoLeastUsedEntry) {
-    localIdsCache->cache.resize(2);
+    localIdsCache = std::make_unique<MockLocalIdsCache>(2);
     localIdsCache->cache[0].accessCounter = 2U;
     NEO::MockExecutionEnvironment mockExecutionEnvironment{};
     auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
     localIdsCache->setLocalIdsForGroup(groupSize, perThreadData.data(), rootDeviceEnvironment);
 
-    EXPECT_EQ(groupSize, localIdsCache->cache[1].groupSize);
+    EXPECT_EQ(MockLocalIdsCache::getGroupSizeKey(groupSize), localIdsCache->cache[1].groupSizeKey);
     EXPECT_NE(nullptr, localIdsCache->cache[1].localIdsData);
     EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSize);
     EXPECT_EQ(1536U, localIdsCache->cache[1].localIdsSizeAllocated);
@@ -52,7 +56,7 @@ TEST_F(LocalIdsCacheTests, GivenCacheMissWhenGetLocalIdsForGroupThenNewEntryIsCo
 }
 
 TEST_F(LocalIdsCacheTests, GivenEntryInCacheWhenGetLocalIdsForGroupThenEntryFromCacheIsUsed) {
-    localIdsCache->cache[0].groupSize = groupSize;
+    localIdsCache->cache[0].groupSizeKey = MockLocalIdsCache::getGroupSizeKey(groupSize);
     localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
     localIdsCache->cache[0].localIdsSize = 512U;
     localIdsCache->cache[0].localIdsSizeAllocated = 512U;
@@ -64,7 +68,7 @@ TEST_F(LocalIdsCacheTests, GivenEntryInCacheWhenGetLocalIdsForGroupThenEntryFrom
 }
 
 TEST_F(LocalIdsCacheTests, GivenEntryWithBiggerBufferAllocatedWhenGetLocalIdsForGroupThenBufferIsReused) {
-    localIdsCache->cache[0].groupSize = {4, 1, 1};
+    localIdsCache->cache[0].groupSizeKey = MockLocalIdsCache::getGroupSizeKey({4, 1, 1});
     localIdsCache->cache[0].localIdsData = static_cast<uint8_t *>(alignedMalloc(512, 32));
     localIdsCache->cache[0].localIdsSize = 512U;
     localIdsCache->cache[0].localIdsSizeAllocated = 512U;
@@ -79,6 +83,55 @@ TEST_F(LocalIdsCacheTests, GivenEntryWithBiggerBufferAllocatedWhenGetLocalIdsFor
     EXPECT_EQ(192U, localIdsCache->cache[0].localIdsSize);
     EXPECT_EQ(512U, localIdsCache->cache[0].localIdsSizeAllocated);
     EXPECT_EQ(localIdsData, localIdsCache->cache[0].localIdsData);
+    EXPECT_EQ(MockLocalIdsCache::getGroupSizeKey(groupSize), localIdsCache->cache[0].groupSizeKey);
+}
+
+TEST_F(LocalIdsCacheTests, GivenDifferentGroupSizesWhenGettingGroupSizeKeyThenKeysAreUniqueAndValid) {
+    EXPECT_NE(MockLocalIdsCache::invalidGroupSizeKey, MockLocalIdsCache::getGroupSizeKey({0, 0, 0}));
+    EXPECT_NE(MockLocalIdsCache::getGroupSizeKey({2, 1, 1}), MockLocalIdsCache::getGroupSizeKey({1, 2, 1}));
+    EXPECT_NE(MockLocalIdsCache::getGroupSizeKey({2, 1, 1}), MockLocalIdsCache::getGroupSizeKey({1, 1, 2}));
+    EXPECT_EQ(MockLocalIdsCache::getGroupSizeKey({2, 1, 1}), MockLocalIdsCache::getGroupSizeKey({2, 1, 1}));
+}
+
+TEST_F(LocalIdsCacheTests, GivenEntryBeingReplacedWhenLookingUpOldGroupSizeWithoutLockThenEntryIsNotUsed) {
+    localIdsCache->cache[0].groupSizeKey = MockLocalIdsCache::invalidGroupSizeKey;
+    localIdsCache->cache[0].accessCounter = 5U;
+    EXPECT_FALSE(localIdsCache->trySetLocalIdsFromEntry(localIdsCache->cache[0], MockLocalIdsCache::getGroupSizeKey(groupSize), perThreadData.data()));
+    EXPECT_EQ(5U, localIdsCache->cache[0].accessCounter);
+    EXPECT_EQ(0U, localIdsCache->cache[0].activeReaders);
+}
+
+TEST_F(LocalIdsCacheTests, GivenMultipleThreadsWhenSettingLocalIdsForDifferentGroupsThenEachThreadGetsIdsOfItsGroup) {
+    NEO::MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    const Vec3<uint16_t> groupSizes[] = {{32, 1, 1}, {16, 2, 1}, {8, 4, 1}, {4, 8, 1}, {2, 16, 1}};
+
+    std::array<std::array<uint8_t, 2048>, 5> expectedData = {};
+    MockLocalIdsCache referenceCache(1);
+    for (auto i = 0u; i < 5u; i++) {
+        referenceCache.setLocalIdsForGroup(groupSizes[i], expectedData[i].data(), rootDeviceEnvironment);
+    }
+
+    localIdsCache = std::make_unique<MockLocalIdsCache>(2);
+    std::atomic<uint32_t> mismatches{0u};
+    std::vector<std::thread> threads;
+    for (auto threadId = 0u; threadId < 4u; threadId++) {
+        threads.emplace_back([&, threadId]() {
+            std::array<uint8_t, 2048> data = {};
+            for (auto iteration = 0u; iteration < 200u; iteration++) {
+                auto groupId = (threadId + iteration) % 5u;
+                auto size = localIdsCache->getLocalIdsSizeForGroup(groupSizes[groupId], rootDeviceEnvironment);
+                localIdsCache->setLocalIdsForGroup(groupSizes[groupId], data.data(), rootDeviceEnvironment);
+                if (0 != memcmp(expectedData[groupId].data(), data.data(), size)) {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0u, mismatches);
 }
 
 TEST_F(LocalIdsCacheTests, GivenValidLocalIdsCacheWhenGettingLocalIdsSizePerThreadThenCorrectValueIsReturned) {
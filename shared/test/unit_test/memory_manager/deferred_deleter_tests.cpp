@@ -1,10 +1,12 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/utilities/periodic_task_scheduler.h"
+#include "shared/test/common/mocks/mock_deferrable_deletion.h"
 #include "shared/test/common/mocks/mock_deferred_deleter.h"
 
 #include "gtest/gtest.h"
@@ -43,3 +45,29 @@ TEST(DeferredDeleter, givenDeferredDeleterWhenNonBlockingDrainIsCalledThenArElem
     EXPECT_EQ(0, deleter->areElementsReleasedCalled);
     EXPECT_EQ(1, deleter->drainCalled);
 }
+
+TEST(DeferredDeleter, givenSchedulerSetWhenClientIsAddedThenOnDemandTaskIsRegisteredInsteadOfThreadAndUnregisteredWhenLastClientIsRemoved) {
+    struct SchedulerDeferredDeleter : public DeferredDeleter {
+        using DeferredDeleter::schedulerTaskId;
+        using DeferredDeleter::worker;
+    };
+
+    PeriodicTaskScheduler scheduler;
+    SchedulerDeferredDeleter deleter;
+    deleter.setScheduler(&scheduler);
+    deleter.addClient();
+    EXPECT_EQ(nullptr, deleter.worker.get());
+    EXPECT_NE(PeriodicTaskScheduler::invalidTaskId, deleter.schedulerTaskId.load());
+    EXPECT_EQ(1u, scheduler.getTasksCount());
+
+    deleter.addClient();
+    EXPECT_EQ(1u, scheduler.getTasksCount());
+
+    deleter.deferDeletion(new MockDeferrableDeletion());
+    deleter.removeClient();
+    EXPECT_EQ(1u, scheduler.getTasksCount());
+
+    deleter.removeClient();
+    EXPECT_EQ(PeriodicTaskScheduler::invalidTaskId, deleter.schedulerTaskId.load());
+    EXPECT_EQ(0u, scheduler.getTasksCount());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -203,6 +203,26 @@ TEST_F(SVMLocalMemoryAllocatorTest, whenPointerWithOffsetPassedThenProperDataRet
     svmManager->freeSVMAlloc(ptr, true);
 }
 
+TEST_F(SVMLocalMemoryAllocatorTest, givenCachedLookupWhenAllocationIsFreedThenLookupDoesNotReturnFreedData) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 2));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+
+    auto ptr = svmManager->createUnifiedMemoryAllocation(4096, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, ptr);
+
+    auto usmAllocationData = svmManager->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, usmAllocationData);
+    EXPECT_EQ(usmAllocationData, svmManager->getSVMAlloc(ptrOffset(ptr, 16u)));
+
+    svmManager->freeSVMAlloc(ptr, true);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptr));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrOffset(ptr, 16u)));
+}
+
 TEST_F(SVMLocalMemoryAllocatorTest, whenMultiplePointerWithOffsetPassedThenProperDataRetrieved) {
 
     std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 2));
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -183,6 +183,38 @@ TEST_F(InitializedHostUnifiedMemoryPoolingTest, givenPoolableAllocationWhenUsing
     EXPECT_NE(nullptr, usmMemAllocPool.createUnifiedMemoryAllocation(allocationSize, memoryProperties));
 }
 
+TEST_F(InitializedHostUnifiedMemoryPoolingTest, givenAllocationsInPoolWhenGettingStatsThenHitsMissesAndUsageAreReported) {
+    SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize64k, rootDeviceIndices, deviceBitfields);
+    auto stats = usmMemAllocPool.getStats();
+    EXPECT_EQ(1u, stats.poolsCount);
+    EXPECT_EQ(poolSize, stats.poolSize);
+    EXPECT_EQ(0u, stats.usedSize);
+    EXPECT_EQ(0.0, stats.getHitRate());
+    EXPECT_EQ(0.0, stats.getFragmentation());
+
+    auto allocation1 = usmMemAllocPool.createUnifiedMemoryAllocation(MemoryConstants::pageSize64k - 1, memoryProperties);
+    auto allocation2 = usmMemAllocPool.createUnifiedMemoryAllocation(poolAllocationThreshold, memoryProperties);
+    ASSERT_NE(nullptr, allocation1);
+    ASSERT_NE(nullptr, allocation2);
+    EXPECT_EQ(nullptr, usmMemAllocPool.createUnifiedMemoryAllocation(poolAllocationThreshold, memoryProperties));
+
+    stats = usmMemAllocPool.getStats();
+    EXPECT_EQ(2u, stats.allocationsCount);
+    EXPECT_EQ(1u, stats.failedAllocationsCount);
+    EXPECT_EQ(0u, stats.freesCount);
+    EXPECT_EQ(MemoryConstants::pageSize64k - 1 + poolAllocationThreshold, stats.requestedSize);
+    EXPECT_LT(stats.requestedSize, stats.usedSize);
+    EXPECT_DOUBLE_EQ(2.0 / 3.0, stats.getHitRate());
+    EXPECT_GT(stats.getFragmentation(), 0.0);
+
+    EXPECT_TRUE(usmMemAllocPool.freeSVMAlloc(allocation1, true));
+    EXPECT_TRUE(usmMemAllocPool.freeSVMAlloc(allocation2, true));
+    stats = usmMemAllocPool.getStats();
+    EXPECT_EQ(2u, stats.freesCount);
+    EXPECT_EQ(0u, stats.requestedSize);
+    EXPECT_EQ(0u, stats.usedSize);
+}
+
 TEST_F(InitializedHostUnifiedMemoryPoolingTest, givenVariousAlignmentsWhenUsingPoolThenAddressIsAligned) {
     SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::hostUnifiedMemory, 0u, rootDeviceIndices, deviceBitfields);
     const auto allocationSize = poolAllocationThreshold;
@@ -609,4 +641,78 @@ TEST_P(UnifiedMemoryPoolingManagerTest, givenInitializedPoolsManagerWhenAllocati
 
     EXPECT_EQ(nullptr, usmMemAllocPoolsManager->getPoolContainingAlloc(constPtr));
     usmMemAllocPoolsManager->cleanup();
-}
\ No newline at end of file
+}
+
+TEST_P(UnifiedMemoryPoolingManagerTest, givenShardsCountSetWhenInitializingPoolsManagerThenPreallocatedPoolsAreShardedAndStatsAreAggregated) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmMemAllocPoolShardsCount.set(2);
+    usmMemAllocPoolsManager.reset(new MockUsmMemAllocPoolsManager(device->getMemoryManager(),
+                                                                  usmMemAllocPoolsManager->rootDeviceIndices,
+                                                                  usmMemAllocPoolsManager->deviceBitFields,
+                                                                  device,
+                                                                  poolMemoryType));
+    EXPECT_EQ(2u, usmMemAllocPoolsManager->getShardsCount());
+    EXPECT_TRUE(usmMemAllocPoolsManager->ensureInitialized(svmManager.get()));
+    ASSERT_EQ(2u, usmMemAllocPoolsManager->pools[poolInfo0To4Kb].size());
+    ASSERT_EQ(2u, usmMemAllocPoolsManager->pools[poolInfo4KbTo64Kb].size());
+    ASSERT_EQ(2u, usmMemAllocPoolsManager->pools[poolInfo64KbTo2Mb].size());
+    EXPECT_EQ(20 * MemoryConstants::megaByte, usmMemAllocPoolsManager->totalSize);
+
+    size_t smallPoolsSize = 0u;
+    for (const auto &pool : usmMemAllocPoolsManager->pools[poolInfo0To4Kb]) {
+        smallPoolsSize += pool->getPoolSize();
+    }
+    auto allocationProperties = *poolMemoryProperties.get();
+    allocationProperties.alignment = UsmMemAllocPool::chunkAlignment;
+    std::vector<void *> allocations;
+    while (auto ptr = usmMemAllocPoolsManager->createUnifiedMemoryAllocation(4 * MemoryConstants::kiloByte, allocationProperties)) {
+        allocations.push_back(ptr);
+    }
+    EXPECT_EQ(smallPoolsSize / (4 * MemoryConstants::kiloByte), allocations.size());
+    for (const auto &pool : usmMemAllocPoolsManager->pools[poolInfo0To4Kb]) {
+        EXPECT_FALSE(pool->isEmpty());
+    }
+    EXPECT_EQ(nullptr, usmMemAllocPoolsManager->createUnifiedMemoryAllocation(256 * MemoryConstants::megaByte, allocationProperties));
+
+    auto stats = usmMemAllocPoolsManager->getStats();
+    EXPECT_EQ(6u, stats.poolsCount);
+    EXPECT_EQ(allocations.size(), stats.allocationsCount);
+    EXPECT_EQ(2u, stats.failedAllocationsCount);
+    EXPECT_EQ(smallPoolsSize, stats.usedSize);
+    EXPECT_EQ(smallPoolsSize, stats.requestedSize);
+    EXPECT_EQ(0.0, stats.getFragmentation());
+
+    for (auto ptr : allocations) {
+        EXPECT_TRUE(usmMemAllocPoolsManager->freeSVMAlloc(ptr, true));
+    }
+    EXPECT_EQ(allocations.size(), usmMemAllocPoolsManager->getStats().freesCount);
+
+    debugManager.flags.PrintUsmMemAllocPoolStats.set(true);
+    testing::internal::CaptureStdout();
+    usmMemAllocPoolsManager->cleanup();
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("USM pools stats: pools: 6"));
+}
+
+TEST_P(UnifiedMemoryPoolingManagerTest, givenShardsCountExceedingPreallocatedSizeWhenInitializingPoolsManagerThenShardsCountIsCappedPerPoolInfo) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmMemAllocPoolShardsCount.set(16);
+    usmMemAllocPoolsManager.reset(new MockUsmMemAllocPoolsManager(device->getMemoryManager(),
+                                                                  usmMemAllocPoolsManager->rootDeviceIndices,
+                                                                  usmMemAllocPoolsManager->deviceBitFields,
+                                                                  device,
+                                                                  poolMemoryType));
+    EXPECT_EQ(16u, usmMemAllocPoolsManager->getShardsCount(poolInfo0To4Kb));
+    EXPECT_EQ(16u, usmMemAllocPoolsManager->getShardsCount(poolInfo4KbTo64Kb));
+    EXPECT_EQ(8u, usmMemAllocPoolsManager->getShardsCount(poolInfo64KbTo2Mb));
+
+    EXPECT_TRUE(usmMemAllocPoolsManager->ensureInitialized(svmManager.get()));
+    ASSERT_EQ(16u, usmMemAllocPoolsManager->pools[poolInfo0To4Kb].size());
+    ASSERT_EQ(16u, usmMemAllocPoolsManager->pools[poolInfo4KbTo64Kb].size());
+    ASSERT_EQ(8u, usmMemAllocPoolsManager->pools[poolInfo64KbTo2Mb].size());
+    for (const auto &pool : usmMemAllocPoolsManager->pools[poolInfo64KbTo2Mb]) {
+        EXPECT_EQ(2 * MemoryConstants::megaByte, pool->getPoolSize());
+    }
+    EXPECT_EQ(20 * MemoryConstants::megaByte, usmMemAllocPoolsManager->totalSize);
+    usmMemAllocPoolsManager->cleanup();
+}
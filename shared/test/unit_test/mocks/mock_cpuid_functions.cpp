@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,3 +38,12 @@ void mockCpuidReport36BitVirtualAddressSize(int *cpuInfo, int functionId) {
         mockCpuidEnableAll(cpuInfo, functionId);
     }
 }
+
+uint64_t mockXgetbvEnableAll(uint32_t xcr) {
+    return ~0ull;
+}
+
+uint64_t mockXgetbvAvxStateOnly(uint32_t xcr) {
+    constexpr uint64_t sseAndAvxState = 0x6;
+    return sseAndAvxState;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 void mockCpuidEnableAll(int *cpuInfo, int functionId);
 
 void mockCpuidFunctionAvailableDisableAll(int *cpuInfo, int functionId);
@@ -14,3 +16,7 @@ void mockCpuidFunctionAvailableDisableAll(int *cpuInfo, int functionId);
 void mockCpuidFunctionNotAvailableDisableAll(int *cpuInfo, int functionId);
 
 void mockCpuidReport36BitVirtualAddressSize(int *cpuInfo, int functionId);
+
+uint64_t mockXgetbvEnableAll(uint32_t xcr);
+
+uint64_t mockXgetbvAvxStateOnly(uint32_t xcr);
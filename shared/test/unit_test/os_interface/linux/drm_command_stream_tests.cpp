@@ -290,6 +290,24 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenDrmAllocationWhenGetBuffer
     mm->freeGraphicsMemory(allocation);
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenIncrementalResidencyEnabledWhenMakingAllocationNonResidentThenResidencyIsKept) {
+    auto allocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto osContextId = csr->getOsContext().getContextId();
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    testedCsr->incrementalResidencyEnabled = true;
+
+    csr->makeResident(*allocation);
+    csr->makeNonResident(*allocation);
+    EXPECT_TRUE(allocation->isResident(osContextId));
+
+    testedCsr->incrementalResidencyEnabled = false;
+    csr->makeNonResident(*allocation);
+    EXPECT_FALSE(allocation->isResident(osContextId));
+
+    csr->getResidencyAllocations().clear();
+    mm->freeGraphicsMemory(allocation);
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, WhenMakingResidentThenSucceeds) {
     auto buffer = this->createBO(1024);
     auto allocation = new DrmAllocation(0, 1u /*num gmms*/, AllocationType::unknown, buffer, nullptr, buffer->peekSize(), static_cast<osHandle>(0u), MemoryPool::memoryNull);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/periodic_task_scheduler.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture.h"
 #include "shared/test/common/test_macros/test.h"
@@ -189,3 +190,43 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerInSchedulerWhenClosingThenTaskIsUnregisteredAndRemainingQueueIsProcessed) {
+    struct MockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+        using DrmGemCloseWorker::thread;
+    };
+    this->drmMock->gemCloseExpected = 1;
+
+    PeriodicTaskScheduler scheduler;
+    std::unique_ptr<MockDrmGemCloseWorker> worker(new MockDrmGemCloseWorker(*mm, scheduler));
+    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_EQ(1u, scheduler.getTasksCount());
+
+    worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+    EXPECT_FALSE(worker->isEmpty());
+
+    worker->close(true);
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(0u, scheduler.getTasksCount());
+    worker->close(true);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerInStartedSchedulerWhenPushingBufferObjectThenGemIsClosedBySchedulerThread) {
+    this->drmMock->gemCloseExpected = 1;
+
+    PeriodicTaskScheduler scheduler;
+    scheduler.startThread();
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm, scheduler);
+    worker->push(new BufferObject(rootDeviceIndex, this->drmMock, 3, 1, 0, 1));
+
+    while (!worker->isEmpty() && (deadCnt-- > 0)) {
+        sched_yield();
+    }
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_NE(drmMock->ioctlCallerThreadId, std::this_thread::get_id());
+
+    worker.reset();
+    scheduler.stopThread();
+}
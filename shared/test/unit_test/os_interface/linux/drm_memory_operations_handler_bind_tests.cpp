@@ -25,6 +25,7 @@
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/linux/mock_drm_allocation.h"
 #include "shared/test/common/mocks/linux/mock_drm_memory_manager.h"
+#include "shared/test/common/mocks/linux/mock_ioctl_helper.h"
 #include "shared/test/common/mocks/mock_allocation_properties.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -1383,6 +1384,35 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, givenPreviouslyLockedMemoryWhenCallin
     delete mockDrmAllocation;
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenBatchedVmBindEnabledWhenEndingVmBindBatchFailsThenErrorIsReturnedFromMakeResidentAndEvictUnused) {
+    debugManager.flags.EnableBatchedVmBind.set(1);
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto osContext = device->getDefaultEngine().osContext;
+
+    auto ioctlHelper = new MockIoctlHelper(*mock);
+    std::unique_ptr<IoctlHelper> ioctlHelperBackup(mock->ioctlHelper.release());
+    mock->ioctlHelper.reset(ioctlHelper);
+    ioctlHelper->beginVmBindBatchResult = true;
+    ioctlHelper->endVmBindBatchResult = -1;
+
+    EXPECT_EQ(MemoryOperationsStatus::outOfMemory, operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), true));
+    EXPECT_EQ(1u, ioctlHelper->beginVmBindBatchCalled);
+    EXPECT_EQ(1u, ioctlHelper->endVmBindBatchCalled);
+
+    *device->getDefaultEngine().commandStreamReceiver->getTagAddress() = 10;
+    allocation->updateTaskCount(GraphicsAllocation::objectNotUsed, osContext->getContextId());
+    EXPECT_EQ(MemoryOperationsStatus::failed, operationHandler->evictUnusedAllocations(false, true));
+    EXPECT_LT(1u, ioctlHelper->endVmBindBatchCalled);
+
+    debugManager.flags.EnableBatchedVmBind.set(0);
+    auto endVmBindBatchCalled = ioctlHelper->endVmBindBatchCalled;
+    EXPECT_EQ(MemoryOperationsStatus::success, operationHandler->evictUnusedAllocations(false, true));
+    EXPECT_EQ(endVmBindBatchCalled, ioctlHelper->endVmBindBatchCalled);
+
+    mock->ioctlHelper.reset(ioctlHelperBackup.release());
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, givenLockedAndResidentAllocationsWhenCallingEvictUnusedMemoryThenBothAllocationsAreNotEvicted) {
     auto allocation1 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
     auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
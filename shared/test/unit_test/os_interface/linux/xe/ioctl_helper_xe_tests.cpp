@@ -11,9 +11,11 @@
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/engine_descriptor_helper.h"
+#include "shared/test/common/mocks/linux/mock_drm_allocation.h"
 #include "shared/test/common/mocks/linux/mock_drm_memory_manager.h"
 #include "shared/test/common/mocks/linux/mock_os_context_linux.h"
 #include "shared/test/common/mocks/linux/mock_os_time_linux.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/os_interface/linux/xe/mock_drm_xe.h"
 #include "shared/test/common/os_interface/linux/xe/mock_ioctl_helper_xe.h"
 #include "shared/test/common/os_interface/linux/xe/xe_config_fixture.h"
@@ -1693,6 +1695,223 @@ TEST_F(IoctlHelperXeTest, whenUserFenceFailsThenErrorIsPropagated) {
     EXPECT_EQ(errorValue, xeIoctlHelper->vmUnbind(vmBindParams));
 }
 
+TEST_F(IoctlHelperXeTest, givenVmBindBatchWhenBindingThenBindsAreMergedIntoArrayBindAndUserFenceIsWaitedOnceAtBatchEnd) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedVmBind.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    uint64_t fenceAddress = 0x4321;
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = 0x1234;
+
+    drm->vmBindInputs.clear();
+    drm->syncInputs.clear();
+    drm->waitUserFenceInputs.clear();
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    for (uint64_t fenceValue = 1u; fenceValue <= 3u; fenceValue++) {
+        xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, fenceAddress, fenceValue, 0u);
+        xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+        vmBindParams.start = 0x100000 * fenceValue;
+        EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    }
+    EXPECT_EQ(0u, drm->vmBindInputs.size());
+    EXPECT_EQ(0u, drm->waitUserFenceInputs.size());
+
+    EXPECT_EQ(0, xeIoctlHelper->endVmBindBatch());
+    ASSERT_EQ(1u, drm->vmBindInputs.size());
+    EXPECT_EQ(3u, drm->vmBindInputs[0].num_binds);
+    ASSERT_EQ(1u, drm->syncInputs.size());
+    EXPECT_EQ(fenceAddress, drm->syncInputs[0].addr);
+    EXPECT_EQ(3u, drm->syncInputs[0].timeline_value);
+    ASSERT_EQ(1u, drm->waitUserFenceInputs.size());
+    EXPECT_EQ(fenceAddress, drm->waitUserFenceInputs[0].addr);
+    EXPECT_EQ(3u, drm->waitUserFenceInputs[0].value);
+
+    drm->vmBindInputs.clear();
+    drm->waitUserFenceInputs.clear();
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(1u, drm->vmBindInputs.size());
+    EXPECT_EQ(1u, drm->waitUserFenceInputs.size());
+}
+
+TEST_F(IoctlHelperXeTest, givenVmBindBatchWhenBindingWithExtensionsThenPendingBindsAreFlushedAndWaitIsDeferredToBatchEnd) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedVmBind.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    uint64_t fenceAddress = 0x4321;
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = 0x1234;
+
+    drm->vmBindInputs.clear();
+    drm->waitUserFenceInputs.clear();
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, fenceAddress, 1u, 0u);
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(0u, drm->vmBindInputs.size());
+
+    uint64_t extension = 0u;
+    vmBindParams.extensions = castToUint64(&extension);
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, fenceAddress, 2u, 0u);
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+    EXPECT_EQ(0, xeIoctlHelper->vmUnbind(vmBindParams));
+    ASSERT_EQ(2u, drm->vmBindInputs.size());
+    EXPECT_EQ(1u, drm->vmBindInputs[0].num_binds);
+    EXPECT_EQ(castToUint64(&extension), drm->vmBindInputs[1].bind.extensions);
+    EXPECT_EQ(0u, drm->waitUserFenceInputs.size());
+
+    EXPECT_EQ(0, xeIoctlHelper->endVmBindBatch());
+    EXPECT_EQ(0u, drm->waitUserFenceInputs.size());
+
+    EXPECT_EQ(0, xeIoctlHelper->endVmBindBatch());
+    ASSERT_EQ(1u, drm->waitUserFenceInputs.size());
+    EXPECT_EQ(2u, drm->waitUserFenceInputs[0].value);
+}
+
+TEST_F(IoctlHelperXeTest, givenVmBindBatchWhenBatchedBindFailsThenErrorIsReturnedAtBatchEndAndUserFenceIsNotWaited) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedVmBind.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = 0x1234;
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+    drm->waitUserFenceInputs.clear();
+    int errorValue = -1;
+    drm->gemVmBindReturn = errorValue;
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(errorValue, xeIoctlHelper->endVmBindBatch());
+    EXPECT_EQ(0u, drm->waitUserFenceInputs.size());
+}
+
+TEST_F(IoctlHelperXeTest, givenVmBindBatchWhenBatchedUserptrBindFailsThenBindInfoAddressIsRestored) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedVmBind.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    uint64_t userptr = 0x10000;
+    xeIoctlHelper->updateBindInfo(userptr);
+    ASSERT_EQ(1u, xeIoctlHelper->bindInfo.size());
+    xeIoctlHelper->bindInfo[0].addr = 0x200000;
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = 0x1234;
+    vmBindParams.userptr = userptr;
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+    drm->gemVmBindReturn = -1;
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    vmBindParams.start = 0x300000;
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    vmBindParams.start = 0x400000;
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(0x400000u, xeIoctlHelper->bindInfo[0].addr);
+
+    EXPECT_EQ(-1, xeIoctlHelper->endVmBindBatch());
+    EXPECT_EQ(0x200000u, xeIoctlHelper->bindInfo[0].addr);
+}
+
+TEST_F(IoctlHelperXeTest, givenVmBindBatchWhenBatchedBufferObjectBindFailsThenBufferObjectIsNotMarkedAsBoundAndIsBoundAgainOnNextBind) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedVmBind.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    executionEnvironment->memoryManager = std::make_unique<MockMemoryManager>(*executionEnvironment);
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    OsContextLinux osContext(*drm, 0, 0u, EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular}));
+    MockBufferObject bo(0, drm.get(), 3, 0x1234, MemoryConstants::pageSize, 1);
+    const auto contextId = bo.getOsContextId(&osContext);
+
+    drm->vmBindInputs.clear();
+    drm->gemVmBindReturn = -1;
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_EQ(0, bo.bind(&osContext, 0));
+    EXPECT_TRUE(bo.bindInfo[contextId][0]);
+    EXPECT_EQ(0u, drm->vmBindInputs.size());
+
+    EXPECT_EQ(-1, xeIoctlHelper->endVmBindBatch());
+    EXPECT_EQ(1u, drm->vmBindInputs.size());
+    EXPECT_FALSE(bo.bindInfo[contextId][0]);
+
+    drm->gemVmBindReturn = 0;
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_EQ(0, bo.bind(&osContext, 0));
+    EXPECT_EQ(0, xeIoctlHelper->endVmBindBatch());
+    ASSERT_EQ(2u, drm->vmBindInputs.size());
+    EXPECT_EQ(0x1234u, drm->vmBindInputs[1].bind.obj);
+    EXPECT_TRUE(bo.bindInfo[contextId][0]);
+}
+
+TEST_F(IoctlHelperXeTest, givenVmBindBatchWhenBatchedBufferObjectUnbindFailsThenBufferObjectStaysMarkedAsBound) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedVmBind.set(1);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    executionEnvironment->memoryManager = std::make_unique<MockMemoryManager>(*executionEnvironment);
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    OsContextLinux osContext(*drm, 0, 0u, EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular}));
+    MockBufferObject bo(0, drm.get(), 3, 0x1234, MemoryConstants::pageSize, 1);
+    const auto contextId = bo.getOsContextId(&osContext);
+    bo.bindInfo[contextId][0] = true;
+
+    drm->gemVmBindReturn = -1;
+
+    EXPECT_TRUE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_EQ(0, bo.unbind(&osContext, 0));
+    EXPECT_FALSE(bo.bindInfo[contextId][0]);
+
+    EXPECT_EQ(-1, xeIoctlHelper->endVmBindBatch());
+    EXPECT_TRUE(bo.bindInfo[contextId][0]);
+}
+
+TEST_F(IoctlHelperXeTest, givenBatchedVmBindDisabledWhenBeginningVmBindBatchThenBatchIsNotStartedAndBindsAreIssuedImmediately) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableBatchedVmBind.set(0);
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
+    auto xeIoctlHelper = static_cast<MockIoctlHelperXe *>(drm->getIoctlHelper());
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    VmBindParams vmBindParams{};
+    vmBindParams.handle = 0x1234;
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+    xeIoctlHelper->setVmBindUserFence(vmBindParams, vmBindExtUserFence);
+
+    drm->vmBindInputs.clear();
+    drm->waitUserFenceInputs.clear();
+
+    EXPECT_FALSE(xeIoctlHelper->beginVmBindBatch());
+    EXPECT_EQ(0, xeIoctlHelper->vmBind(vmBindParams));
+    EXPECT_EQ(1u, drm->vmBindInputs.size());
+    EXPECT_EQ(1u, drm->waitUserFenceInputs.size());
+}
+
 TEST_F(IoctlHelperXeTest, WhenSetupIpVersionIsCalledThenIpVersionIsCorrect) {
     auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
     auto drm = DrmMockXe::create(*executionEnvironment->rootDeviceEnvironments[0]);
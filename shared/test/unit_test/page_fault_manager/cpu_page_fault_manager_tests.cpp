@@ -1011,3 +1011,106 @@ TEST_F(PageFaultManagerTest, givenHardwareModeWhenCallTbxInsertOrRemoveApiThenNo
     EXPECT_FALSE(pageFaultManager2->memoryData.find(ptr) == pageFaultManager2->memoryData.end());
     pageFaultManager2->memoryData.erase(ptr);
 }
+
+TEST_F(PageFaultManagerTest, givenManyTrackedAllocsWhenVerifyingPageFaultAddressesThenOnlyAddressesWithinAllocsAreFound) {
+    const size_t allocsCount = 1000u;
+    const size_t allocSize = 0x100;
+    for (size_t i = 0; i < allocsCount; i++) {
+        pageFaultManager->insertAllocation(reinterpret_cast<void *>(0x10000 + i * 2 * allocSize), allocSize, unifiedMemoryManager.get(), nullptr, {});
+    }
+    EXPECT_EQ(allocsCount, pageFaultManager->memoryData.size());
+
+    EXPECT_FALSE(pageFaultManager->verifyAndHandlePageFault(reinterpret_cast<void *>(0xFFFF), false));
+    for (size_t i = 0; i < allocsCount; i += 97) {
+        auto allocPtr = reinterpret_cast<void *>(0x10000 + i * 2 * allocSize);
+        EXPECT_TRUE(pageFaultManager->verifyAndHandlePageFault(allocPtr, false));
+        EXPECT_TRUE(pageFaultManager->verifyAndHandlePageFault(ptrOffset(allocPtr, allocSize - 1), false));
+        EXPECT_FALSE(pageFaultManager->verifyAndHandlePageFault(ptrOffset(allocPtr, allocSize), false));
+    }
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 0);
+}
+
+TEST_F(PageFaultManagerTest, givenCoalesceProtectionEnabledWhenMovingAdjacentAllocsToGpuDomainThenAllocsAreTransferredInAddressOrderAndProtectedTogether) {
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x11000);
+    void *alloc3 = reinterpret_cast<void *>(0x12000);
+    void *alloc4 = reinterpret_cast<void *>(0x20000);
+
+    memoryProperties.allocFlags.usmInitialPlacementCpu = 1;
+    pageFaultManager->insertAllocation(alloc4, 0x10, unifiedMemoryManager.get(), nullptr, memoryProperties);
+    pageFaultManager->insertAllocation(alloc2, 0x800, unifiedMemoryManager.get(), nullptr, memoryProperties);
+    pageFaultManager->insertAllocation(alloc3, 0x1000, unifiedMemoryManager.get(), nullptr, memoryProperties);
+    pageFaultManager->insertAllocation(alloc1, 0x1000, unifiedMemoryManager.get(), nullptr, memoryProperties);
+
+    pageFaultManager->coalesceProtection = true;
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 4);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, alloc4);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 2);
+    EXPECT_EQ(pageFaultManager->protectedMemoryAccessAddress, alloc4);
+    EXPECT_EQ(pageFaultManager->protectedSize, 0x10u);
+    EXPECT_EQ(unifiedMemoryManager->nonGpuDomainAllocs.size(), 0u);
+    for (auto &alloc : pageFaultManager->memoryData) {
+        EXPECT_EQ(alloc.second.domain, CpuPageFaultManager::AllocationDomain::gpu);
+    }
+}
+
+TEST_F(PageFaultManagerTest, givenCoalesceProtectionDisabledWhenMovingAdjacentAllocsToGpuDomainThenEachAllocIsProtectedSeparately) {
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x11000);
+
+    memoryProperties.allocFlags.usmInitialPlacementCpu = 1;
+    pageFaultManager->insertAllocation(alloc1, 0x1000, unifiedMemoryManager.get(), nullptr, memoryProperties);
+    pageFaultManager->insertAllocation(alloc2, 0x1000, unifiedMemoryManager.get(), nullptr, memoryProperties);
+
+    pageFaultManager->coalesceProtection = false;
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 2);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 2);
+    EXPECT_EQ(pageFaultManager->protectedMemoryAccessAddress, alloc2);
+    EXPECT_EQ(pageFaultManager->protectedSize, 0x1000u);
+}
+
+TEST_F(PageFaultManagerTest, givenFaultAheadCountWhenVerifyingPageFaultThenFollowingAllocsFromSameAllocsManagerAreTransferredToCpuDomain) {
+    auto unifiedMemoryManager2 = std::make_unique<SVMAllocsManager>(memoryManager.get(), false);
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x11000);
+    void *alloc3 = reinterpret_cast<void *>(0x12000);
+    void *alloc4 = reinterpret_cast<void *>(0x13000);
+    void *alloc5 = reinterpret_cast<void *>(0x14000);
+
+    pageFaultManager->insertAllocation(alloc1, 0x1000, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc2, 0x1000, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc3, 0x1000, unifiedMemoryManager2.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc4, 0x1000, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc5, 0x1000, unifiedMemoryManager.get(), nullptr, {});
+    for (auto &alloc : pageFaultManager->memoryData) {
+        alloc.second.domain = CpuPageFaultManager::AllocationDomain::gpu;
+    }
+
+    pageFaultManager->faultAheadCount = 2u;
+    EXPECT_TRUE(pageFaultManager->verifyAndHandlePageFault(ptrOffset(alloc1, 0x10), true));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 2);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc1).domain, CpuPageFaultManager::AllocationDomain::cpu);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc2).domain, CpuPageFaultManager::AllocationDomain::cpu);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc3).domain, CpuPageFaultManager::AllocationDomain::gpu);
+
+    EXPECT_TRUE(pageFaultManager->verifyAndHandlePageFault(alloc4, true));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 4);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, alloc5);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc5).domain, CpuPageFaultManager::AllocationDomain::cpu);
+}
+
+TEST_F(PageFaultManagerTest, givenPageFaultManagerDebugFlagsWhenCreatingPageFaultManagerThenFaultAheadAndCoalescingAreConfigured) {
+    EXPECT_EQ(0u, pageFaultManager->faultAheadCount);
+    EXPECT_FALSE(pageFaultManager->coalesceProtection);
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PageFaultManagerFaultAheadCount.set(4);
+    debugManager.flags.PageFaultManagerCoalesceProtection.set(1);
+    auto configuredPageFaultManager = std::make_unique<MockPageFaultManager>();
+    EXPECT_EQ(4u, configuredPageFaultManager->faultAheadCount);
+    EXPECT_TRUE(configuredPageFaultManager->coalesceProtection);
+}
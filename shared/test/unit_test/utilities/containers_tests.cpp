@@ -850,6 +850,44 @@ TEST(IDList, GivenNonThreadSafeWhenDetachingSequenceThenResultIsCorrect) {
     iDListTestDetachSequence<false>();
 }
 
+template <bool threadSafe>
+void iDListTestDetachFrontNodes() {
+    DummyDNode *nodes[10];
+    makeList(nodes);
+    IDList<DummyDNode, threadSafe, false, false> list(nodes[0]);
+
+    EXPECT_EQ(nullptr, list.detachFrontNodes(0u));
+    EXPECT_EQ(nodes[0], list.peekHead());
+
+    auto detachedNodes = list.detachFrontNodes(3u);
+    ASSERT_EQ(nodes[0], detachedNodes);
+    EXPECT_EQ(3u, detachedNodes->countThisAndAllConnected());
+    EXPECT_EQ(nullptr, nodes[0]->prev);
+    EXPECT_EQ(nullptr, nodes[2]->next);
+    EXPECT_EQ(nodes[3], list.peekHead());
+    EXPECT_EQ(nullptr, nodes[3]->prev);
+    EXPECT_EQ(nodes[9], list.peekTail());
+
+    detachedNodes = list.detachFrontNodes(100u);
+    ASSERT_EQ(nodes[3], detachedNodes);
+    EXPECT_EQ(7u, detachedNodes->countThisAndAllConnected());
+    EXPECT_TRUE(list.peekIsEmpty());
+    EXPECT_EQ(nullptr, list.peekTail());
+    EXPECT_EQ(nullptr, list.detachFrontNodes(1u));
+
+    for (auto n : nodes) {
+        delete n;
+    }
+}
+
+TEST(IDList, GivenThreadSafeWhenDetachingFrontNodesThenResultIsCorrect) {
+    iDListTestDetachFrontNodes<true>();
+}
+
+TEST(IDList, GivenNonThreadSafeWhenDetachingFrontNodesThenResultIsCorrect) {
+    iDListTestDetachFrontNodes<false>();
+}
+
 template <bool threadSafe>
 void iDListTestPeekContains() {
     IDList<DummyDNode, threadSafe, false, false> list;
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/utilities/cpu_copy_engine.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <numeric>
+#include <vector>
+
+using namespace NEO;
+
+struct MockCpuCopyEngine : public CpuCopyEngine {
+    using CpuCopyEngine::adaptiveThresholds;
+    using CpuCopyEngine::bandwidthStats;
+    using CpuCopyEngine::nonTemporalStoresMode;
+    using CpuCopyEngine::useNonTemporalStores;
+    using CpuCopyEngine::workerThreads;
+
+    ~MockCpuCopyEngine() override {
+        stopThreads();
+    }
+};
+
+namespace {
+std::vector<uint8_t> createPattern(size_t size) {
+    std::vector<uint8_t> pattern(size);
+    for (size_t i = 0; i < size; i++) {
+        pattern[i] = static_cast<uint8_t>((i * 7u) ^ (i >> 8));
+    }
+    return pattern;
+}
+} // namespace
+
+TEST(CpuCopyEngineTest, givenDebugFlagsSetWhenCreatingEngineThenDefaultsAreOverridden) {
+    {
+        MockCpuCopyEngine engine;
+        EXPECT_GE(CpuCopyEngine::defaultMaxWorkersCount, engine.getWorkersCount());
+        EXPECT_EQ(CpuCopyEngine::defaultMinChunkSize, engine.getMinChunkSize());
+        EXPECT_FALSE(engine.adaptiveThresholds);
+        EXPECT_TRUE(engine.useNonTemporalStores(true));
+        EXPECT_FALSE(engine.useNonTemporalStores(false));
+    }
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuCopyEngineWorkersCount.set(5);
+    debugManager.flags.CpuCopyEngineMinChunkSize.set(4096);
+    debugManager.flags.CpuCopyEngineAdaptiveThresholds.set(1);
+    debugManager.flags.CpuCopyEngineNonTemporalStores.set(1);
+    MockCpuCopyEngine engine;
+    EXPECT_EQ(5u, engine.getWorkersCount());
+    EXPECT_EQ(4096u, engine.getMinChunkSize());
+    EXPECT_TRUE(engine.adaptiveThresholds);
+    EXPECT_TRUE(engine.useNonTemporalStores(false));
+
+    debugManager.flags.CpuCopyEngineNonTemporalStores.set(0);
+    MockCpuCopyEngine engineWithoutNonTemporalStores;
+    EXPECT_FALSE(engineWithoutNonTemporalStores.useNonTemporalStores(true));
+}
+
+TEST(CpuCopyEngineTest, givenUnalignedPointersAndSizesWhenCopyingNonTemporalThenAllBytesAreCopied) {
+    auto src = createPattern(1024);
+    for (size_t dstOffset : {0u, 1u, 15u}) {
+        for (size_t srcOffset : {0u, 3u}) {
+            for (size_t size : {0u, 5u, 16u, 63u, 64u, 200u, 900u}) {
+                std::vector<uint8_t> dst(1024, 0u);
+                CpuCopyEngine::copyNonTemporal(dst.data() + dstOffset, src.data() + srcOffset, size);
+                EXPECT_EQ(0, memcmp(dst.data() + dstOffset, src.data() + srcOffset, size));
+                EXPECT_EQ(0u, std::accumulate(dst.begin(), dst.begin() + dstOffset, 0u));
+                EXPECT_EQ(0u, std::accumulate(dst.begin() + dstOffset + size, dst.end(), 0u));
+            }
+        }
+    }
+}
+
+TEST(CpuCopyEngineTest, givenWorkersStartedWhenCopyingLargeRangeThenRangeIsCopiedInParallelAndBandwidthIsMeasured) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuCopyEngineWorkersCount.set(2);
+    debugManager.flags.CpuCopyEngineMinChunkSize.set(4096);
+    debugManager.flags.CpuCopyEngineAdaptiveThresholds.set(1);
+    MockCpuCopyEngine engine;
+    engine.startThreads();
+    EXPECT_EQ(2u, engine.workerThreads.size());
+
+    const size_t size = 4 * MemoryConstants::megaByte + 123;
+    auto src = createPattern(size);
+    for (auto writeCombinedDst : {false, true}) {
+        auto &stats = engine.bandwidthStats[writeCombinedDst ? 1 : 0];
+
+        // first measured copy samples serial bandwidth
+        std::vector<uint8_t> dst(size + 1, 0u);
+        engine.copy(dst.data() + 1, src.data(), size, writeCombinedDst);
+        EXPECT_EQ(0, memcmp(dst.data() + 1, src.data(), size));
+        EXPECT_EQ(0u, dst[0]);
+        EXPECT_NE(0u, stats.serialBytesPerUs.load());
+        EXPECT_EQ(0u, stats.parallelBytesPerUs.load());
+
+        std::fill(dst.begin(), dst.end(), 0u);
+        engine.copy(dst.data() + 1, src.data(), size, writeCombinedDst);
+        EXPECT_EQ(0, memcmp(dst.data() + 1, src.data(), size));
+        EXPECT_EQ(0u, dst[0]);
+        EXPECT_NE(0u, stats.parallelBytesPerUs.load());
+        EXPECT_EQ(2u, stats.measuredCopiesCount.load());
+    }
+
+    engine.stopThreads();
+    EXPECT_TRUE(engine.workerThreads.empty());
+}
+
+TEST(CpuCopyEngineTest, givenWorkersStartedWhenCopyingRangeTooSmallToSplitThenBandwidthIsNotMeasured) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuCopyEngineWorkersCount.set(1);
+    debugManager.flags.CpuCopyEngineAdaptiveThresholds.set(1);
+    MockCpuCopyEngine engine;
+    engine.startThreads();
+
+    const size_t size = 2 * CpuCopyEngine::defaultMinChunkSize - 1;
+    auto src = createPattern(size);
+    std::vector<uint8_t> dst(size, 0u);
+    engine.copy(dst.data(), src.data(), size, false);
+    EXPECT_EQ(0, memcmp(dst.data(), src.data(), size));
+    EXPECT_EQ(0u, engine.bandwidthStats[0].serialBytesPerUs.load());
+    EXPECT_EQ(0u, engine.bandwidthStats[0].measuredCopiesCount.load());
+}
+
+TEST(CpuCopyEngineTest, givenNoWorkersWhenCopyingLargeRangeThenRangeIsCopiedSeriallyAndBandwidthIsNotMeasured) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuCopyEngineWorkersCount.set(0);
+    debugManager.flags.CpuCopyEngineAdaptiveThresholds.set(1);
+    MockCpuCopyEngine engine;
+    engine.startThreads();
+    EXPECT_TRUE(engine.workerThreads.empty());
+
+    const size_t size = 4 * MemoryConstants::megaByte;
+    auto src = createPattern(size);
+    std::vector<uint8_t> dst(size, 0u);
+    engine.copy(dst.data(), src.data(), size, true);
+    EXPECT_EQ(0, memcmp(dst.data(), src.data(), size));
+    EXPECT_EQ(0u, engine.bandwidthStats[1].serialBytesPerUs.load());
+    EXPECT_EQ(0u, engine.bandwidthStats[1].parallelBytesPerUs.load());
+    EXPECT_EQ(MemoryConstants::megaByte, engine.scaleTransferThreshold(MemoryConstants::megaByte, true));
+}
+
+TEST(CpuCopyEngineTest, givenMeasuredBandwidthWhenScalingTransferThresholdThenThresholdGrowsWithParallelSpeedupUpToLimit) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuCopyEngineWorkersCount.set(1);
+    debugManager.flags.CpuCopyEngineAdaptiveThresholds.set(1);
+    MockCpuCopyEngine engine;
+    engine.startThreads();
+    const size_t threshold = MemoryConstants::megaByte;
+
+    EXPECT_EQ(threshold, engine.scaleTransferThreshold(threshold, true));
+
+    engine.bandwidthStats[1].serialBytesPerUs = 1000u;
+    engine.bandwidthStats[1].parallelBytesPerUs = 800u;
+    EXPECT_EQ(threshold, engine.scaleTransferThreshold(threshold, true));
+
+    engine.bandwidthStats[1].parallelBytesPerUs = 3000u;
+    EXPECT_EQ(3 * threshold, engine.scaleTransferThreshold(threshold, true));
+    EXPECT_EQ(threshold, engine.scaleTransferThreshold(threshold, false));
+
+    engine.bandwidthStats[1].parallelBytesPerUs = 1000000u;
+    EXPECT_EQ(CpuCopyEngine::maxThresholdScale * threshold, engine.scaleTransferThreshold(threshold, true));
+
+    engine.adaptiveThresholds = false;
+    EXPECT_EQ(threshold, engine.scaleTransferThreshold(threshold, true));
+}
+
+TEST(CpuCopyEngineTest, givenEnableCpuCopyEngineFlagWhenInitializingEngineInExecutionEnvironmentThenFlagIsRespected) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuCopyEngineWorkersCount.set(0);
+    {
+        EXPECT_FALSE(CpuCopyEngine::isSupported());
+        ExecutionEnvironment executionEnvironment;
+        EXPECT_EQ(nullptr, executionEnvironment.initializeCpuCopyEngine());
+    }
+    {
+        debugManager.flags.EnableCpuCopyEngine.set(0);
+        ExecutionEnvironment executionEnvironment;
+        EXPECT_EQ(nullptr, executionEnvironment.initializeCpuCopyEngine());
+    }
+    {
+        debugManager.flags.EnableCpuCopyEngine.set(1);
+        ExecutionEnvironment executionEnvironment;
+        auto engine = executionEnvironment.initializeCpuCopyEngine();
+        EXPECT_NE(nullptr, engine);
+        EXPECT_EQ(engine, executionEnvironment.initializeCpuCopyEngine());
+    }
+}
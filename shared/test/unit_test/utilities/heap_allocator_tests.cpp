@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,10 +7,13 @@
 
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/utilities/heap_allocator.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <random>
 
@@ -40,6 +43,7 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
 
     using HeapAllocator::allocationAlignment;
+    using HeapAllocator::segregatedFreeChunks;
     size_t sizeOfFreedChunk = 0;
 };
 
@@ -1453,4 +1457,124 @@ TEST(HeapAllocatorTest, whenGetBaseAddressIsCalledThenReturnInitialBaseAddress)
     size_t smallChunk = 4096;
     EXPECT_NE(0u, heapAllocator.allocate(smallChunk));
     EXPECT_EQ(heapBase, heapAllocator.getBaseAddress());
-}
\ No newline at end of file
+}
+
+TEST(HeapAllocatorTest, givenSegregatedFreeChunksEnabledWhenCreatingHeapAllocatorThenSegregatedFreeChunksAreUsed) {
+    {
+        HeapAllocatorUnderTest heapAllocator(0x100000llu, 1024 * 4096, allocationAlignment, sizeThreshold);
+        EXPECT_FALSE(heapAllocator.usesSegregatedFreeChunks());
+    }
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHeapAllocatorSegregatedFreeChunks.set(1);
+    HeapAllocatorUnderTest heapAllocator(0x100000llu, 1024 * 4096, allocationAlignment, sizeThreshold);
+    EXPECT_TRUE(heapAllocator.usesSegregatedFreeChunks());
+}
+
+TEST(HeapAllocatorTest, givenSegregatedFreeChunksWhenFreeingAllocationsInRandomOrderThenBoundsAreRestored) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHeapAllocatorSegregatedFreeChunks.set(1);
+
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 1024 * 4096;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, sizeThreshold);
+
+    std::vector<std::pair<uint64_t, size_t>> allocations;
+    for (auto i = 0u; i < 32; i++) {
+        size_t allocationSize = (i % 2) ? 4096 * (i % 5 + 1) : sizeThreshold + 4096 * (i % 3 + 1);
+        auto ptr = heapAllocator.allocate(allocationSize);
+        ASSERT_NE(0u, ptr);
+        allocations.emplace_back(ptr, allocationSize);
+    }
+
+    std::shuffle(allocations.begin(), allocations.end(), std::mt19937(0));
+    for (auto i = 0u; i < allocations.size() / 2; i++) {
+        heapAllocator.free(allocations[i].first, allocations[i].second);
+    }
+    EXPECT_NE(0u, heapAllocator.segregatedFreeChunks->getChunksCount());
+
+    size_t reusedSize = allocations[0].second;
+    auto reusedPtr = heapAllocator.allocate(reusedSize);
+    EXPECT_NE(0u, reusedPtr);
+    heapAllocator.free(reusedPtr, reusedSize);
+
+    for (auto i = allocations.size() / 2; i < allocations.size(); i++) {
+        heapAllocator.free(allocations[i].first, allocations[i].second);
+    }
+
+    EXPECT_EQ(0u, heapAllocator.segregatedFreeChunks->getChunksCount());
+    EXPECT_EQ(heapBase, heapAllocator.getLeftBound());
+    EXPECT_EQ(heapBase + heapSize, heapAllocator.getRightBound());
+    EXPECT_EQ(heapSize, heapAllocator.getavailableSize());
+}
+
+TEST(HeapAllocatorTest, givenSegregatedFreeChunksWhenAllocatingWithCustomAlignmentThenFreedChunksAreReused) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHeapAllocatorSegregatedFreeChunks.set(1);
+
+    const uint64_t heapBase = 0x100000llu;
+    const size_t heapSize = 3 * MemoryConstants::pageSize64k;
+    HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, allocationAlignment, 0);
+
+    size_t firstSize = MemoryConstants::pageSize;
+    auto first = heapAllocator.allocateWithCustomAlignment(firstSize, MemoryConstants::pageSize64k);
+    EXPECT_TRUE(isAligned(first, MemoryConstants::pageSize64k));
+    size_t secondSize = MemoryConstants::pageSize64k;
+    auto second = heapAllocator.allocateWithCustomAlignment(secondSize, MemoryConstants::pageSize64k);
+    EXPECT_TRUE(isAligned(second, MemoryConstants::pageSize64k));
+    size_t guardSize = MemoryConstants::pageSize;
+    auto guard = heapAllocator.allocate(guardSize);
+    EXPECT_NE(0u, guard);
+
+    heapAllocator.free(second, secondSize);
+    size_t reusedSize = MemoryConstants::pageSize64k;
+    EXPECT_EQ(second, heapAllocator.allocateWithCustomAlignment(reusedSize, MemoryConstants::pageSize64k));
+
+    heapAllocator.free(second, reusedSize);
+    heapAllocator.free(guard, guardSize);
+    heapAllocator.free(first, firstSize);
+    EXPECT_EQ(heapSize, heapAllocator.getavailableSize());
+    EXPECT_EQ(0u, heapAllocator.segregatedFreeChunks->getChunksCount());
+}
+
+TEST(HeapAllocatorBenchmark, DISABLED_givenFragmentedHeapWhenAllocatingAndFreeingThenReportLatencyAndFragmentation) {
+    const uint64_t heapBase = 0x100000000llu;
+    const size_t heapSize = 4 * MemoryConstants::gigaByte;
+    const uint32_t iterations = 200000u;
+
+    for (auto segregated : {0, 1}) {
+        DebugManagerStateRestore restorer;
+        debugManager.flags.EnableHeapAllocatorSegregatedFreeChunks.set(segregated);
+        HeapAllocatorUnderTest heapAllocator(heapBase, heapSize, MemoryConstants::pageSize64k, 4 * MemoryConstants::megaByte);
+
+        std::mt19937 generator(0);
+        std::uniform_int_distribution<uint32_t> sizeDistribution(1, 128);
+        std::vector<std::pair<uint64_t, size_t>> liveAllocations;
+        liveAllocations.reserve(iterations);
+
+        auto start = std::chrono::steady_clock::now();
+        for (auto i = 0u; i < iterations; i++) {
+            if (!liveAllocations.empty() && generator() % 3 == 0) {
+                auto index = generator() % liveAllocations.size();
+                heapAllocator.free(liveAllocations[index].first, liveAllocations[index].second);
+                liveAllocations[index] = liveAllocations.back();
+                liveAllocations.pop_back();
+            } else {
+                size_t allocationSize = sizeDistribution(generator) * MemoryConstants::pageSize64k;
+                auto ptr = heapAllocator.allocate(allocationSize);
+                if (ptr) {
+                    liveAllocations.emplace_back(ptr, allocationSize);
+                }
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        auto holes = segregated ? heapAllocator.segregatedFreeChunks->getChunksCount() : heapAllocator.getFreedChunksSmall().size() + heapAllocator.getFreedChunksBig().size();
+        std::cout << (segregated ? "segregated" : "vector") << " free chunks: " << elapsed / iterations << " ns/op, "
+                  << "live allocations: " << liveAllocations.size() << ", free chunks: " << holes
+                  << ", usage: " << heapAllocator.getUsage() << std::endl;
+
+        for (auto &allocation : liveAllocations) {
+            heapAllocator.free(allocation.first, allocation.second);
+        }
+    }
+}
@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/perf_trace.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <sstream>
+#include <thread>
+
+using namespace NEO;
+
+namespace {
+struct MockPerfTracer : public PerfTracer {
+    using PerfTracer::activeTracer;
+    using PerfTracer::flushThread;
+    using PerfTracer::PerfTracer;
+};
+
+struct CapturingStream : public std::stringstream {
+    CapturingStream(std::string &capturedData) : capturedData(capturedData) {}
+    ~CapturingStream() override {
+        capturedData = str();
+    }
+    std::string &capturedData;
+};
+
+struct ParsedPerfTrace {
+    std::vector<std::string> names;
+    std::vector<PerfTracer::FileRecord> records;
+    std::vector<std::pair<uint32_t, uint64_t>> droppedRecords;
+    uint64_t footerDroppedRecordsCount = 0u;
+    uint32_t calibrationsCount = 0u;
+    uint32_t footersCount = 0u;
+    bool validHeader = false;
+};
+
+ParsedPerfTrace parsePerfTrace(const std::string &data) {
+    ParsedPerfTrace trace;
+    PerfTracer::FileHeader header = {};
+    if (data.size() < sizeof(header)) {
+        return trace;
+    }
+    memcpy(&header, data.data(), sizeof(header));
+    trace.validHeader = (0 == memcmp(header.magic, PerfTracer::fileMagic, sizeof(header.magic))) && header.version == PerfTracer::fileVersion;
+
+    size_t offset = sizeof(header);
+    auto read = [&](void *dst, size_t size) {
+        memcpy(dst, data.data() + offset, size);
+        offset += size;
+    };
+    while (offset < data.size()) {
+        uint32_t chunkType = 0u;
+        read(&chunkType, sizeof(chunkType));
+        if (chunkType == static_cast<uint32_t>(PerfTracer::ChunkType::name)) {
+            uint32_t nameHeader[2] = {};
+            read(nameHeader, sizeof(nameHeader));
+            EXPECT_EQ(trace.names.size(), nameHeader[0]);
+            trace.names.emplace_back(data.data() + offset, nameHeader[1]);
+            offset += nameHeader[1];
+        } else if (chunkType == static_cast<uint32_t>(PerfTracer::ChunkType::calibration)) {
+            uint64_t calibration[2] = {};
+            read(calibration, sizeof(calibration));
+            trace.calibrationsCount++;
+        } else if (chunkType == static_cast<uint32_t>(PerfTracer::ChunkType::droppedRecords)) {
+            uint32_t threadIndex = 0u;
+            uint64_t droppedCount = 0u;
+            read(&threadIndex, sizeof(threadIndex));
+            read(&droppedCount, sizeof(droppedCount));
+            trace.droppedRecords.emplace_back(threadIndex, droppedCount);
+        } else if (chunkType == static_cast<uint32_t>(PerfTracer::ChunkType::footer)) {
+            read(&trace.footerDroppedRecordsCount, sizeof(trace.footerDroppedRecordsCount));
+            trace.footersCount++;
+        } else {
+            EXPECT_EQ(static_cast<uint32_t>(PerfTracer::ChunkType::records), chunkType);
+            uint32_t count = 0u;
+            read(&count, sizeof(count));
+            for (uint32_t i = 0; i < count; i++) {
+                PerfTracer::FileRecord record = {};
+                read(&record, sizeof(record));
+                trace.records.push_back(record);
+            }
+        }
+    }
+    return trace;
+}
+} // namespace
+
+TEST(PerfTraceRingBufferTest, givenRingBufferWhenPushingAndPoppingRecordsThenRecordsAreReturnedInOrderAndOverflowIsDropped) {
+    PerfTraceRingBuffer ringBuffer(3u, 7u);
+    EXPECT_EQ(4u, ringBuffer.getCapacity());
+    EXPECT_EQ(7u, ringBuffer.getThreadIndex());
+
+    for (uint64_t i = 0; i < 5u; i++) {
+        EXPECT_EQ(i < 4u, ringBuffer.push({i, "record", 0u, PerfTraceEventType::api, PerfTracePhase::enter}));
+    }
+    EXPECT_EQ(1u, ringBuffer.getDroppedCount());
+
+    PerfTraceRecord records[4] = {};
+    EXPECT_EQ(3u, ringBuffer.pop(records, 3u));
+    EXPECT_EQ(0u, records[0].timestamp);
+    EXPECT_EQ(2u, records[2].timestamp);
+
+    EXPECT_TRUE(ringBuffer.push({10u, "record", 0u, PerfTraceEventType::api, PerfTracePhase::leave}));
+    EXPECT_EQ(2u, ringBuffer.pop(records, 4u));
+    EXPECT_EQ(3u, records[0].timestamp);
+    EXPECT_EQ(10u, records[1].timestamp);
+    EXPECT_EQ(PerfTracePhase::leave, records[1].phase);
+    EXPECT_EQ(0u, ringBuffer.pop(records, 4u));
+}
+
+TEST(PerfTracerTest, givenRecordedEventsWhenFlushingThenNamesAreWrittenOnceAndRecordsReferToThem) {
+    auto output = std::make_unique<std::stringstream>();
+    auto outputStream = output.get();
+    MockPerfTracer tracer(std::move(output), 16u);
+
+    tracer.record(PerfTraceEventType::api, PerfTracePhase::enter, "apiCall", 0u);
+    tracer.record(PerfTraceEventType::system, PerfTracePhase::enter, "ioctl", 0u);
+    tracer.record(PerfTraceEventType::system, PerfTracePhase::leave, "ioctl", 5u);
+    tracer.record(PerfTraceEventType::api, PerfTracePhase::leave, "apiCall", 0u);
+    EXPECT_EQ(1u, tracer.getThreadBuffersCount());
+    tracer.flush();
+
+    tracer.record(PerfTraceEventType::api, PerfTracePhase::enter, "apiCall", 0u);
+    tracer.flush();
+
+    auto trace = parsePerfTrace(outputStream->str());
+    EXPECT_TRUE(trace.validHeader);
+    EXPECT_EQ(3u, trace.calibrationsCount);
+    ASSERT_EQ(2u, trace.names.size());
+    EXPECT_EQ("apiCall", trace.names[0]);
+    EXPECT_EQ("ioctl", trace.names[1]);
+
+    ASSERT_EQ(5u, trace.records.size());
+    EXPECT_EQ(0u, trace.records[0].nameId);
+    EXPECT_EQ(static_cast<uint16_t>(PerfTraceEventType::api), trace.records[0].type);
+    EXPECT_EQ(static_cast<uint16_t>(PerfTracePhase::enter), trace.records[0].phase);
+    EXPECT_EQ(1u, trace.records[2].nameId);
+    EXPECT_EQ(static_cast<uint16_t>(PerfTraceEventType::system), trace.records[2].type);
+    EXPECT_EQ(static_cast<uint16_t>(PerfTracePhase::leave), trace.records[2].phase);
+    EXPECT_EQ(5u, trace.records[2].payload);
+    EXPECT_EQ(0u, trace.records[4].nameId);
+    for (auto &record : trace.records) {
+        EXPECT_EQ(0u, record.threadIndex);
+    }
+}
+
+TEST(PerfTracerTest, givenFullThreadBufferWhenRecordingThenRecordsAreDroppedAndCounted) {
+    MockPerfTracer tracer(std::make_unique<std::stringstream>(), 2u);
+    for (uint32_t i = 0; i < 3u; i++) {
+        tracer.record(PerfTraceEventType::wait, PerfTracePhase::enter, "wait", 0u);
+    }
+    EXPECT_EQ(1u, tracer.getDroppedRecordsCount());
+    tracer.flush();
+    tracer.record(PerfTraceEventType::wait, PerfTracePhase::leave, "wait", 0u);
+    EXPECT_EQ(1u, tracer.getDroppedRecordsCount());
+}
+
+TEST(PerfTracerTest, givenDroppedRecordsWhenFlushingAndClosingThenDroppedCountsAreWrittenPerThreadAndInFooter) {
+    std::string capturedData;
+    MockPerfTracer tracer(std::make_unique<CapturingStream>(capturedData), 2u);
+
+    for (uint32_t i = 0; i < 3u; i++) {
+        tracer.record(PerfTraceEventType::wait, PerfTracePhase::enter, "wait", 0u);
+    }
+    tracer.flush();
+    tracer.flush();
+
+    std::thread recordingThread([&tracer]() {
+        for (uint32_t i = 0; i < 4u; i++) {
+            tracer.record(PerfTraceEventType::wait, PerfTracePhase::enter, "threadWait", 0u);
+        }
+    });
+    recordingThread.join();
+    for (uint32_t i = 0; i < 3u; i++) {
+        tracer.record(PerfTraceEventType::wait, PerfTracePhase::leave, "wait", 0u);
+    }
+    tracer.close();
+
+    auto trace = parsePerfTrace(capturedData);
+    EXPECT_TRUE(trace.validHeader);
+    EXPECT_EQ(6u, trace.records.size());
+    ASSERT_EQ(3u, trace.droppedRecords.size());
+    EXPECT_EQ(0u, trace.droppedRecords[0].first);
+    EXPECT_EQ(1u, trace.droppedRecords[0].second);
+    EXPECT_EQ(0u, trace.droppedRecords[1].first);
+    EXPECT_EQ(2u, trace.droppedRecords[1].second);
+    EXPECT_EQ(1u, trace.droppedRecords[2].first);
+    EXPECT_EQ(2u, trace.droppedRecords[2].second);
+    EXPECT_EQ(1u, trace.footersCount);
+    EXPECT_EQ(4u, trace.footerDroppedRecordsCount);
+}
+
+TEST(PerfTracerTest, givenActiveTracerWhenUsingTraceScopeThenEnterAndLeaveAreRecorded) {
+    auto output = std::make_unique<std::stringstream>();
+    auto outputStream = output.get();
+    MockPerfTracer tracer(std::move(output), 16u);
+
+    PerfTracer::traceEvent(PerfTraceEventType::flush, PerfTracePhase::enter, "notRecorded", 0u);
+    MockPerfTracer::activeTracer.store(&tracer);
+    EXPECT_EQ(&tracer, PerfTracer::getActive());
+    {
+        PerfTraceScope scope(PerfTraceEventType::flush, "scope");
+    }
+    MockPerfTracer::activeTracer.store(nullptr);
+    EXPECT_EQ(nullptr, PerfTracer::getActive());
+    tracer.flush();
+
+    auto trace = parsePerfTrace(outputStream->str());
+    ASSERT_EQ(1u, trace.names.size());
+    EXPECT_EQ("scope", trace.names[0]);
+    ASSERT_EQ(2u, trace.records.size());
+    EXPECT_EQ(static_cast<uint16_t>(PerfTracePhase::enter), trace.records[0].phase);
+    EXPECT_EQ(static_cast<uint16_t>(PerfTracePhase::leave), trace.records[1].phase);
+}
+
+TEST(PerfTracerTest, givenPerfTraceFileNotSetWhenAcquiringThenNoTracerIsActive) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PerfTraceFile.set("unk");
+    PerfTracer::acquire();
+    EXPECT_EQ(nullptr, PerfTracer::getActive());
+    PerfTracer::release();
+}
+
+TEST(PerfTracerTest, givenTracerWhenStartingAndStoppingThreadThenThreadIsCreatedAndReleased) {
+    VariableBackup<decltype(NEO::Thread::createFunc)> funcBackup{&NEO::Thread::createFunc, [](void *(*func)(void *), void *arg) -> std::unique_ptr<Thread> { return nullptr; }};
+    MockPerfTracer tracer(std::make_unique<std::stringstream>(), 16u);
+    tracer.startThread();
+    tracer.stopThread();
+    EXPECT_EQ(nullptr, tracer.flushThread.get());
+}
+
+TEST(PerfTracerTest, givenThreadWhichRecordedEventsWhenThreadExitsThenItsBufferIsFreedAfterNextFlush) {
+    auto output = std::make_unique<std::stringstream>();
+    auto outputStream = output.get();
+    MockPerfTracer tracer(std::move(output), 16u);
+
+    std::thread recordingThread([&tracer]() {
+        tracer.record(PerfTraceEventType::api, PerfTracePhase::enter, "threadCall", 0u);
+        tracer.record(PerfTraceEventType::api, PerfTracePhase::leave, "threadCall", 0u);
+    });
+    recordingThread.join();
+    EXPECT_EQ(1u, tracer.getThreadBuffersCount());
+
+    tracer.flush();
+    EXPECT_EQ(0u, tracer.getThreadBuffersCount());
+
+    auto trace = parsePerfTrace(outputStream->str());
+    ASSERT_EQ(1u, trace.names.size());
+    EXPECT_EQ("threadCall", trace.names[0]);
+    EXPECT_EQ(2u, trace.records.size());
+}
+
+TEST(PerfTracerTest, givenClosedTracerWhenRecordingThenRecordsAreIgnoredAndBuffersAreFreed) {
+    std::string capturedData;
+    MockPerfTracer tracer(std::make_unique<CapturingStream>(capturedData), 16u);
+
+    tracer.record(PerfTraceEventType::api, PerfTracePhase::enter, "beforeClose", 0u);
+    EXPECT_EQ(1u, tracer.getThreadBuffersCount());
+    EXPECT_FALSE(tracer.isClosed());
+
+    tracer.close();
+    EXPECT_TRUE(tracer.isClosed());
+    EXPECT_EQ(0u, tracer.getThreadBuffersCount());
+
+    tracer.record(PerfTraceEventType::api, PerfTracePhase::leave, "afterClose", 0u);
+    tracer.flush();
+    EXPECT_EQ(0u, tracer.getThreadBuffersCount());
+
+    auto trace = parsePerfTrace(capturedData);
+    EXPECT_TRUE(trace.validHeader);
+    ASSERT_EQ(1u, trace.names.size());
+    EXPECT_EQ("beforeClose", trace.names[0]);
+    EXPECT_EQ(1u, trace.records.size());
+}
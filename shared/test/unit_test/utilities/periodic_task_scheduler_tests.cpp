@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/periodic_task_scheduler.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+struct MockPeriodicTaskScheduler : public PeriodicTaskScheduler {
+    using PeriodicTaskScheduler::coalescingWindow;
+    using PeriodicTaskScheduler::runDueTasks;
+    using PeriodicTaskScheduler::schedulerThreads;
+    using PeriodicTaskScheduler::tasks;
+    using PeriodicTaskScheduler::tasksMutex;
+    using PeriodicTaskScheduler::wakeupsCount;
+
+    SteadyClock::time_point runDueTasks(SteadyClock::time_point now) {
+        std::unique_lock<std::mutex> lock(tasksMutex);
+        return PeriodicTaskScheduler::runDueTasks(lock, now);
+    }
+};
+
+static uint32_t threadsCreated = 0u;
+static std::unique_ptr<Thread> createNoThread(void *(*func)(void *), void *arg) {
+    threadsCreated++;
+    return nullptr;
+}
+
+TEST(PeriodicTaskSchedulerTest, givenDebugFlagSetWhenCreatingSchedulerThenCoalescingWindowIsOverridden) {
+    {
+        MockPeriodicTaskScheduler scheduler;
+        EXPECT_EQ(std::chrono::microseconds(PeriodicTaskScheduler::defaultCoalescingWindow), scheduler.getCoalescingWindow());
+    }
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PeriodicTaskSchedulerCoalescingWindowUs.set(500);
+    MockPeriodicTaskScheduler scheduler;
+    EXPECT_EQ(std::chrono::microseconds(500), scheduler.getCoalescingWindow());
+}
+
+TEST(PeriodicTaskSchedulerTest, givenRegisteredTasksWhenRunningDueTasksThenOnlyTasksWithinCoalescingWindowAreExecuted) {
+    MockPeriodicTaskScheduler scheduler;
+    scheduler.coalescingWindow = std::chrono::milliseconds(10);
+
+    uint32_t shortTaskRuns = 0u;
+    uint32_t coalescedTaskRuns = 0u;
+    uint32_t longTaskRuns = 0u;
+    auto shortTask = scheduler.registerTask([&]() { shortTaskRuns++; }, std::chrono::milliseconds(100));
+    auto coalescedTask = scheduler.registerTask([&]() { coalescedTaskRuns++; }, std::chrono::milliseconds(105));
+    auto longTask = scheduler.registerTask([&]() { longTaskRuns++; }, std::chrono::seconds(2));
+    EXPECT_NE(shortTask, coalescedTask);
+    EXPECT_NE(coalescedTask, longTask);
+    EXPECT_EQ(3u, scheduler.getTasksCount());
+
+    auto start = scheduler.tasks.front().nextRun - std::chrono::milliseconds(100);
+    auto nextWakeup = scheduler.runDueTasks(start);
+    EXPECT_EQ(0u, shortTaskRuns + coalescedTaskRuns + longTaskRuns);
+    EXPECT_EQ(0u, scheduler.wakeupsCount);
+    EXPECT_EQ(scheduler.tasks.front().nextRun, nextWakeup);
+
+    auto now = start + std::chrono::milliseconds(100);
+    nextWakeup = scheduler.runDueTasks(now);
+    EXPECT_EQ(1u, shortTaskRuns);
+    EXPECT_EQ(1u, coalescedTaskRuns);
+    EXPECT_EQ(0u, longTaskRuns);
+    EXPECT_EQ(1u, scheduler.wakeupsCount);
+    EXPECT_EQ(now + std::chrono::milliseconds(100), nextWakeup);
+
+    scheduler.unregisterTask(shortTask);
+    scheduler.unregisterTask(coalescedTask);
+    scheduler.unregisterTask(longTask);
+    EXPECT_EQ(0u, scheduler.getTasksCount());
+    EXPECT_EQ(PeriodicTaskScheduler::SteadyClock::time_point::max(), scheduler.runDueTasks(now));
+}
+
+TEST(PeriodicTaskSchedulerTest, givenUnknownTaskIdWhenUnregisteringThenTasksAreNotChanged) {
+    MockPeriodicTaskScheduler scheduler;
+    auto taskId = scheduler.registerTask([]() {}, std::chrono::seconds(1));
+    scheduler.unregisterTask(PeriodicTaskScheduler::invalidTaskId);
+    scheduler.unregisterTask(taskId + 1);
+    EXPECT_EQ(1u, scheduler.getTasksCount());
+}
+
+TEST(PeriodicTaskSchedulerTest, givenSchedulerWhenStartingAndStoppingThreadThenThreadIsCreatedAndReleased) {
+    threadsCreated = 0u;
+    VariableBackup<decltype(NEO::Thread::createFunc)> funcBackup{&NEO::Thread::createFunc, createNoThread};
+    MockPeriodicTaskScheduler scheduler;
+    EXPECT_EQ(1u, scheduler.getThreadsCount());
+    scheduler.startThread();
+    EXPECT_EQ(1u, threadsCreated);
+    scheduler.stopThread();
+    EXPECT_TRUE(scheduler.schedulerThreads.empty());
+}
+
+TEST(PeriodicTaskSchedulerTest, givenDebugFlagsSetWhenStartingSchedulerThenRequestedNumberOfThreadsIsCreatedWithAffinityMask) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PeriodicTaskSchedulerThreadsCount.set(3);
+    debugManager.flags.PeriodicTaskSchedulerCpuAffinityMask.set(0x5);
+
+    threadsCreated = 0u;
+    VariableBackup<decltype(NEO::Thread::createFunc)> funcBackup{&NEO::Thread::createFunc, createNoThread};
+    MockPeriodicTaskScheduler scheduler;
+    EXPECT_EQ(3u, scheduler.getThreadsCount());
+    EXPECT_EQ(0x5u, scheduler.getCpuAffinityMask());
+    scheduler.startThread();
+    EXPECT_EQ(3u, threadsCreated);
+    scheduler.stopThread();
+}
+
+TEST(PeriodicTaskSchedulerTest, givenOnDemandTaskWhenRunningDueTasksThenTaskIsExecutedOnlyAfterNotification) {
+    MockPeriodicTaskScheduler scheduler;
+    uint32_t taskRuns = 0u;
+    auto taskId = scheduler.registerTask([&]() { taskRuns++; }, PeriodicTaskScheduler::onDemandPeriod);
+
+    auto now = PeriodicTaskScheduler::SteadyClock::now();
+    EXPECT_EQ(PeriodicTaskScheduler::SteadyClock::time_point::max(), scheduler.runDueTasks(now));
+    EXPECT_EQ(0u, taskRuns);
+
+    scheduler.notifyTask(taskId);
+    EXPECT_EQ(PeriodicTaskScheduler::SteadyClock::time_point::max(), scheduler.runDueTasks(now));
+    EXPECT_EQ(1u, taskRuns);
+
+    scheduler.runDueTasks(now);
+    EXPECT_EQ(1u, taskRuns);
+    scheduler.unregisterTask(taskId);
+}
+
+TEST(PeriodicTaskSchedulerTest, givenTaskNotifiedWhileRunningWhenTaskFinishesThenTaskIsDueAgain) {
+    MockPeriodicTaskScheduler scheduler;
+    uint32_t taskRuns = 0u;
+    PeriodicTaskScheduler::TaskId taskId = PeriodicTaskScheduler::invalidTaskId;
+    auto task = [&]() {
+        if (taskRuns++ == 0u) {
+            scheduler.notifyTask(taskId);
+        }
+    };
+    taskId = scheduler.registerTask(task, PeriodicTaskScheduler::onDemandPeriod);
+    scheduler.notifyTask(taskId);
+
+    auto now = PeriodicTaskScheduler::SteadyClock::now();
+    EXPECT_EQ(PeriodicTaskScheduler::SteadyClock::time_point::min(), scheduler.runDueTasks(now));
+    EXPECT_EQ(1u, taskRuns);
+    EXPECT_EQ(PeriodicTaskScheduler::SteadyClock::time_point::max(), scheduler.runDueTasks(now));
+    EXPECT_EQ(2u, taskRuns);
+    scheduler.unregisterTask(taskId);
+}
+
+TEST(PeriodicTaskSchedulerTest, givenTaskWithPeriodShorterThanCoalescingWindowWhenRunningDueTasksThenTaskIsExecutedOncePerWakeup) {
+    MockPeriodicTaskScheduler scheduler;
+    scheduler.coalescingWindow = std::chrono::milliseconds(10);
+    uint32_t taskRuns = 0u;
+    auto taskId = scheduler.registerTask([&]() { taskRuns++; }, std::chrono::milliseconds(1));
+
+    auto now = scheduler.tasks.front().nextRun;
+    EXPECT_EQ(now + std::chrono::milliseconds(1), scheduler.runDueTasks(now));
+    EXPECT_EQ(1u, taskRuns);
+    scheduler.unregisterTask(taskId);
+}
+
+TEST(PeriodicTaskSchedulerTest, givenRegisteredTaskWhenSettingTaskPeriodThenTaskIsRescheduled) {
+    MockPeriodicTaskScheduler scheduler;
+    auto taskId = scheduler.registerTask([]() {}, std::chrono::seconds(10));
+    auto nextRun = scheduler.tasks.front().nextRun;
+
+    scheduler.setTaskPeriod(taskId, std::chrono::milliseconds(1));
+    EXPECT_EQ(std::chrono::microseconds(std::chrono::milliseconds(1)), scheduler.tasks.front().period);
+    EXPECT_LT(scheduler.tasks.front().nextRun, nextRun);
+
+    scheduler.setTaskPeriod(taskId + 1, std::chrono::seconds(1));
+    EXPECT_EQ(std::chrono::microseconds(std::chrono::milliseconds(1)), scheduler.tasks.front().period);
+    scheduler.unregisterTask(taskId);
+}
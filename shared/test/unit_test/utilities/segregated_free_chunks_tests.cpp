@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/segregated_free_chunks.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+TEST(SegregatedFreeChunksTest, givenAdjacentChunksWhenInsertingThenChunksAreCoalesced) {
+    SegregatedFreeChunks freeChunks;
+    freeChunks.insert(0x10000, 0x1000);
+    freeChunks.insert(0x13000, 0x1000);
+    EXPECT_EQ(2u, freeChunks.getChunksCount());
+
+    freeChunks.insert(0x11000, 0x1000);
+    EXPECT_EQ(2u, freeChunks.getChunksCount());
+    EXPECT_EQ(0x2000u, freeChunks.getLargestChunkSize());
+
+    freeChunks.insert(0x12000, 0x1000);
+    EXPECT_EQ(1u, freeChunks.getChunksCount());
+    EXPECT_EQ(0x4000u, freeChunks.getLargestChunkSize());
+    EXPECT_EQ(0x4000u, freeChunks.getFreeSize());
+
+    freeChunks.insert(0x20000, 0u);
+    EXPECT_EQ(1u, freeChunks.getChunksCount());
+}
+
+TEST(SegregatedFreeChunksTest, givenChunksOfDifferentSizesWhenAllocatingThenBestFitChunkIsUsedAndRemainderIsKept) {
+    SegregatedFreeChunks freeChunks;
+    freeChunks.insert(0x100000, 0x8000);
+    freeChunks.insert(0x200000, 0x3000);
+    freeChunks.insert(0x300000, 0x2000);
+
+    EXPECT_EQ(0x300000u, freeChunks.allocate(0x2000, MemoryConstants::pageSize));
+    EXPECT_EQ(2u, freeChunks.getChunksCount());
+
+    EXPECT_EQ(0x200000u, freeChunks.allocate(0x2000, MemoryConstants::pageSize));
+    EXPECT_EQ(2u, freeChunks.getChunksCount());
+    EXPECT_EQ(0x9000u, freeChunks.getFreeSize());
+
+    EXPECT_EQ(0x100000u, freeChunks.allocate(0x5000, MemoryConstants::pageSize));
+    EXPECT_EQ(0u, freeChunks.allocate(0x4000, MemoryConstants::pageSize));
+    EXPECT_EQ(0u, freeChunks.allocate(0u, MemoryConstants::pageSize));
+    EXPECT_EQ(0x4000u, freeChunks.getFreeSize());
+}
+
+TEST(SegregatedFreeChunksTest, givenAlignmentWhenAllocatingThenPaddingIsReturnedToFreeChunks) {
+    SegregatedFreeChunks freeChunks;
+    freeChunks.insert(0x11000, 0x20000);
+
+    auto ptr = freeChunks.allocate(0x1000, MemoryConstants::pageSize64k);
+    EXPECT_EQ(0x20000u, ptr);
+    EXPECT_EQ(2u, freeChunks.getChunksCount());
+    EXPECT_EQ(0x1f000u, freeChunks.getFreeSize());
+
+    EXPECT_EQ(0u, freeChunks.allocate(0x20000, MemoryConstants::pageSize64k));
+
+    freeChunks.insert(ptr, 0x1000);
+    EXPECT_EQ(1u, freeChunks.getChunksCount());
+    EXPECT_EQ(0x20000u, freeChunks.getLargestChunkSize());
+}
+
+TEST(SegregatedFreeChunksTest, givenChunkWhenExtractingByBoundaryThenOnlyMatchingChunkIsRemoved) {
+    SegregatedFreeChunks freeChunks;
+    freeChunks.insert(0x10000, 0x1000);
+    freeChunks.insert(0x20000, 0x2000);
+
+    EXPECT_EQ(0u, freeChunks.extractStartingAt(0x11000));
+    EXPECT_EQ(0u, freeChunks.extractEndingAt(0x10000));
+    EXPECT_EQ(0u, freeChunks.extractEndingAt(0x21000));
+
+    EXPECT_EQ(0x1000u, freeChunks.extractStartingAt(0x10000));
+    EXPECT_EQ(0x2000u, freeChunks.extractEndingAt(0x22000));
+    EXPECT_EQ(0u, freeChunks.getChunksCount());
+    EXPECT_EQ(0u, freeChunks.getFreeSize());
+    EXPECT_EQ(0u, freeChunks.getLargestChunkSize());
+}
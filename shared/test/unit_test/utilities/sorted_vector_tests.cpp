@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,3 +38,34 @@ TEST(SortedVectorTest, givenBaseSortedVectorWhenCallingExtractThenCorrectValueIs
     valuePtr = testedVector.extract(reinterpret_cast<void *>(0x1));
     EXPECT_EQ(1u, valuePtr->size);
 }
+
+TEST(SortedVectorTest, givenBaseSortedVectorWhenInsertingPointersOutOfOrderThenAllocationsAreKeptSorted) {
+    TestedSortedVector testedVector;
+    testedVector.insert(reinterpret_cast<void *>(0x30), Data{3u});
+    testedVector.insert(reinterpret_cast<void *>(0x10), Data{1u});
+    testedVector.insert(reinterpret_cast<void *>(0x40), Data{4u});
+    testedVector.insert(reinterpret_cast<void *>(0x20), Data{2u});
+
+    ASSERT_EQ(4u, testedVector.getNumAllocs());
+    for (size_t i = 0; i < testedVector.getNumAllocs(); i++) {
+        EXPECT_EQ(reinterpret_cast<void *>(0x10 * (i + 1)), testedVector.allocations[i].first);
+        EXPECT_EQ(i + 1, testedVector.allocations[i].second->size);
+    }
+    EXPECT_EQ(2u, testedVector.get(reinterpret_cast<void *>(0x21))->size);
+}
+
+TEST(SortedVectorTest, givenBaseSortedVectorWhenRemovingPointerThenOnlyMatchingEntryIsRemoved) {
+    TestedSortedVector testedVector;
+    testedVector.insert(reinterpret_cast<void *>(0x10), Data{0x10});
+    testedVector.insert(reinterpret_cast<void *>(0x20), Data{0x10});
+    testedVector.insert(reinterpret_cast<void *>(0x30), Data{0x10});
+
+    testedVector.remove(reinterpret_cast<void *>(0x28));
+    EXPECT_EQ(3u, testedVector.getNumAllocs());
+
+    testedVector.remove(reinterpret_cast<void *>(0x20));
+    ASSERT_EQ(2u, testedVector.getNumAllocs());
+    EXPECT_EQ(reinterpret_cast<void *>(0x10), testedVector.allocations[0].first);
+    EXPECT_EQ(reinterpret_cast<void *>(0x30), testedVector.allocations[1].first);
+    EXPECT_EQ(nullptr, testedVector.get(reinterpret_cast<void *>(0x20)));
+}
@@ -22,6 +22,8 @@
 #include "gtest/gtest.h"
 
 #include <cstdint>
+#include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -81,15 +83,18 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using TagNodeT = TagNode<TagType>;
 
   public:
+    using BaseClass::counters;
     using BaseClass::deferredTags;
     using BaseClass::doNotReleaseNodes;
     using BaseClass::freeTags;
+    using BaseClass::getThreadCache;
     using BaseClass::gfxAllocations;
     using BaseClass::populateFreeTags;
     using BaseClass::releaseDeferredTags;
     using BaseClass::returnTagToDeferredPool;
     using BaseClass::rootDeviceIndices;
     using BaseClass::TagAllocator;
+    using BaseClass::threadCaches;
     using BaseClass::usedTags;
     using BaseClass::TagAllocatorBase::cleanUpResources;
 
@@ -465,6 +470,139 @@ TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDe
     EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty()); // empty again - new pool wasnt allocated
 }
 
+TEST_F(TagAllocatorTest, givenEmptyFreeListWhenManyThreadsAskForNewTagConcurrentlyThenSinglePoolIsAdded) {
+    constexpr size_t tagCount = 4;
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, tagCount, 1, deviceBitfield);
+    TagNodeBase *nodes[2 * tagCount] = {};
+    for (size_t i = 0; i < tagCount; i++) {
+        nodes[i] = tagAllocator.getTag();
+    }
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+
+    std::vector<std::thread> threads;
+    for (size_t i = tagCount; i < 2 * tagCount; i++) {
+        threads.emplace_back([&tagAllocator, &nodes, i]() { nodes[i] = tagAllocator.getTag(); });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+    for (auto node : nodes) {
+        EXPECT_NE(nullptr, node);
+        tagAllocator.returnTag(node);
+    }
+}
+
+TEST_F(TagAllocatorTest, givenEmptyFreeListWhenGettingTagThenFreeTagsMissIsCounted) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 1, deviceBitfield);
+    EXPECT_EQ(nullptr, tagAllocator.threadCaches);
+
+    auto node0 = tagAllocator.getTag();
+    EXPECT_EQ(0u, tagAllocator.getCounters().freeTagsMisses.load());
+    auto node1 = tagAllocator.getTag();
+    EXPECT_EQ(1u, tagAllocator.getCounters().freeTagsMisses.load());
+    EXPECT_EQ(0u, tagAllocator.getCounters().allocatorMutexContentions.load());
+    EXPECT_EQ(0u, tagAllocator.getThreadCacheHits());
+    EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
+
+    tagAllocator.returnTag(node0);
+    tagAllocator.returnTag(node1);
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenTagsAreTakenAndReturnedOnSameThreadThenCacheIsRefilledInBatchAndReused) {
+    debugManager.flags.TagAllocatorThreadCacheSize.set(4);
+    constexpr size_t tagCount = 10;
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, tagCount, 1, deviceBitfield);
+    ASSERT_NE(nullptr, tagAllocator.threadCaches);
+    auto &threadCache = tagAllocator.getThreadCache();
+
+    // caller gets one tag, half of the cache is refilled with single detach from free list
+    auto node0 = tagAllocator.getTag();
+    EXPECT_EQ(1u, tagAllocator.getCounters().threadCacheRefills.load());
+    EXPECT_EQ(0u, tagAllocator.getThreadCacheHits());
+    EXPECT_EQ(2u, threadCache.tagsCount.load());
+    EXPECT_EQ(tagCount - 3, tagAllocator.getFreeTagsHead()->countThisAndAllConnected());
+
+    auto node1 = tagAllocator.getTag();
+    EXPECT_EQ(1u, tagAllocator.getThreadCacheHits());
+    EXPECT_EQ(1u, threadCache.tagsCount.load());
+
+    tagAllocator.returnTag(node0);
+    tagAllocator.returnTag(node1);
+    EXPECT_EQ(3u, threadCache.tagsCount.load());
+    EXPECT_TRUE(threadCache.tags.peekContains(*static_cast<TagNode<TimeStamps> *>(node0)));
+    EXPECT_EQ(tagCount - 3, tagAllocator.getFreeTagsHead()->countThisAndAllConnected());
+
+    auto node2 = tagAllocator.getTag();
+    EXPECT_EQ(node1, node2);
+    EXPECT_EQ(2u, tagAllocator.getThreadCacheHits());
+    EXPECT_EQ(1u, tagAllocator.getCounters().threadCacheRefills.load());
+    EXPECT_EQ(0u, tagAllocator.getCounters().freeTagsMisses.load());
+    tagAllocator.returnTag(node2);
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheFullWhenReturningTagThenTagGoesToFreeList) {
+    debugManager.flags.TagAllocatorThreadCacheSize.set(1);
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 1, deviceBitfield);
+    auto &threadCache = tagAllocator.getThreadCache();
+
+    auto node0 = tagAllocator.getTag();
+    auto node1 = tagAllocator.getTag();
+    EXPECT_EQ(0u, threadCache.tagsCount.load());
+
+    tagAllocator.returnTag(node0);
+    tagAllocator.returnTag(node1);
+    EXPECT_EQ(1u, threadCache.tagsCount.load());
+    EXPECT_TRUE(threadCache.tags.peekContains(*static_cast<TagNode<TimeStamps> *>(node0)));
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*static_cast<TagNode<TimeStamps> *>(node1)));
+}
+
+TEST_F(TagAllocatorTest, givenTagsCachedByOtherThreadWhenFreeListIsEmptyThenCachesAreDrainedInsteadOfAllocatingNewPool) {
+    debugManager.flags.TagAllocatorThreadCacheSize.set(4);
+    constexpr size_t tagCount = 4;
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, tagCount, 1, deviceBitfield);
+    auto &threadCache = tagAllocator.getThreadCache();
+    auto &otherThreadCache = &threadCache == &tagAllocator.threadCaches[0] ? tagAllocator.threadCaches[1] : tagAllocator.threadCaches[0];
+
+    TagNodeBase *nodes[tagCount] = {};
+    for (auto &node : nodes) {
+        node = tagAllocator.getTag();
+    }
+    EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty());
+    for (auto node : nodes) {
+        tagAllocator.returnTag(node);
+    }
+    EXPECT_EQ(tagCount, threadCache.tagsCount.load());
+
+    auto cachedTags = threadCache.tags.detachNodes();
+    threadCache.tagsCount = 0u;
+    otherThreadCache.tags.splice(*cachedTags);
+    otherThreadCache.tagsCount = tagCount;
+
+    auto node = tagAllocator.getTag();
+    EXPECT_NE(nullptr, node);
+    EXPECT_EQ(1u, tagAllocator.getTagPoolCount());
+    EXPECT_EQ(1u, tagAllocator.getCounters().freeTagsMisses.load());
+    EXPECT_EQ(1u, tagAllocator.getCounters().threadCachesDrains.load());
+    EXPECT_EQ(0u, otherThreadCache.tagsCount.load());
+    EXPECT_TRUE(otherThreadCache.tags.peekIsEmpty());
+    EXPECT_EQ(tagCount - 1, tagAllocator.getFreeTagsHead()->countThisAndAllConnected());
+    tagAllocator.returnTag(node);
+}
+
+TEST_F(TagAllocatorTest, givenPrintTagAllocatorCountersWhenAllocatorIsDestroyedThenCountersArePrinted) {
+    debugManager.flags.PrintTagAllocatorCounters.set(1);
+    testing::internal::CaptureStdout();
+    {
+        MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 1, 1, deviceBitfield);
+        tagAllocator.returnTag(tagAllocator.getTag());
+    }
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("TagAllocator counters: free tags misses: 0, allocator mutex contentions: 0, thread cache hits: 0, thread cache refills: 0, thread caches drains: 0, tag pools: 1"));
+}
+
 TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSetValidllocationType) {
     MockTagAllocator<TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>> timestampPacketAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount>), false, mockDeviceBitfield);
     MockTagAllocator<HwTimeStamps> hwTimeStampsAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(HwTimeStamps), false, mockDeviceBitfield);
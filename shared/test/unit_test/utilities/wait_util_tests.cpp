@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2024 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -98,3 +98,12 @@ TEST_F(WaitPredicateOnlyTest, givenDebugFlagSetZeroWhenPollAddressProvidedMeetsC
     EXPECT_TRUE(ret);
     EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
 }
+
+TEST_F(WaitPredicateOnlyTest, givenWaitPkgDisabledWhenWaitingForMultipleAddressesThenPauseDefaultTime) {
+    WaitUtils::init();
+
+    volatile TagAddressType pollValue = 1u;
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    WaitUtils::waitFunctionForMultiple(&pollValue);
+    EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
+}
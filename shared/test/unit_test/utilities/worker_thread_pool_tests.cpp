@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/utilities/worker_thread_pool.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct MockWorkerThreadPool : public WorkerThreadPool {
+    using WorkerThreadPool::submissionMutex;
+    using WorkerThreadPool::WorkerThreadPool;
+    using WorkerThreadPool::workerThreads;
+
+    ~MockWorkerThreadPool() override {
+        stopThreads();
+    }
+};
+
+TEST(WorkerThreadPoolTest, givenWorkersStartedWhenRunningItemsThenEachItemIsProcessedOnceAndWorkersAreReusedByNextCall) {
+    MockWorkerThreadPool pool(3u);
+    pool.startThreads();
+    EXPECT_EQ(3u, pool.workerThreads.size());
+
+    for (auto run = 0u; run < 2u; run++) {
+        std::vector<std::atomic<uint32_t>> processed(64u);
+        pool.runForEachItem(processed.size(), [&](size_t item) { processed[item]++; });
+        for (auto &count : processed) {
+            EXPECT_EQ(1u, count.load());
+        }
+    }
+    EXPECT_EQ(3u, pool.workerThreads.size());
+}
+
+TEST(WorkerThreadPoolTest, givenWorkersBusyWithOtherCallerWhenRunningItemsThenItemsAreProcessedOnCallingThread) {
+    MockWorkerThreadPool pool(2u);
+    pool.startThreads();
+
+    std::lock_guard<std::mutex> otherCaller(pool.submissionMutex);
+    const auto callingThread = std::this_thread::get_id();
+    std::vector<std::thread::id> processingThreads(8u);
+    pool.runForEachItem(processingThreads.size(), [&](size_t item) { processingThreads[item] = std::this_thread::get_id(); });
+    for (auto &processingThread : processingThreads) {
+        EXPECT_EQ(callingThread, processingThread);
+    }
+}
+
+TEST(WorkerThreadPoolTest, givenModuleBuildThreadsCountFlagWhenInitializingModuleBuildWorkersThenPoolIsCreatedOnceWithOneWorkerLessThanThreadsCount) {
+    DebugManagerStateRestore restorer;
+    {
+        ExecutionEnvironment executionEnvironment;
+        EXPECT_EQ(nullptr, executionEnvironment.initializeModuleBuildWorkers());
+    }
+    {
+        debugManager.flags.ModuleBuildThreadsCount.set(4);
+        ExecutionEnvironment executionEnvironment;
+        auto workers = executionEnvironment.initializeModuleBuildWorkers();
+        ASSERT_NE(nullptr, workers);
+        EXPECT_EQ(3u, workers->getWorkersCount());
+        EXPECT_EQ(workers, executionEnvironment.initializeModuleBuildWorkers());
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,15 +16,20 @@ using namespace NEO;
 
 struct CpuInfoFixture {
     using CpuIdFuncT = void (*)(int *, int);
+    using XgetbvFuncT = uint64_t (*)(uint32_t);
     void setUp() {
         defaultCpuidFunc = CpuInfo::cpuidFunc;
+        defaultXgetbvFunc = CpuInfo::xgetbvFunc;
+        CpuInfo::xgetbvFunc = mockXgetbvEnableAll;
     }
 
     void tearDown() {
         CpuInfo::cpuidFunc = defaultCpuidFunc;
+        CpuInfo::xgetbvFunc = defaultXgetbvFunc;
     }
 
     CpuIdFuncT defaultCpuidFunc;
+    XgetbvFuncT defaultXgetbvFunc;
 };
 
 using CpuInfoTest = Test<CpuInfoFixture>;
@@ -35,6 +40,7 @@ TEST_F(CpuInfoTest, giveFunctionIsNotAvailableWhenFeatureIsNotSupportedThenMaskB
     CpuInfo testCpuInfo;
 
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitPkg));
 }
@@ -45,6 +51,7 @@ TEST_F(CpuInfoTest, giveFunctionIsAvailableWhenFeatureIsNotSupportedThenMaskBitI
     CpuInfo testCpuInfo;
 
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitPkg));
 }
@@ -55,10 +62,41 @@ TEST_F(CpuInfoTest, whenFeatureIsSupportedThenMaskBitIsOn) {
     CpuInfo testCpuInfo;
 
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitPkg));
 }
 
+TEST_F(CpuInfoTest, givenOsNotSavingAvx512StateWhenCpuReportsAvx512ThenAvx512IsNotSupported) {
+    CpuInfo::cpuidFunc = mockCpuidEnableAll;
+    CpuInfo::xgetbvFunc = mockXgetbvAvxStateOnly;
+
+    CpuInfo testCpuInfo;
+
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512));
+}
+
+TEST_F(CpuInfoTest, givenOsxsaveNotReportedWhenCpuReportsAvx512ThenXcr0IsNotReadAndAvx512IsNotSupported) {
+    static uint32_t xgetbvCalled = 0u;
+    xgetbvCalled = 0u;
+    CpuInfo::cpuidFunc = [](int *cpuInfo, int functionId) {
+        mockCpuidEnableAll(cpuInfo, functionId);
+        if (functionId == 1) {
+            cpuInfo[2] &= ~(1 << 27);
+        }
+    };
+    CpuInfo::xgetbvFunc = [](uint32_t xcr) -> uint64_t {
+        xgetbvCalled++;
+        return mockXgetbvEnableAll(xcr);
+    };
+
+    CpuInfo testCpuInfo;
+
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512));
+    EXPECT_EQ(0u, xgetbvCalled);
+}
+
 TEST_F(CpuInfoTest, WhenGettingVirtualAddressSizeThenCorrectResultIsReturned) {
     CpuInfo::cpuidFunc = mockCpuidReport36BitVirtualAddressSize;
 
@@ -88,6 +126,6 @@ TEST_F(CpuInfoTest, GivenPrintCpuFlagsEnabledWhenGettingVirtualAddressSizeThenCp
     std::string output = testing::internal::GetCapturedStdout();
 
     EXPECT_EQ(36u, addressSize);
-    std::string expectedString = "CPUFlags:\nCLFlush: 1 Avx2: 1 WaitPkg: 1\nVirtual Address Size 36\n";
+    std::string expectedString = "CPUFlags:\nCLFlush: 1 Avx2: 1 Avx512: 1 WaitPkg: 1\nVirtual Address Size 36\n";
     EXPECT_STREQ(output.c_str(), expectedString.c_str());
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -276,3 +276,19 @@ TEST_F(WaitPkgEnabledTest, givenMonitoredAddressChangedWhenAddressNotMatchesPred
     EXPECT_EQ(WaitUtils::waitpkgControlValue, CpuIntrinsicsTests::lastUmwaitControl);
     EXPECT_EQ(1u, CpuIntrinsicsTests::umwaitCounter);
 }
+
+TEST_F(WaitPkgEnabledTest, givenMonitorAddressWhenWaitingForMultipleAddressesThenMonitorIsArmedOnGivenAddress) {
+    volatile TagAddressType pollValue = 0u;
+    CpuIntrinsicsTests::rdtscRetValue = 3700;
+
+    WaitUtils::waitFunctionForMultiple(&pollValue);
+
+    EXPECT_EQ(1u, CpuIntrinsicsTests::umonitorCounter);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&pollValue), CpuIntrinsicsTests::lastUmonitorPtr);
+    EXPECT_EQ(CpuIntrinsicsTests::rdtscRetValue + WaitUtils::waitpkgCounterValue, CpuIntrinsicsTests::lastUmwaitCounter);
+    EXPECT_EQ(1u, CpuIntrinsicsTests::umwaitCounter);
+
+    WaitUtils::waitFunctionForMultiple(nullptr);
+    EXPECT_EQ(1u, CpuIntrinsicsTests::umonitorCounter);
+    EXPECT_EQ(1u, CpuIntrinsicsTests::umwaitCounter);
+}